@@ -35,6 +35,93 @@ void WebServerTask(void *);
  */
 QueueHandle_t imuSensorQueue;
 
+/**
+ * @brief A one-slot mailbox carrying IMU configuration changes to the sensor task.
+ * 
+ */
+QueueHandle_t imuConfigQueue;
+
+/**
+ * @brief Notification bits used to wake the tasks from the event scheduler.
+ *
+ */
+#define EVENT_SENSOR_TICK  (1UL << 0)
+#define EVENT_IMU_SAMPLE   (1UL << 1)
+#define EVENT_SOCKET_POLL  (1UL << 2)
+#define EVENT_STREAM_TICK  (1UL << 3)
+#define EVENT_STATS_TICK   (1UL << 4)
+#define EVENT_IMU_CONFIG   (1UL << 5)
+#define EVENT_I2C_DUE      (1UL << 6)
+#define EVENT_I2C_DONE     (1UL << 7)
+
+/**
+ * @brief Task pacing periods in microseconds.
+ *
+ */
+#define SENSOR_SAMPLE_PERIOD_US  20000
+#define SOCKET_POLL_PERIOD_US    5000
+#define STATS_LOG_PERIOD_US      10000000
+
+/**
+ * @brief Auxiliary sensor read periods in microseconds, and how long before
+ *        each IMU tick the shared I2C bus must be free again.
+ *
+ */
+#define AUX_MAG_PERIOD_US        12500
+#define AUX_POWER_PERIOD_US      100000
+#define I2C_IMU_GUARD_US         200
+
+/**
+ * @brief Minimum spacing of IMU and access point bring-up attempts, in
+ *        microseconds. Failed attempts are retried from the task's periodic
+ *        tick instead of sleeping.
+ *
+ */
+#define IMU_INIT_RETRY_PERIOD_US 100000
+#define NETWORK_RETRY_PERIOD_US  500000
+
+/**
+ * @brief Boot milestones: server listening and first IMU sample published.
+ *
+ */
+#define BOOT_MILESTONES 2
+
+/**
+ * @brief Task stack sizes (bytes) and queue depth. Size these from the stack
+ *        high-water marks reported by the memory profiler. The server task
+ *        stack holds frame and JSON buffers, not the server objects, which
+ *        are static; it stays at 10000 until a high-water mark is measured.
+ *
+ */
+#define SENSOR_TASK_STACK_SIZE 4096
+#define WEB_TASK_STACK_SIZE    10000
+#define IMU_QUEUE_LENGTH       10
+
+/**
+ * @brief Task priorities. Both tasks run above the NeoPixel status engine.
+ *
+ */
+#define SENSOR_TASK_PRIORITY 2
+#define WEB_TASK_PRIORITY    2
+
+/**
+ * @brief Period of the NeoPixel heartbeat shown while sampling.
+ *
+ */
+#define SAMPLING_BLINK_PERIOD_MS 200
+
+/**
+ * @brief gRPC server port.
+ *
+ */
+#define GRPC_SERVER_PORT 50051
+
+/**
+ * @brief Port of the HTTP dashboard and its WebSocket endpoint.
+ *
+ */
+#define WEB_SERVER_PORT 80
+
 /**
  * @brief AccessPoint Credentials
  * 
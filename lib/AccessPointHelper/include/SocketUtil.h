@@ -0,0 +1,31 @@
+/**
+ * @file SocketUtil.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Socket checks shared by the servers running on the access point.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef SOCKET_UTIL_H
+#define SOCKET_UTIL_H
+
+#include <WiFiClient.h>
+
+class CSocketUtil
+{
+public:
+   /**
+    * @brief Check without blocking whether a client's socket can take more
+    *        data. WiFiClient::write() otherwise waits for the peer to drain
+    *        the send buffer, stalling the calling task.
+    *
+    * @param client WiFi client connection.
+    * @return true if the send buffer is above its low-water mark.
+    */
+   static bool IsWritable(WiFiClient &client);
+};
+
+#endif // !SOCKET_UTIL_H
@@ -0,0 +1,30 @@
+/**
+ * @file SocketUtil.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the shared socket checks.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "SocketUtil.h"
+#include <lwip/sockets.h>
+
+bool CSocketUtil::IsWritable(WiFiClient &client)
+{
+   int fd = client.fd();
+   if (fd < 0)
+   {
+      return false;
+   }
+
+   // lwIP reports a socket writable only while its send buffer is above the
+   // low-water mark, which leaves room for a whole stream frame.
+   fd_set writeSet;
+   FD_ZERO(&writeSet);
+   FD_SET(fd, &writeSet);
+   struct timeval timeout = {0, 0};
+   return select(fd + 1, NULL, &writeSet, NULL, &timeout) > 0;
+}
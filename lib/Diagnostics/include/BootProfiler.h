@@ -0,0 +1,86 @@
+/**
+ * @file BootProfiler.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Timestamped record of the boot phases.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Maximum number of boot phases recorded.
+ */
+#define BOOT_PROFILER_MAX_PHASES 16
+
+/**
+ * @brief One completed boot phase.
+ */
+typedef struct {
+   const char *name;       // Phase name, a string literal
+   int64_t time_us;        // esp_timer time when the phase completed
+   uint8_t core;           // Core the phase completed on
+} boot_phase_t;
+
+/**
+ * @brief Records when each boot phase completes. Phases may be marked from
+ *        tasks running in parallel on either core. Boot is complete once the
+ *        expected number of milestones has been marked; a final "ready" phase
+ *        is then recorded and the whole profile is logged.
+ */
+class CBootProfiler
+{
+public:
+   /**
+    * @brief Construct a new CBootProfiler object
+    *
+    * @param milestones Milestones that must be marked before boot is complete.
+    */
+   CBootProfiler(uint8_t milestones);
+   /**
+    * @brief Record the completion of a phase.
+    *
+    * @param name Phase name, must outlive the profiler.
+    * @param milestone true if the phase is one of the boot milestones.
+    */
+   void Mark(const char *name, bool milestone = false);
+   /**
+    * @brief Whether every milestone has been marked.
+    *
+    * @return true once boot is complete.
+    */
+   bool IsComplete() const;
+   /**
+    * @brief Get a recorded phase, in completion order.
+    *
+    * @param index Phase index, from 0 to GetPhaseCount() - 1.
+    * @param phase Receives the phase.
+    * @return true if the index is valid.
+    */
+   bool GetPhase(uint8_t index, boot_phase_t &phase) const;
+   /**
+    * @brief Number of recorded phases.
+    *
+    * @return uint8_t Phase count.
+    */
+   uint8_t GetPhaseCount() const;
+   /**
+    * @brief Log every recorded phase with its time and the time since the
+    *        previous phase.
+    */
+   void Log() const;
+
+private:
+   boot_phase_t m_Phases[BOOT_PROFILER_MAX_PHASES];
+   uint8_t m_PhaseCount;
+   uint8_t m_Milestones;          // Milestones still to be marked
+   mutable portMUX_TYPE m_Lock;
+};
+
+#endif // !BOOT_PROFILER_H
@@ -0,0 +1,97 @@
+/**
+ * @file JsonPoolAllocator.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief A bump ArduinoJson allocator backed by a static arena.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef JSON_POOL_ALLOCATOR_H
+#define JSON_POOL_ALLOCATOR_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+/**
+ * @brief Size of the arena in bytes. Must hold every document alive at once
+ *        while one request is handled, allocation headers included.
+ */
+#ifndef JSON_POOL_ARENA_SIZE
+#define JSON_POOL_ARENA_SIZE 12288
+#endif
+
+/**
+ * @brief Bytes in front of each allocation holding its capacity; also the
+ *        alignment of every allocation.
+ */
+#define JSON_POOL_HEADER_SIZE 8
+
+/**
+ * @brief Usage counters of the JSON arena.
+ */
+typedef struct {
+   uint32_t bytes_in_use;     // Bytes from the start of the arena to its top
+   uint32_t peak_bytes;       // Highest top since boot
+   uint32_t heap_fallbacks;   // Requests that did not fit and went to the heap
+} json_pool_stats_t;
+
+/**
+ * @brief ArduinoJson allocator carving allocations off the top of a static
+ *        arena, so JsonDocuments built per request do not touch the heap.
+ *
+ * Each allocation takes only the bytes it asks for. Freeing the topmost
+ * allocation lowers the top, growing or shrinking it happens in place, and
+ * the whole arena is reclaimed as soon as nothing in it is alive, which is
+ * the case between requests. Space freed below the top is reused only then.
+ * Requests that do not fit fall back to the heap and are counted, which
+ * makes any steady-state heap use visible in the memory profile.
+ */
+class CJsonPoolAllocator : public ArduinoJson::Allocator
+{
+public:
+   /**
+    * @brief Get the process-wide allocator instance.
+    *
+    * @return CJsonPoolAllocator* Shared allocator.
+    */
+   static CJsonPoolAllocator *Instance();
+
+   void *allocate(size_t size) override;
+   void deallocate(void *pointer) override;
+   void *reallocate(void *pointer, size_t new_size) override;
+
+   /**
+    * @brief Get the arena usage counters.
+    *
+    * @return json_pool_stats_t Copy of the current counters.
+    */
+   json_pool_stats_t GetStats();
+
+private:
+   CJsonPoolAllocator();
+   /**
+    * @brief Check whether a pointer belongs to the arena.
+    *
+    * @param pointer Pointer to check.
+    * @return true for arena pointers, false for heap pointers.
+    */
+   bool IsInArena(const void *pointer) const;
+   /**
+    * @brief Move the top of the arena and update the counters. Called with
+    *        the lock held.
+    *
+    * @param top New offset of the first free byte.
+    */
+   void SetTop(size_t top);
+
+   alignas(JSON_POOL_HEADER_SIZE) uint8_t m_Arena[JSON_POOL_ARENA_SIZE];
+   size_t m_Top;              // Offset of the first free byte
+   uint32_t m_Live;           // Arena allocations not yet freed
+   json_pool_stats_t m_Stats;
+   portMUX_TYPE m_Lock;
+};
+
+#endif // !JSON_POOL_ALLOCATOR_H
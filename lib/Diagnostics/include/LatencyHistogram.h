@@ -0,0 +1,99 @@
+/**
+ * @file LatencyHistogram.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Fixed-size histogram of latencies in power-of-two buckets.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Number of histogram buckets.
+ */
+#define LATENCY_HISTOGRAM_BUCKETS 16
+
+/**
+ * @brief Upper limit of the first bucket, as a power of two microseconds
+ *        (2^7 = 128us). Each following bucket doubles the limit; the last one
+ *        holds everything from 2^21us (about 2.1s) up.
+ */
+#define LATENCY_HISTOGRAM_FIRST_SHIFT 7
+
+/**
+ * @brief Latency distribution with count, mean and maximum. Not locked; it is
+ *        recorded and read from the same task.
+ */
+class CLatencyHistogram
+{
+public:
+   /**
+    * @brief Construct an empty CLatencyHistogram object
+    */
+   CLatencyHistogram();
+   /**
+    * @brief Clear every bucket and counter.
+    */
+   void Reset();
+   /**
+    * @brief Add one latency. Negative values, from clock estimate error, are
+    *        counted as zero.
+    *
+    * @param latencyUs Latency in microseconds.
+    */
+   void Record(int64_t latencyUs);
+   /**
+    * @brief Number of latencies recorded.
+    *
+    * @return uint32_t Sample count.
+    */
+   uint32_t GetCount() const;
+   /**
+    * @brief Mean of the recorded latencies.
+    *
+    * @return uint32_t Mean in microseconds, 0 when empty.
+    */
+   uint32_t GetMeanUs() const;
+   /**
+    * @brief Largest recorded latency.
+    *
+    * @return uint32_t Maximum in microseconds.
+    */
+   uint32_t GetMaxUs() const;
+   /**
+    * @brief Upper limit of the bucket holding the given percentile.
+    *
+    * @param percent Percentile, 0 to 100.
+    * @return uint32_t Bucket limit in microseconds (the maximum for the last
+    *         bucket), 0 when empty.
+    */
+   uint32_t GetPercentileUs(uint8_t percent) const;
+   /**
+    * @brief Number of latencies in a bucket.
+    *
+    * @param bucket Bucket index, from 0 to LATENCY_HISTOGRAM_BUCKETS - 1.
+    * @return uint32_t Bucket count.
+    */
+   uint32_t GetBucket(uint8_t bucket) const;
+   /**
+    * @brief Exclusive upper limit of a bucket.
+    *
+    * @param bucket Bucket index, from 0 to LATENCY_HISTOGRAM_BUCKETS - 2.
+    * @return uint32_t Limit in microseconds.
+    */
+   static uint32_t GetBucketLimitUs(uint8_t bucket);
+
+private:
+   uint32_t m_Buckets[LATENCY_HISTOGRAM_BUCKETS];
+   uint32_t m_Count;
+   uint64_t m_SumUs;
+   uint32_t m_MaxUs;
+};
+
+#endif // !LATENCY_HISTOGRAM_H
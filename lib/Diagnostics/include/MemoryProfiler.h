@@ -0,0 +1,119 @@
+/**
+ * @file MemoryProfiler.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Periodic stack and heap budget profiler.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef MEMORY_PROFILER_H
+#define MEMORY_PROFILER_H
+
+#include <Arduino.h>
+#include "JsonPoolAllocator.h"
+
+/**
+ * @brief Maximum number of tasks whose stacks are tracked.
+ */
+#define MEMORY_PROFILER_MAX_TASKS 6
+
+/**
+ * @brief Number of heap samples kept in the history ring.
+ */
+#define MEMORY_PROFILER_HISTORY_LENGTH 32
+
+/**
+ * @brief Stack usage of a registered task.
+ */
+typedef struct {
+   const char *name;
+   TaskHandle_t handle;
+   uint32_t stack_size;       // Stack size given at creation, in bytes
+   uint32_t stack_free_min;   // Stack high-water mark, in bytes never used
+} task_stack_info_t;
+
+/**
+ * @brief One heap sample.
+ */
+typedef struct {
+   uint32_t timestamp;        // millis() when the sample was taken
+   uint32_t free_heap;        // Free heap at sample time
+   uint32_t min_free_heap;    // Lowest free heap since boot
+   uint32_t largest_block;    // Largest allocatable block
+} heap_sample_t;
+
+/**
+ * @brief Tracks stack high-water marks of registered tasks and a history of
+ *        heap headroom, so memory budgets can be sized from measurements.
+ */
+class CMemoryProfiler
+{
+public:
+   /**
+    * @brief Construct a new CMemoryProfiler object
+    */
+   CMemoryProfiler();
+   /**
+    * @brief Track the stack of a task.
+    *
+    * @param name Name reported in the profile.
+    * @param handle Task handle.
+    * @param stackSize Stack size the task was created with, in bytes.
+    * @return true if the task was registered.
+    */
+   bool RegisterTask(const char *name, TaskHandle_t handle, uint32_t stackSize);
+   /**
+    * @brief Take a heap sample and refresh all stack high-water marks.
+    */
+   void Sample();
+   /**
+    * @brief Log the latest sample, the heap trend and stack headroom.
+    */
+   void Log();
+   /**
+    * @brief Get the most recent heap sample.
+    *
+    * @return heap_sample_t Latest sample (zeroed before the first Sample()).
+    */
+   heap_sample_t GetLatest() const;
+   /**
+    * @brief Get a heap sample from the history.
+    *
+    * @param age 0 for the latest sample, 1 for the one before, ...
+    * @param sample Receives the sample.
+    * @return true if a sample of that age exists.
+    */
+   bool GetHistory(uint8_t age, heap_sample_t &sample) const;
+   /**
+    * @brief Number of samples available in the history.
+    *
+    * @return uint8_t Sample count.
+    */
+   uint8_t GetHistoryCount() const;
+   /**
+    * @brief Get the stack information of a registered task.
+    *
+    * @param index Task index, from 0 to GetTaskCount() - 1.
+    * @param info Receives the stack information.
+    * @return true if the index is valid.
+    */
+   bool GetTask(uint8_t index, task_stack_info_t &info) const;
+   /**
+    * @brief Number of registered tasks.
+    *
+    * @return uint8_t Task count.
+    */
+   uint8_t GetTaskCount() const;
+
+private:
+   task_stack_info_t m_Tasks[MEMORY_PROFILER_MAX_TASKS];
+   uint8_t m_TaskCount;
+   heap_sample_t m_History[MEMORY_PROFILER_HISTORY_LENGTH];
+   uint8_t m_HistoryHead;     // Index of the next slot to write
+   uint8_t m_HistoryCount;
+};
+
+#endif // !MEMORY_PROFILER_H
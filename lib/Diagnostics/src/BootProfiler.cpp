@@ -0,0 +1,94 @@
+/**
+ * @file BootProfiler.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the boot phase profiler.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "BootProfiler.h"
+#include <esp_timer.h>
+
+CBootProfiler::CBootProfiler(uint8_t milestones)
+   : m_PhaseCount(0), m_Milestones(milestones), m_Lock(portMUX_INITIALIZER_UNLOCKED)
+{
+   memset(m_Phases, 0, sizeof(m_Phases));
+}
+
+void CBootProfiler::Mark(const char *name, bool milestone)
+{
+   int64_t nowUs = esp_timer_get_time();
+   bool complete = false;
+
+   portENTER_CRITICAL(&m_Lock);
+   if (m_PhaseCount < BOOT_PROFILER_MAX_PHASES)
+   {
+      boot_phase_t &phase = m_Phases[m_PhaseCount++];
+      phase.name = name;
+      phase.time_us = nowUs;
+      phase.core = xPortGetCoreID();
+   }
+   if (milestone && m_Milestones > 0)
+   {
+      m_Milestones--;
+      complete = (m_Milestones == 0);
+   }
+   if (complete && m_PhaseCount < BOOT_PROFILER_MAX_PHASES)
+   {
+      boot_phase_t &phase = m_Phases[m_PhaseCount++];
+      phase.name = "ready";
+      phase.time_us = nowUs;
+      phase.core = xPortGetCoreID();
+   }
+   portEXIT_CRITICAL(&m_Lock);
+
+   log_i("Boot phase %s at %lld us", name, nowUs);
+   if (complete)
+   {
+      Log();
+   }
+}
+
+bool CBootProfiler::IsComplete() const
+{
+   portENTER_CRITICAL(&m_Lock);
+   bool complete = (m_Milestones == 0);
+   portEXIT_CRITICAL(&m_Lock);
+   return complete;
+}
+
+bool CBootProfiler::GetPhase(uint8_t index, boot_phase_t &phase) const
+{
+   portENTER_CRITICAL(&m_Lock);
+   bool valid = index < m_PhaseCount;
+   if (valid)
+   {
+      phase = m_Phases[index];
+   }
+   portEXIT_CRITICAL(&m_Lock);
+   return valid;
+}
+
+uint8_t CBootProfiler::GetPhaseCount() const
+{
+   portENTER_CRITICAL(&m_Lock);
+   uint8_t count = m_PhaseCount;
+   portEXIT_CRITICAL(&m_Lock);
+   return count;
+}
+
+void CBootProfiler::Log() const
+{
+   boot_phase_t phase;
+   int64_t previousUs = 0;
+   log_i("Boot profile:");
+   for (uint8_t i = 0; GetPhase(i, phase); i++)
+   {
+      log_i("  %-16s %8lld us (+%lld us) core %u",
+            phase.name, phase.time_us, phase.time_us - previousUs, phase.core);
+      previousUs = phase.time_us;
+   }
+}
@@ -0,0 +1,145 @@
+/**
+ * @file JsonPoolAllocator.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the bump ArduinoJson allocator.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "JsonPoolAllocator.h"
+
+static_assert(JSON_POOL_ARENA_SIZE % JSON_POOL_HEADER_SIZE == 0, "JSON arena must be a whole number of headers");
+
+/**
+ * @brief Round a request up to the allocation alignment.
+ */
+static inline size_t Capacity(size_t size)
+{
+   return (size + JSON_POOL_HEADER_SIZE - 1) & ~(size_t)(JSON_POOL_HEADER_SIZE - 1);
+}
+
+/**
+ * @brief Capacity stored in front of an arena allocation.
+ */
+static inline uint32_t &HeaderOf(void *pointer)
+{
+   return *reinterpret_cast<uint32_t *>(static_cast<uint8_t *>(pointer) - JSON_POOL_HEADER_SIZE);
+}
+
+CJsonPoolAllocator *CJsonPoolAllocator::Instance()
+{
+   static CJsonPoolAllocator allocator;
+   return &allocator;
+}
+
+CJsonPoolAllocator::CJsonPoolAllocator() : m_Top(0), m_Live(0), m_Lock(portMUX_INITIALIZER_UNLOCKED)
+{
+   memset(&m_Stats, 0, sizeof(json_pool_stats_t));
+}
+
+void *CJsonPoolAllocator::allocate(size_t size)
+{
+   size_t capacity = Capacity(size);
+   portENTER_CRITICAL(&m_Lock);
+   if (size <= JSON_POOL_ARENA_SIZE && m_Top + JSON_POOL_HEADER_SIZE + capacity <= JSON_POOL_ARENA_SIZE)
+   {
+      void *pointer = m_Arena + m_Top + JSON_POOL_HEADER_SIZE;
+      HeaderOf(pointer) = capacity;
+      m_Live++;
+      SetTop(m_Top + JSON_POOL_HEADER_SIZE + capacity);
+      portEXIT_CRITICAL(&m_Lock);
+      return pointer;
+   }
+   m_Stats.heap_fallbacks++;
+   portEXIT_CRITICAL(&m_Lock);
+   return malloc(size);
+}
+
+void CJsonPoolAllocator::deallocate(void *pointer)
+{
+   if (!IsInArena(pointer))
+   {
+      free(pointer);
+      return;
+   }
+
+   portENTER_CRITICAL(&m_Lock);
+   size_t start = static_cast<uint8_t *>(pointer) - m_Arena - JSON_POOL_HEADER_SIZE;
+   m_Live--;
+   if (m_Live == 0)
+   {
+      // Nothing alive: the next request starts from an empty arena
+      SetTop(0);
+   }
+   else if (start + JSON_POOL_HEADER_SIZE + HeaderOf(pointer) == m_Top)
+   {
+      SetTop(start);
+   }
+   portEXIT_CRITICAL(&m_Lock);
+}
+
+void *CJsonPoolAllocator::reallocate(void *pointer, size_t new_size)
+{
+   if (pointer == nullptr)
+   {
+      return allocate(new_size);
+   }
+   if (!IsInArena(pointer))
+   {
+      return realloc(pointer, new_size);
+   }
+
+   size_t capacity = Capacity(new_size);
+   portENTER_CRITICAL(&m_Lock);
+   size_t start = static_cast<uint8_t *>(pointer) - m_Arena;
+   uint32_t oldCapacity = HeaderOf(pointer);
+   if (start + oldCapacity == m_Top && new_size <= JSON_POOL_ARENA_SIZE && start + capacity <= JSON_POOL_ARENA_SIZE)
+   {
+      // The topmost allocation grows or shrinks where it is
+      HeaderOf(pointer) = capacity;
+      SetTop(start + capacity);
+      portEXIT_CRITICAL(&m_Lock);
+      return pointer;
+   }
+   if (new_size <= oldCapacity)
+   {
+      portEXIT_CRITICAL(&m_Lock);
+      return pointer;
+   }
+   portEXIT_CRITICAL(&m_Lock);
+
+   void *moved = allocate(new_size);
+   if (moved != nullptr)
+   {
+      memcpy(moved, pointer, oldCapacity);
+      deallocate(pointer);
+   }
+   return moved;
+}
+
+json_pool_stats_t CJsonPoolAllocator::GetStats()
+{
+   portENTER_CRITICAL(&m_Lock);
+   json_pool_stats_t stats = m_Stats;
+   portEXIT_CRITICAL(&m_Lock);
+   return stats;
+}
+
+bool CJsonPoolAllocator::IsInArena(const void *pointer) const
+{
+   const uint8_t *address = static_cast<const uint8_t *>(pointer);
+   return address >= m_Arena && address < m_Arena + sizeof(m_Arena);
+}
+
+void CJsonPoolAllocator::SetTop(size_t top)
+{
+   m_Top = top;
+   m_Stats.bytes_in_use = top;
+   if (top > m_Stats.peak_bytes)
+   {
+      m_Stats.peak_bytes = top;
+   }
+}
@@ -0,0 +1,93 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the latency histogram.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "LatencyHistogram.h"
+
+CLatencyHistogram::CLatencyHistogram()
+{
+   Reset();
+}
+
+void CLatencyHistogram::Reset()
+{
+   memset(m_Buckets, 0, sizeof(m_Buckets));
+   m_Count = 0;
+   m_SumUs = 0;
+   m_MaxUs = 0;
+}
+
+void CLatencyHistogram::Record(int64_t latencyUs)
+{
+   uint32_t us = (latencyUs <= 0) ? 0 : (latencyUs >= UINT32_MAX) ? UINT32_MAX : (uint32_t)latencyUs;
+
+   // Bucket index from the position of the highest set bit
+   uint8_t bucket = 0;
+   uint32_t scaled = us >> LATENCY_HISTOGRAM_FIRST_SHIFT;
+   while (scaled != 0 && bucket < LATENCY_HISTOGRAM_BUCKETS - 1)
+   {
+      scaled >>= 1;
+      bucket++;
+   }
+
+   m_Buckets[bucket]++;
+   m_Count++;
+   m_SumUs += us;
+   if (us > m_MaxUs)
+   {
+      m_MaxUs = us;
+   }
+}
+
+uint32_t CLatencyHistogram::GetCount() const
+{
+   return m_Count;
+}
+
+uint32_t CLatencyHistogram::GetMeanUs() const
+{
+   return (m_Count == 0) ? 0 : (uint32_t)(m_SumUs / m_Count);
+}
+
+uint32_t CLatencyHistogram::GetMaxUs() const
+{
+   return m_MaxUs;
+}
+
+uint32_t CLatencyHistogram::GetPercentileUs(uint8_t percent) const
+{
+   if (m_Count == 0)
+   {
+      return 0;
+   }
+
+   // Smallest bucket whose cumulative count reaches the percentile
+   uint32_t target = ((uint64_t)m_Count * percent + 99) / 100;
+   uint32_t cumulative = 0;
+   for (uint8_t bucket = 0; bucket < LATENCY_HISTOGRAM_BUCKETS - 1; bucket++)
+   {
+      cumulative += m_Buckets[bucket];
+      if (cumulative >= target && cumulative > 0)
+      {
+         return min(GetBucketLimitUs(bucket), m_MaxUs);
+      }
+   }
+   return m_MaxUs;
+}
+
+uint32_t CLatencyHistogram::GetBucket(uint8_t bucket) const
+{
+   return (bucket < LATENCY_HISTOGRAM_BUCKETS) ? m_Buckets[bucket] : 0;
+}
+
+uint32_t CLatencyHistogram::GetBucketLimitUs(uint8_t bucket)
+{
+   return 1UL << (LATENCY_HISTOGRAM_FIRST_SHIFT + bucket);
+}
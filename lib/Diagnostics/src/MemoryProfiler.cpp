@@ -0,0 +1,116 @@
+/**
+ * @file MemoryProfiler.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the stack and heap budget profiler.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "MemoryProfiler.h"
+#include <esp_heap_caps.h>
+
+CMemoryProfiler::CMemoryProfiler() : m_TaskCount(0), m_HistoryHead(0), m_HistoryCount(0)
+{
+   memset(m_Tasks, 0, sizeof(m_Tasks));
+   memset(m_History, 0, sizeof(m_History));
+}
+
+bool CMemoryProfiler::RegisterTask(const char *name, TaskHandle_t handle, uint32_t stackSize)
+{
+   if (m_TaskCount >= MEMORY_PROFILER_MAX_TASKS || handle == NULL)
+   {
+      return false;
+   }
+
+   task_stack_info_t &task = m_Tasks[m_TaskCount++];
+   task.name = name;
+   task.handle = handle;
+   task.stack_size = stackSize;
+   task.stack_free_min = stackSize;
+   return true;
+}
+
+void CMemoryProfiler::Sample()
+{
+   heap_sample_t &sample = m_History[m_HistoryHead];
+   sample.timestamp = millis();
+   sample.free_heap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+   sample.min_free_heap = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+   sample.largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+   m_HistoryHead = (m_HistoryHead + 1) % MEMORY_PROFILER_HISTORY_LENGTH;
+   if (m_HistoryCount < MEMORY_PROFILER_HISTORY_LENGTH)
+   {
+      m_HistoryCount++;
+   }
+
+   for (uint8_t i = 0; i < m_TaskCount; i++)
+   {
+      // On ESP32 the high-water mark is reported in bytes.
+      m_Tasks[i].stack_free_min = uxTaskGetStackHighWaterMark(m_Tasks[i].handle);
+   }
+}
+
+void CMemoryProfiler::Log()
+{
+   heap_sample_t latest = GetLatest();
+   heap_sample_t oldest = latest;
+   GetHistory(m_HistoryCount ? m_HistoryCount - 1 : 0, oldest);
+   json_pool_stats_t pool = CJsonPoolAllocator::Instance()->GetStats();
+
+   log_i("Heap: free=%u min=%u largest=%u drift=%d over %us",
+         latest.free_heap, latest.min_free_heap, latest.largest_block,
+         (int32_t)latest.free_heap - (int32_t)oldest.free_heap,
+         (latest.timestamp - oldest.timestamp) / 1000);
+   log_i("JSON arena: %u/%u bytes in use, peak=%u, heap fallbacks=%u",
+         pool.bytes_in_use, JSON_POOL_ARENA_SIZE, pool.peak_bytes, pool.heap_fallbacks);
+   for (uint8_t i = 0; i < m_TaskCount; i++)
+   {
+      log_i("Stack %s: %u/%u bytes used at peak",
+            m_Tasks[i].name, m_Tasks[i].stack_size - m_Tasks[i].stack_free_min,
+            m_Tasks[i].stack_size);
+   }
+}
+
+heap_sample_t CMemoryProfiler::GetLatest() const
+{
+   heap_sample_t sample;
+   if (!GetHistory(0, sample))
+   {
+      memset(&sample, 0, sizeof(heap_sample_t));
+   }
+   return sample;
+}
+
+bool CMemoryProfiler::GetHistory(uint8_t age, heap_sample_t &sample) const
+{
+   if (age >= m_HistoryCount)
+   {
+      return false;
+   }
+   uint8_t index = (m_HistoryHead + MEMORY_PROFILER_HISTORY_LENGTH - 1 - age) % MEMORY_PROFILER_HISTORY_LENGTH;
+   sample = m_History[index];
+   return true;
+}
+
+uint8_t CMemoryProfiler::GetHistoryCount() const
+{
+   return m_HistoryCount;
+}
+
+bool CMemoryProfiler::GetTask(uint8_t index, task_stack_info_t &info) const
+{
+   if (index >= m_TaskCount)
+   {
+      return false;
+   }
+   info = m_Tasks[index];
+   return true;
+}
+
+uint8_t CMemoryProfiler::GetTaskCount() const
+{
+   return m_TaskCount;
+}
@@ -15,6 +15,9 @@
 #include <Arduino.h>
 #include <WebServer.h>
 #include "SensorData.h"
+#include "JoystickData.h"
+#include "WebSocketHub.h"
+#include "WebAssets.h"
 #include <AccessPointHelper.h>
 
 #define ACCELERATION_X "acc_x"
@@ -29,13 +32,14 @@ class CEmbeddedWebServer : public WebServer {
       /**
        * @brief Construct a new CEmbeddedWebServer object
        * 
-       * @param port Web server port number 80.
+       * @param port Web server port number, 80 for the dashboard.
        * @param SSID SSID for the wifi Access point
        * @param password password fpr the wifi access point
        */
       CEmbeddedWebServer(int port, String SSID, String password);
       /**
-       * @brief Set up and bring up Access Point Network.
+       * @brief Set up and bring up Access Point Network, blocking until it
+       *        is up. Not needed when another server already brought it up.
        * 
        */
       void SetupNetwork();
@@ -45,16 +49,42 @@ class CEmbeddedWebServer : public WebServer {
        */
       void SetUpWebHandlers();
       /**
-       * @brief A member routine for handling requests.
+       * @brief A member routine for handling requests. Serves pending HTTP
+       *        requests and services open WebSocket sessions without blocking.
        * 
        */
       void handleRequest();
       /**
-       * @brief Updates the member variable instance of IMU Sensor data.
+       * @brief Publishes a new IMU sample to the snapshot cache served to clients.
        * 
-       * @param imu_data An instance of IMU Sensor data.
+       * @param imu_sample An IMU sample with its sequence number and timestamp.
        */
-      void updateImuData(imu_data_t imu_data);
+      void updateImuData(const imu_sample_t &imu_sample);
+      /**
+       * @brief Get the latest joystick data received over WebSocket sessions.
+       * 
+       * @return joystick_data_t Latest joystick control data.
+       */
+      joystick_data_t getJoystickData();
+      /**
+       * @brief Get and reset the WebSocket IMU push counters.
+       * 
+       * @return ws_stats_t Counters since the last call.
+       */
+      ws_stats_t takeWebSocketStats();
+      /**
+       * @brief Push due IMU frames to WebSocket sessions after a new sample
+       *        was published.
+       * 
+       */
+      void pushImuFrames();
+      /**
+       * @brief Set the sensor tick period WebSocket subscriptions are
+       *        clamped to.
+       * 
+       * @param periodUs Tick period in microseconds.
+       */
+      void setSensorPeriodUs(uint32_t periodUs);
    private:
       /**
        * @brief A private member function to setup handle response for requests
@@ -63,10 +93,18 @@ class CEmbeddedWebServer : public WebServer {
        */
       void handleNotFound();
       /**
-       * @brief A private member function to handle root of web server.
+       * @brief A private member function to handle root of web server,
+       *        serving the dashboard page.
        * 
        */
       void handleRoot();
+      /**
+       * @brief Web Handle serving an embedded asset straight from flash,
+       *        gzip-encoded, or 304 when the client's copy is current.
+       * 
+       * @param asset Embedded asset to serve.
+       */
+      void handleAsset(const web_asset_t &asset);
       /**
        * @brief A private member function for the web handler to turn LED ON.
        * 
@@ -92,10 +130,26 @@ class CEmbeddedWebServer : public WebServer {
        * 
        */
       void getIMUDataOnRequest();
+      /**
+       * @brief Web Handle to get the packed binary IMU sample.
+       * 
+       */
+      void getIMUDataBinary();
+      /**
+       * @brief Web Handle to get the IMU sample as raw counts and full-scale codes.
+       * 
+       */
+      void getIMUDataRaw();
+      /**
+       * @brief Web Handle answering the WebSocket handshake on /ws and handing
+       *        the connection over to the session manager.
+       * 
+       */
+      void handleWebSocketUpgrade();
       // Access Point Information.
       CAccessPointHelper m_AccessPoint;
-      // Local instance data of IMU Sensor ouput.
-      imu_data_t m_ImuData;
+      // Open WebSocket sessions.
+      CWebSocketHub m_WebSockets;
 };
 
 #endif // !EMBEDDED_SERVER_H
@@ -12,6 +12,8 @@
 #ifndef JOYSTICK_DATA_H
 #define JOYSTICK_DATA_H
 
+#include <stdint.h>
+
 typedef struct {
    // Left joystick analog values (0-4095 for 12-bit ADC)
    int left_x;      // Left joystick X axis
@@ -27,6 +29,11 @@ typedef struct {
    
    // Metadata
    unsigned long timestamp; // Timestamp when data was captured
+
+   // Command timeline on the esp_timer clock, in microseconds
+   int64_t sent_us;         // Client send time, 0 unless the client clock is synchronized
+   int64_t received_us;     // Arrival of the command at the server
+   int64_t applied_us;      // Publication to the control loop
 } joystick_data_t;
 
 #endif // !JOYSTICK_DATA_H
\ No newline at end of file
@@ -12,6 +12,8 @@
 #ifndef SENSOR_DATA_H
 #define SENSOR_DATA_H
 
+#include <stdint.h>
+
 typedef struct {
    float accX;
    float accY;
@@ -22,4 +24,111 @@ typedef struct {
    float temperature;
 } imu_data_t;
 
+/**
+ * Raw IMU output counts with the full-scale settings they were read at.
+ * Half the size of imu_data_t; converted to units only when encoded.
+ */
+typedef struct {
+   int16_t acc[3];         // Accelerometer counts, x y z
+   int16_t gyro[3];        // Gyroscope counts, x y z
+   int16_t temperature;    // Temperature counts, 256 per degree C from 25 C
+   uint8_t accel_fs;       // Accelerometer full scale is ±(2 << accel_fs) g
+   uint8_t gyro_fs;        // Gyroscope full scale is ±(125 << gyro_fs) dps
+} imu_raw_t;
+
+typedef struct {
+   uint32_t sequence;   // Incremented for every sample read from the sensor
+   uint32_t timestamp;  // millis() when the sample was read
+   imu_raw_t raw;
+} imu_sample_t;
+
+/**
+ * @brief Channels of a sample, in sample order.
+ */
+typedef enum {
+   IMU_CHANNEL_ACC_X,
+   IMU_CHANNEL_ACC_Y,
+   IMU_CHANNEL_ACC_Z,
+   IMU_CHANNEL_GYRO_X,
+   IMU_CHANNEL_GYRO_Y,
+   IMU_CHANNEL_GYRO_Z,
+   IMU_CHANNEL_TEMPERATURE,
+   IMU_CHANNEL_COUNT
+} imu_channel_t;
+
+/**
+ * LSM6DSOX sensitivities at the smallest full scale, doubling with each
+ * step: 0.061 mg and 4.375 mdps per count. Temperature is 256 counts per
+ * degree C with 0 at 25 C.
+ */
+#define IMU_ACCEL_LSB_MS2      (0.061f * 9.80665f / 1000.0f)
+#define IMU_GYRO_LSB_RADS      (4.375f * 0.0174532925f / 1000.0f)
+#define IMU_TEMPERATURE_LSB_C  (1.0f / 256.0f)
+#define IMU_TEMPERATURE_ZERO_C 25.0f
+
+/**
+ * Full-scale code of an accelerometer range (2, 4, 8 or 16 g).
+ */
+static inline uint8_t ImuAccelFsCode(uint8_t rangeG)
+{
+   return (rangeG >= 16) ? 3 : (rangeG >= 8) ? 2 : (rangeG >= 4) ? 1 : 0;
+}
+
+/**
+ * Full-scale code of a gyroscope range (125, 250, 500, 1000 or 2000 dps).
+ */
+static inline uint8_t ImuGyroFsCode(uint16_t rangeDps)
+{
+   return (rangeDps >= 2000) ? 4 : (rangeDps >= 1000) ? 3 : (rangeDps >= 500) ? 2 : (rangeDps >= 250) ? 1 : 0;
+}
+
+/**
+ * Convert raw counts to m/s^2, rad/s and degrees C.
+ */
+static inline imu_data_t ImuRawToData(const imu_raw_t &raw)
+{
+   float accScale = IMU_ACCEL_LSB_MS2 * (1 << raw.accel_fs);
+   float gyroScale = IMU_GYRO_LSB_RADS * (1 << raw.gyro_fs);
+   imu_data_t data;
+   data.accX = raw.acc[0] * accScale;
+   data.accY = raw.acc[1] * accScale;
+   data.accZ = raw.acc[2] * accScale;
+   data.gyroX = raw.gyro[0] * gyroScale;
+   data.gyroY = raw.gyro[1] * gyroScale;
+   data.gyroZ = raw.gyro[2] * gyroScale;
+   data.temperature = raw.temperature * IMU_TEMPERATURE_LSB_C + IMU_TEMPERATURE_ZERO_C;
+   return data;
+}
+
+/**
+ * Quantize values in units to the counts the sensor would report at the
+ * given full scales, saturating at the range limits.
+ */
+static inline imu_raw_t ImuDataToRaw(const imu_data_t &data, uint8_t accelFs, uint8_t gyroFs)
+{
+   float accScale = IMU_ACCEL_LSB_MS2 * (1 << accelFs);
+   float gyroScale = IMU_GYRO_LSB_RADS * (1 << gyroFs);
+   const float values[7] = {
+      data.accX / accScale, data.accY / accScale, data.accZ / accScale,
+      data.gyroX / gyroScale, data.gyroY / gyroScale, data.gyroZ / gyroScale,
+      (data.temperature - IMU_TEMPERATURE_ZERO_C) / IMU_TEMPERATURE_LSB_C,
+   };
+   int16_t counts[7];
+   for (int i = 0; i < 7; i++)
+   {
+      float rounded = values[i] + ((values[i] < 0.0f) ? -0.5f : 0.5f);
+      counts[i] = (rounded >= 32767.0f) ? 32767 : (rounded <= -32768.0f) ? -32768 : (int16_t)rounded;
+   }
+   imu_raw_t raw;
+   for (int axis = 0; axis < 3; axis++)
+   {
+      raw.acc[axis] = counts[axis];
+      raw.gyro[axis] = counts[3 + axis];
+   }
+   raw.temperature = counts[6];
+   raw.accel_fs = accelFs;
+   raw.gyro_fs = gyroFs;
+   return raw;
+}
+
 #endif // !SENSOR_DATA_H
@@ -0,0 +1,43 @@
+/**
+ * @file WebAssets.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Dashboard assets embedded in flash, gzipped at build time.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Path the dashboard page is served at, besides the root.
+ */
+#define WEB_ASSET_INDEX "/index.html"
+
+/**
+ * @brief One embedded file. The data is const, so it stays in memory-mapped
+ *        flash and is written to the socket from there.
+ */
+typedef struct {
+   const char *path;          // Request path, e.g. "/app.js"
+   const char *content_type;  // MIME type of the uncompressed file
+   const char *cache_control; // Cache-Control header value
+   const char *etag;          // Quoted hash of the compressed data
+   const uint8_t *data;       // Gzip stream
+   size_t length;             // Bytes of gzip stream
+   size_t original_length;    // Bytes before compression
+} web_asset_t;
+
+/**
+ * @brief The assets from web/, generated by scripts/embed_web_assets.py.
+ */
+extern const web_asset_t WEB_ASSETS[];
+extern const size_t WEB_ASSET_COUNT;
+
+#endif // !WEB_ASSETS_H
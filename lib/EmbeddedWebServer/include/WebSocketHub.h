@@ -0,0 +1,218 @@
+/**
+ * @file WebSocketHub.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief A minimal RFC 6455 WebSocket session manager pushing IMU frames to
+ *        browser dashboards and receiving joystick frames from them.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+#ifndef WEB_SOCKET_HUB_H
+#define WEB_SOCKET_HUB_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include "JoystickData.h"
+#include <LatestValue.h>
+#include <StreamPacer.h>
+
+/**
+ * @brief Maximum number of concurrent WebSocket sessions.
+ */
+#define WS_MAX_SESSIONS 4
+
+/**
+ * @brief Largest client message accepted, in bytes. Larger messages close
+ *        the session with status 1009.
+ */
+#define WS_MAX_MESSAGE_SIZE 256
+
+/**
+ * @brief Length of the Sec-WebSocket-Accept value including the terminator.
+ */
+#define WS_ACCEPT_KEY_SIZE 29
+
+/**
+ * @brief Fastest subscription rate accepted, in Hz. Faster requests are
+ *        clamped to it and then to the sensor rate.
+ */
+#define WS_MAX_RATE_HZ 1000
+
+/**
+ * @brief Size of a binary joystick message: four little-endian int16 axes
+ *        followed by one byte of button bits (bit 0 left, bit 1 right).
+ */
+#define WS_JOYSTICK_BINARY_SIZE 9
+
+/**
+ * @brief WebSocket opcodes used by the hub.
+ */
+#define WS_OPCODE_TEXT   0x1
+#define WS_OPCODE_BINARY 0x2
+#define WS_OPCODE_CLOSE  0x8
+#define WS_OPCODE_PING   0x9
+#define WS_OPCODE_PONG   0xA
+
+/**
+ * @brief IMU push counters of all sessions.
+ */
+typedef struct {
+   uint32_t frames_sent;        // IMU frames written to sessions
+   uint32_t frames_skipped;     // IMU frames dropped because the socket had no room
+   uint8_t sessions;            // Sessions currently open
+} ws_stats_t;
+
+/**
+ * @brief Manages upgraded WebSocket connections. Each session subscribes to
+ *        IMU frames with a text message such as
+ *        {"type":"subscribe","rate":50,"format":"binary"} (rate 0 pushes every
+ *        new sample; "raw" pushes the sample as stored, in counts) and may send joystick updates either as JSON text
+ *        {"type":"joystick","left_x":...} or as compact binary messages.
+ *        Paced subscriptions use CStreamPacer deadlines in microseconds,
+ *        no faster than the sensor tick.
+ */
+class CWebSocketHub
+{
+public:
+   /**
+    * @brief Construct a new CWebSocketHub object
+    *
+    */
+   CWebSocketHub();
+   /**
+    * @brief Compute the Sec-WebSocket-Accept value for a handshake.
+    *
+    * @param clientKey Sec-WebSocket-Key sent by the client.
+    * @param out Receives the accept value, at least WS_ACCEPT_KEY_SIZE bytes.
+    * @param outSize Size of the output buffer.
+    * @return true on success.
+    */
+   static bool ComputeAcceptKey(const String &clientKey, char *out, size_t outSize);
+   /**
+    * @brief Take over a client whose handshake has been answered.
+    *
+    * @param client Upgraded client connection.
+    * @return true if a session slot was free.
+    */
+   bool Accept(WiFiClient &client);
+   /**
+    * @brief Read incoming messages and push due IMU frames without blocking.
+    *
+    */
+   void Poll();
+   /**
+    * @brief Push due IMU frames without reading; called when a new sample
+    *        is published so frames follow the sensor rather than the poll.
+    *
+    */
+   void PushFrames();
+   /**
+    * @brief Set the sensor tick period. Subscriptions faster than the
+    *        sensor are clamped to it, since they could only repeat samples.
+    *
+    * @param periodUs Tick period in microseconds, 0 if unknown.
+    */
+   void SetSensorPeriodUs(uint32_t periodUs);
+   /**
+    * @brief Get the latest joystick data received over any session.
+    *
+    * @return joystick_data_t Latest joystick control data.
+    */
+   joystick_data_t GetJoystickData();
+   /**
+    * @brief Number of open sessions.
+    *
+    * @return uint8_t Session count.
+    */
+   uint8_t GetSessionCount() const;
+   /**
+    * @brief Get and reset the IMU push counters.
+    *
+    * @return ws_stats_t Counters since the last call.
+    */
+   ws_stats_t TakeStats();
+
+private:
+   /**
+    * @brief State kept for each WebSocket connection.
+    */
+   typedef struct {
+      WiFiClient client;
+      bool active;
+      bool subscribed;
+      bool binary;                 // Push packed binary samples instead of JSON
+      bool raw;                    // Push raw counts instead of converted values
+      bool paced;                  // false pushes every new sample
+      uint32_t requested_period_us;// Period asked for by the subscription
+      CStreamPacer pacer;
+      uint32_t last_sequence;      // Sequence of the last sample pushed
+      uint8_t rx[WS_MAX_MESSAGE_SIZE + 14];
+      size_t rx_length;
+   } session_t;
+
+   /**
+    * @brief Parse and dispatch complete frames buffered for a session.
+    *
+    * @param session Session to service.
+    */
+   void ReadFrames(session_t &session);
+   /**
+    * @brief Handle a complete, unmasked message.
+    *
+    * @param session Session the message arrived on.
+    * @param opcode Frame opcode.
+    * @param payload Message payload.
+    * @param length Payload length.
+    */
+   void HandleMessage(session_t &session, uint8_t opcode, uint8_t *payload, size_t length);
+   /**
+    * @brief Handle a JSON text message.
+    *
+    * @param session Session the message arrived on.
+    * @param payload Message payload.
+    * @param length Payload length.
+    */
+   void HandleTextMessage(session_t &session, const char *payload, size_t length);
+   /**
+    * @brief Push the latest sample to a subscribed session if it is due.
+    *
+    * @param session Session to push to.
+    * @param nowUs Current esp_timer time.
+    */
+   void PushImu(session_t &session, int64_t nowUs);
+   /**
+    * @brief Frame period of a paced session: the requested period, no
+    *        shorter than the sensor tick.
+    *
+    * @param session Paced session.
+    * @return uint32_t Period in microseconds.
+    */
+   uint32_t GetPeriodUs(const session_t &session) const;
+   /**
+    * @brief Send an unfragmented server frame.
+    *
+    * @param session Destination session.
+    * @param opcode Frame opcode.
+    * @param data Payload.
+    * @param length Payload length.
+    * @return true if the frame was written.
+    */
+   bool SendFrame(session_t &session, uint8_t opcode, const uint8_t *data, size_t length);
+   /**
+    * @brief Send a close frame and release the session.
+    *
+    * @param session Session to close.
+    * @param code WebSocket status code.
+    */
+   void Close(session_t &session, uint16_t code);
+
+   session_t m_Sessions[WS_MAX_SESSIONS];
+   CLatestValue<joystick_data_t> m_JoystickData;
+   uint32_t m_SensorPeriodUs;     // 0 until the sensor rate is known
+   uint32_t m_FramesSent;
+   uint32_t m_FramesSkipped;
+};
+
+#endif // !WEB_SOCKET_HUB_H
@@ -10,10 +10,10 @@
  */
 #include "EmbeddedWebServer.h"
 #include <ArduinoJson.h>
+#include <ImuSnapshotCache.h>
 
-CEmbeddedWebServer::CEmbeddedWebServer(int port, String SSID, String password) : WebServer(80), m_AccessPoint(SSID, password)
+CEmbeddedWebServer::CEmbeddedWebServer(int port, String SSID, String password) : WebServer(port), m_AccessPoint(SSID, password)
 {
-   memset(&m_ImuData, 0, sizeof(imu_data_t));
 }
 
 void CEmbeddedWebServer::SetupNetwork()
@@ -48,13 +48,61 @@ void CEmbeddedWebServer::SetUpWebHandlers()
    // Setup web handle for getting JSON version of IMU Data.
    on("/specific-imu-data", [this]()
       { this->getIMUDataOnRequest(); });
+   // Setup web handle for getting the packed binary version of IMU Data.
+   on("/imu-data-binary", [this]()
+      { this->getIMUDataBinary(); });
+   // Setup web handle for getting the raw counts of IMU Data.
+   on("/imu-data-raw", [this]()
+      { this->getIMUDataRaw(); });
+   // Setup web handle for upgrading to a WebSocket session.
+   on("/ws", HTTP_GET, [this]()
+      { this->handleWebSocketUpgrade(); });
+   // Setup web handles for the embedded dashboard files.
+   for (size_t i = 0; i < WEB_ASSET_COUNT; i++)
+   {
+      const web_asset_t *asset = &WEB_ASSETS[i];
+      on(asset->path, HTTP_GET, [this, asset]()
+         { this->handleAsset(*asset); });
+   }
+   // Keep the request headers needed by the WebSocket handshake and by the
+   // conditional asset responses.
+   static const char *collectedHeaders[] = {"Upgrade", "Sec-WebSocket-Key", "Sec-WebSocket-Version",
+                                            "If-None-Match"};
+   collectHeaders(collectedHeaders, sizeof(collectedHeaders) / sizeof(collectedHeaders[0]));
    begin();
 }
 
-void CEmbeddedWebServer::updateImuData(imu_data_t imuData)
+void CEmbeddedWebServer::handleRequest()
+{
+   // Serve pending HTTP requests, then service open WebSocket sessions.
+   handleClient();
+   m_WebSockets.Poll();
+}
+
+joystick_data_t CEmbeddedWebServer::getJoystickData()
+{
+   return m_WebSockets.GetJoystickData();
+}
+
+ws_stats_t CEmbeddedWebServer::takeWebSocketStats()
 {
-   // Make a local copy from the provided data.
-   memcpy(&m_ImuData, &imuData, sizeof(imu_data_t));
+   return m_WebSockets.TakeStats();
+}
+
+void CEmbeddedWebServer::pushImuFrames()
+{
+   m_WebSockets.PushFrames();
+}
+
+void CEmbeddedWebServer::setSensorPeriodUs(uint32_t periodUs)
+{
+   m_WebSockets.SetSensorPeriodUs(periodUs);
+}
+
+void CEmbeddedWebServer::updateImuData(const imu_sample_t &imuSample)
+{
+   // Publish to the snapshot cache shared by all endpoints.
+   CImuSnapshotCache::Instance()->Publish(imuSample);
 }
 
 void CEmbeddedWebServer::handleNotFound()
@@ -65,8 +113,33 @@ void CEmbeddedWebServer::handleNotFound()
 
 void CEmbeddedWebServer::handleRoot()
 {
-   // Return HTTP 200 Error
-   send(200, "text/plain", "hello from esp32!");
+   for (size_t i = 0; i < WEB_ASSET_COUNT; i++)
+   {
+      if (strcmp(WEB_ASSETS[i].path, WEB_ASSET_INDEX) == 0)
+      {
+         handleAsset(WEB_ASSETS[i]);
+         return;
+      }
+   }
+   send(404, "text/plain", "File Not Found");
+}
+
+void CEmbeddedWebServer::handleAsset(const web_asset_t &asset)
+{
+   // Validators go on the 304 as well, so the client keeps its cache entry.
+   sendHeader("ETag", asset.etag);
+   sendHeader("Cache-Control", asset.cache_control);
+   if (header("If-None-Match").indexOf(asset.etag) >= 0)
+   {
+      send(304);
+      return;
+   }
+   // Only the gzip stream is stored. It is sent to every client, whatever
+   // its Accept-Encoding says, so the dashboard always loads; every browser
+   // decodes it.
+   sendHeader("Content-Encoding", "gzip");
+   // The data is const and memory-mapped, so it is written from flash.
+   send_P(200, asset.content_type, (PGM_P)asset.data, asset.length);
 }
 
 void CEmbeddedWebServer::turnBuildInLEDOff()
@@ -85,81 +158,72 @@ void CEmbeddedWebServer::turnBuildInLEDOn()
 
 void CEmbeddedWebServer::getIMUData()
 {
-   // Set JSON object
-   JsonDocument doc;
-   JsonObject root = doc.to<JsonObject>();
-   // Create a JSON Dictionary
-   root["accX"] = m_ImuData.accX;
-   root["accY"] = m_ImuData.accY;
-   root["accZ"] = m_ImuData.accZ;
-   root["gyroX"] = m_ImuData.gyroX;
-   root["gyroY"] = m_ImuData.gyroY;
-   root["gyroZ"] = m_ImuData.gyroZ;
-   root["temperature"] = m_ImuData.temperature;
-   // Serialize to String
-   String imuDataString;
-   serializeJson(doc, imuDataString);
-   log_d("Serialized Data: %s", imuDataString.c_str());
+   // Serialized at most once per sample, shared with every other poller.
+   char imuDataString[IMU_SNAPSHOT_MAX_JSON];
+   size_t length = CImuSnapshotCache::Instance()->CopyJson(IMU_JSON_WEB, IMU_PROJECTION_ALL, imuDataString, sizeof(imuDataString));
+   log_d("Serialized Data: %s", imuDataString);
    // Send back response.
-   send(200, "application/json", imuDataString.c_str());
+   send_P(200, "application/json", imuDataString, length);
 }
 
 void CEmbeddedWebServer::getIMUDataOnRequest()
 {
-   // Set JSON object
-   JsonDocument doc;
-   JsonObject root = doc.to<JsonObject>();
    String parameter = this->arg("parameter");
+   imu_projection_t projection = CImuSnapshotCache::ParseProjection(parameter);
 
-   if (parameter.length() >0)
+   if ((parameter.length() == 0) || (projection == IMU_PROJECTION_INVALID))
    {
-      Serial.print("Received GET request with parameters: ");
-      JsonDocument doc;
-      JsonObject root = doc.to<JsonObject>();
-      if (parameter.compareTo(String("acc")) == 0) {
-         root["accX"] = m_ImuData.accX;
-         root["accY"] = m_ImuData.accY;
-         root["accZ"] = m_ImuData.accZ;
-      }
-      else if (parameter.compareTo(String("gyro")) == 0) {
-         root["gyroX"] = m_ImuData.gyroX;
-         root["gyroY"] = m_ImuData.gyroY;
-         root["gyroZ"] = m_ImuData.gyroY;
-      }
-      else if (parameter.compareTo(String("accx")) == 0) {
-         root["accX"] = m_ImuData.accX;
-      }
-      else if (parameter.compareTo(String("accy")) == 0) {
-         root["accY"] = m_ImuData.accY;
-      }
-      else if (parameter.compareTo(String("accz")) == 0) {
-         root["accZ"] = m_ImuData.accZ;
-      }
-      else if (parameter.compareTo(String("gyrox")) == 0) {
-         root["gyroX"] = m_ImuData.gyroX;
-      }
-      else if (parameter.compareTo(String("gyroy")) == 0) {
-         root["gyroY"] = m_ImuData.gyroY;
-      }
-      else if (parameter.compareTo(String("gyroz")) == 0) {
-         root["gyroZ"] = m_ImuData.gyroZ;
-      }
-      else if (parameter.compareTo(String("temperature")) == 0) {
-         root["temperature"] = m_ImuData.temperature;
-      }
-      else {
-         send(400, "text/plain", "Bad Request");
-         log_e("Incoming request is unsupported.");
-         return;
-      }
-      // Serialize to String
-      String imuDataString;
-      serializeJson(doc, imuDataString);
-      send(200, "text/plain", imuDataString);
+      log_e("Incoming request is unsupported.");
+      send(400, "text/plain", "Bad Request");
+      return;
    }
-   else
+
+   char imuDataString[IMU_SNAPSHOT_MAX_JSON];
+   size_t length = CImuSnapshotCache::Instance()->CopyJson(IMU_JSON_WEB, projection, imuDataString, sizeof(imuDataString));
+   send_P(200, "text/plain", imuDataString, length);
+}
+
+void CEmbeddedWebServer::getIMUDataBinary()
+{
+   uint8_t imuData[IMU_SNAPSHOT_BINARY_SIZE];
+   size_t length = CImuSnapshotCache::Instance()->CopyBinary(imuData);
+   send_P(200, "application/octet-stream", (const char *)imuData, length);
+}
+
+void CEmbeddedWebServer::getIMUDataRaw()
+{
+   uint8_t imuData[IMU_SNAPSHOT_RAW_SIZE];
+   size_t length = CImuSnapshotCache::Instance()->CopyRaw(imuData);
+   send_P(200, "application/octet-stream", (const char *)imuData, length);
+}
+
+void CEmbeddedWebServer::handleWebSocketUpgrade()
+{
+   if (!header("Upgrade").equalsIgnoreCase("websocket") || header("Sec-WebSocket-Version") != "13")
    {
-      log_e("Incoming request is unsupported.");
       send(400, "text/plain", "Bad Request");
+      log_e("Invalid WebSocket upgrade request.");
+      return;
+   }
+
+   char acceptKey[WS_ACCEPT_KEY_SIZE];
+   if (!CWebSocketHub::ComputeAcceptKey(header("Sec-WebSocket-Key"), acceptKey, sizeof(acceptKey)))
+   {
+      send(500, "text/plain", "Handshake Failed");
+      return;
    }
+   if (m_WebSockets.GetSessionCount() >= WS_MAX_SESSIONS)
+   {
+      send(503, "text/plain", "Too Many Sessions");
+      return;
+   }
+
+   // The 101 response is written directly; WebServer has no notion of upgrades.
+   WiFiClient &upgradedClient = client();
+   upgradedClient.printf("HTTP/1.1 101 Switching Protocols\r\n"
+                         "Upgrade: websocket\r\n"
+                         "Connection: Upgrade\r\n"
+                         "Sec-WebSocket-Accept: %s\r\n\r\n",
+                         acceptKey);
+   m_WebSockets.Accept(upgradedClient);
 }
@@ -0,0 +1,180 @@
+/**
+ * @file WebAssets.cpp
+ * @brief Gzipped dashboard assets. Generated from web/ by
+ *        scripts/embed_web_assets.py; do not edit.
+ */
+
+#include "WebAssets.h"
+
+// app.js: 3361 bytes, 1284 gzipped
+static const uint8_t ASSET_0[] = {
+   0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0x6d, 0x6f, 0xdb, 0x36,
+   0x10, 0xfe, 0xde, 0x5f, 0x41, 0xa0, 0x40, 0x49, 0x2d, 0xaa, 0xec, 0x39, 0x35, 0x86, 0xc5, 0xeb,
+   0x80, 0xac, 0x4d, 0xb0, 0x0c, 0x41, 0x12, 0xc4, 0x01, 0x86, 0xc1, 0x30, 0x06, 0x5a, 0x3a, 0x5b,
+   0x5c, 0x64, 0xd1, 0x25, 0x29, 0xdb, 0x5a, 0xe0, 0xff, 0xbe, 0x23, 0xa9, 0x37, 0xbf, 0x34, 0x6b,
+   0x01, 0x03, 0x16, 0xc9, 0xe7, 0x8e, 0x77, 0xcf, 0xbd, 0x91, 0xcd, 0x8b, 0x3c, 0x36, 0x42, 0xe6,
+   0x84, 0x05, 0xe4, 0xe5, 0x0d, 0x21, 0xb4, 0xd0, 0x40, 0xb4, 0x51, 0x22, 0x36, 0x74, 0xf4, 0x06,
+   0x37, 0xd6, 0x5c, 0x91, 0xeb, 0x9b, 0xab, 0xdb, 0xcf, 0x63, 0xf2, 0x91, 0x4c, 0x28, 0x8f, 0xe3,
+   0xbf, 0xb7, 0x34, 0x24, 0xee, 0xa3, 0xac, 0x3f, 0xfe, 0xb5, 0x1f, 0x8b, 0x52, 0x49, 0x7f, 0xe6,
+   0xbe, 0xca, 0xe6, 0xcb, 0x9d, 0x1a, 0x58, 0xae, 0x40, 0x71, 0x53, 0x28, 0xa0, 0xd3, 0x51, 0xa5,
+   0xf8, 0xd3, 0xfd, 0xed, 0xfd, 0xa3, 0x57, 0xfc, 0x16, 0x86, 0xc3, 0xf3, 0x0f, 0x33, 0x0b, 0x7d,
+   0x3b, 0xfc, 0x89, 0xcf, 0x86, 0xdc, 0x7f, 0x9e, 0xff, 0x3c, 0x9b, 0x0f, 0x5b, 0x89, 0xdf, 0x6f,
+   0xc6, 0x4f, 0xf7, 0x8f, 0x7f, 0xa1, 0xc8, 0xe0, 0x43, 0xbf, 0x31, 0x50, 0x1b, 0x54, 0xac, 0x71,
+   0x33, 0x91, 0x71, 0xb1, 0x84, 0xdc, 0x44, 0x0b, 0x30, 0x57, 0x19, 0xd8, 0xcf, 0xdf, 0xca, 0x9b,
+   0x84, 0x51, 0x8f, 0xa0, 0x41, 0xad, 0x07, 0x2d, 0x81, 0xd7, 0xf0, 0xf6, 0xbc, 0x45, 0xcf, 0x57,
+   0xaf, 0x2a, 0xc7, 0xe3, 0x16, 0x1b, 0x43, 0x96, 0x59, 0xf4, 0xcb, 0xce, 0xee, 0x78, 0xea, 0xa2,
+   0xb9, 0x54, 0x57, 0x3c, 0x4e, 0x59, 0x4b, 0x77, 0xce, 0x97, 0x80, 0x94, 0x7b, 0xf8, 0xc4, 0xae,
+   0xa6, 0xaf, 0x5c, 0xe1, 0xd0, 0x23, 0xb2, 0x0b, 0x9c, 0xcb, 0x8d, 0x96, 0x87, 0x4c, 0x1a, 0x26,
+   0x92, 0x90, 0x3c, 0x43, 0xa9, 0x43, 0x74, 0x2a, 0x5f, 0x80, 0x8f, 0x23, 0x21, 0x26, 0x15, 0x3a,
+   0x8a, 0x79, 0xbe, 0xe6, 0xaf, 0xd9, 0x2e, 0x12, 0x67, 0x78, 0x0d, 0x97, 0xb9, 0x81, 0xad, 0x41,
+   0x7c, 0x47, 0xda, 0x8a, 0x7c, 0xf2, 0x07, 0x8c, 0x0e, 0x12, 0xda, 0x15, 0xb0, 0xf7, 0x22, 0xda,
+   0xfe, 0x75, 0x76, 0x9d, 0x1d, 0xb8, 0xed, 0xfe, 0x3b, 0xfb, 0x1a, 0x94, 0x80, 0x1a, 0x1f, 0x2d,
+   0xf9, 0x8a, 0xed, 0xa5, 0x1f, 0x51, 0x80, 0xe9, 0x91, 0x93, 0xc9, 0xd4, 0x7b, 0x4a, 0xc8, 0xce,
+   0x7a, 0x6b, 0x9d, 0x8c, 0x56, 0x4a, 0x1a, 0x69, 0xca, 0x15, 0x44, 0xab, 0x42, 0xa7, 0xa8, 0xa2,
+   0x95, 0xd4, 0x7c, 0xb9, 0xca, 0x1a, 0xb7, 0x91, 0x69, 0xc2, 0x6c, 0x1c, 0x04, 0x82, 0xfa, 0x23,
+   0xfc, 0xfb, 0xa5, 0x35, 0x35, 0xca, 0x20, 0x5f, 0x98, 0x14, 0x77, 0xcf, 0xce, 0x6a, 0x81, 0x2a,
+   0x83, 0x6a, 0xd3, 0x3a, 0x86, 0x4e, 0xc4, 0x74, 0x54, 0x41, 0xfc, 0x86, 0xbb, 0xbb, 0xba, 0x6f,
+   0xd2, 0x28, 0x45, 0xd8, 0x34, 0xa8, 0x81, 0x62, 0x8e, 0x06, 0x79, 0xb0, 0xbf, 0x8b, 0xfc, 0x5a,
+   0xe7, 0x6c, 0x50, 0x6b, 0xd1, 0xa9, 0x98, 0x1b, 0x56, 0x89, 0xec, 0xac, 0x9b, 0xa3, 0x13, 0x7e,
+   0x26, 0x8a, 0x6f, 0xf6, 0xfc, 0xac, 0x0d, 0x76, 0x49, 0x66, 0xb6, 0x4d, 0x90, 0x7c, 0x68, 0x42,
+   0xb2, 0x39, 0x08, 0xdb, 0x46, 0x24, 0x26, 0x0d, 0x49, 0x7a, 0xb0, 0x9d, 0x82, 0x58, 0xa4, 0xc6,
+   0x5f, 0x8e, 0x6a, 0xa2, 0x38, 0x03, 0xae, 0x1e, 0x21, 0x36, 0xac, 0x1f, 0x12, 0xfc, 0x6d, 0x50,
+   0x24, 0x68, 0x8f, 0xb1, 0x17, 0xc8, 0x67, 0x18, 0x9b, 0x32, 0xb3, 0x11, 0xa5, 0x6f, 0x07, 0xfc,
+   0x7c, 0x70, 0x3e, 0xa3, 0x2d, 0x60, 0x06, 0x0b, 0x91, 0x3f, 0x70, 0x93, 0xb2, 0x8e, 0xd4, 0x52,
+   0xae, 0xe1, 0x49, 0x5a, 0x8d, 0x29, 0xe9, 0x91, 0x41, 0xe7, 0x24, 0x13, 0xb9, 0x3d, 0xd9, 0x1c,
+   0x9f, 0xf8, 0x9b, 0x6a, 0x2d, 0x5f, 0x8d, 0xe3, 0x1e, 0xbb, 0xdf, 0x1f, 0xc9, 0x63, 0x9f, 0x7c,
+   0x13, 0x3a, 0x80, 0x1c, 0x79, 0xd5, 0xb1, 0x68, 0xeb, 0x2d, 0xda, 0xa2, 0x45, 0x07, 0xc6, 0x6c,
+   0xbb, 0xc6, 0x78, 0x73, 0x4a, 0x04, 0x3b, 0x4f, 0xc9, 0xfb, 0x3a, 0x33, 0x26, 0xdb, 0x29, 0x6e,
+   0xb4, 0x95, 0x12, 0x90, 0x1f, 0x08, 0xeb, 0xb2, 0x51, 0x27, 0x12, 0x5e, 0xf4, 0x11, 0xaf, 0x0a,
+   0xba, 0x94, 0x6e, 0x11, 0xbc, 0x41, 0x6c, 0x95, 0x54, 0x21, 0x29, 0xb1, 0x2f, 0x40, 0x86, 0x5d,
+   0xbb, 0xc3, 0xee, 0x29, 0x50, 0xa5, 0x79, 0x77, 0xc4, 0xc3, 0x71, 0x26, 0x5a, 0xbb, 0x57, 0x98,
+   0x8d, 0x96, 0xc5, 0x89, 0x3b, 0xcb, 0x61, 0xe3, 0x9b, 0x8d, 0x6b, 0xf7, 0xf6, 0x0c, 0xbb, 0xf3,
+   0xd7, 0xa7, 0xc1, 0x34, 0x24, 0x83, 0x7e, 0x10, 0x1e, 0x88, 0xba, 0x61, 0xd0, 0xc8, 0xbe, 0x32,
+   0x2e, 0x50, 0x7c, 0x18, 0xa0, 0xf0, 0xb4, 0x6d, 0xf0, 0x32, 0x7e, 0x06, 0xdb, 0x97, 0xf2, 0x22,
+   0xcb, 0x9a, 0xae, 0xac, 0xb0, 0x2b, 0x6a, 0x17, 0x8c, 0x6a, 0x27, 0x11, 0xca, 0x58, 0xc2, 0xe7,
+   0x1c, 0x09, 0xd9, 0x6f, 0x95, 0xba, 0x98, 0xe9, 0x58, 0x89, 0x19, 0x34, 0x75, 0xe4, 0x4a, 0xd5,
+   0xeb, 0x7d, 0xf7, 0xae, 0xba, 0x21, 0x52, 0xc0, 0x93, 0x72, 0x6c, 0xdc, 0x74, 0x40, 0xee, 0xff,
+   0x84, 0xd9, 0xd8, 0x1f, 0xdc, 0x3f, 0x5c, 0xdd, 0xb5, 0xb1, 0xad, 0xd0, 0x1a, 0xf2, 0x84, 0xfd,
+   0x31, 0xbe, 0xbf, 0xb3, 0x54, 0x8a, 0x7c, 0x21, 0xe6, 0x25, 0x7b, 0x21, 0xb6, 0x7c, 0x2f, 0x08,
+   0x6d, 0x6e, 0xa4, 0xa1, 0x1b, 0x37, 0x17, 0xe4, 0xae, 0x58, 0xce, 0x40, 0x31, 0xbb, 0x88, 0xd6,
+   0x3c, 0x2b, 0x20, 0x08, 0x6d, 0x56, 0x2d, 0xb9, 0x41, 0xf8, 0x3f, 0x5a, 0xe6, 0x14, 0xfb, 0x5e,
+   0x37, 0x1a, 0x7b, 0x1e, 0x60, 0xa1, 0xe7, 0xb6, 0x4c, 0x6b, 0x2b, 0x5a, 0x4e, 0x90, 0xe1, 0xc6,
+   0x50, 0x46, 0x37, 0xfa, 0xa2, 0xd7, 0xa3, 0xe4, 0x8c, 0x64, 0x32, 0xe6, 0x56, 0x32, 0x4a, 0xa5,
+   0x36, 0xb8, 0xa6, 0xbd, 0x8d, 0xae, 0xbb, 0x77, 0xe5, 0x80, 0xcc, 0xe5, 0x0a, 0xf2, 0x93, 0x6d,
+   0x86, 0x54, 0x53, 0x35, 0xb2, 0xdd, 0xc5, 0xf5, 0xff, 0xdc, 0x5e, 0x46, 0x33, 0xb1, 0x06, 0x3a,
+   0xda, 0x87, 0xc4, 0x19, 0xd7, 0xfa, 0x0e, 0xa3, 0x61, 0x01, 0xd5, 0x30, 0xde, 0xc7, 0xb5, 0xec,
+   0x57, 0xee, 0x1d, 0x98, 0x81, 0x81, 0xd4, 0xdc, 0x0d, 0x8d, 0xd6, 0x92, 0x6a, 0xef, 0xa0, 0xbc,
+   0x5d, 0xf7, 0xad, 0xf5, 0x1a, 0x55, 0xe2, 0xdc, 0xf0, 0x7b, 0x28, 0xeb, 0x42, 0xb1, 0xe2, 0x4a,
+   0x43, 0x2d, 0x1c, 0x25, 0xdc, 0x70, 0x3b, 0x39, 0x09, 0x72, 0x11, 0xa7, 0x84, 0x41, 0x3b, 0x68,
+   0x46, 0x4d, 0x31, 0x9c, 0x6a, 0x36, 0xd5, 0xe4, 0x3e, 0xd9, 0x67, 0xbc, 0x29, 0x2e, 0x84, 0x28,
+   0x50, 0x0d, 0x04, 0x2f, 0x60, 0xa7, 0xc1, 0x7e, 0x15, 0xdb, 0x74, 0x90, 0xf3, 0x1a, 0x8d, 0x49,
+   0x45, 0x73, 0x97, 0x07, 0x34, 0xa8, 0x86, 0x7f, 0x2b, 0x78, 0xc0, 0xb5, 0x13, 0x89, 0x8c, 0xbc,
+   0x16, 0x5b, 0x48, 0xd8, 0xf9, 0x51, 0x0d, 0xbb, 0x1a, 0x3d, 0xf1, 0xb6, 0xb0, 0xfb, 0xd6, 0xcd,
+   0x95, 0x9b, 0x28, 0xed, 0xcc, 0x0a, 0xea, 0xb9, 0xea, 0x7c, 0x76, 0xd5, 0x73, 0x76, 0x56, 0xaf,
+   0xeb, 0xda, 0x31, 0xaa, 0x80, 0xd3, 0x31, 0x8a, 0x33, 0xa9, 0xe1, 0xbb, 0x72, 0x45, 0x41, 0x95,
+   0xb4, 0x58, 0x1b, 0xdf, 0x90, 0x33, 0x2d, 0x04, 0xcc, 0x93, 0x58, 0x82, 0x2c, 0x0c, 0xab, 0x14,
+   0xd8, 0x86, 0xd2, 0xef, 0x77, 0x93, 0xc7, 0x15, 0x47, 0xaf, 0x47, 0x3e, 0xdb, 0x39, 0xc9, 0x0d,
+   0x59, 0xda, 0x24, 0x47, 0x23, 0x81, 0xe0, 0x3b, 0x13, 0xbd, 0xd1, 0xab, 0x8c, 0x97, 0xde, 0x4b,
+   0x9c, 0x35, 0x72, 0x03, 0x6b, 0xdc, 0x9e, 0x73, 0x04, 0x79, 0x32, 0x34, 0xe1, 0x4a, 0x61, 0x8e,
+   0x46, 0xdd, 0x1a, 0x53, 0x58, 0xd0, 0x58, 0xa1, 0xdd, 0x16, 0xe1, 0x78, 0x69, 0x1d, 0xfd, 0x26,
+   0xce, 0xed, 0xec, 0x66, 0x7b, 0x6c, 0x1f, 0x74, 0xa6, 0x36, 0x8a, 0x0a, 0xbe, 0x14, 0xa0, 0xcd,
+   0x65, 0x2e, 0x96, 0xae, 0x58, 0xaf, 0xad, 0xc1, 0xcc, 0xdb, 0xd1, 0xbe, 0x81, 0x90, 0x90, 0x1b,
+   0x64, 0x55, 0x61, 0x46, 0xb0, 0x63, 0xfa, 0xf1, 0xfd, 0x79, 0xc0, 0xbc, 0x0f, 0x6e, 0x35, 0x49,
+   0xf7, 0xda, 0xe4, 0x2e, 0x24, 0x3f, 0x7a, 0x26, 0x71, 0xe1, 0x3a, 0x11, 0x4f, 0x92, 0xab, 0x35,
+   0x8a, 0xdd, 0x0a, 0x8d, 0xd2, 0xe8, 0x3d, 0x8d, 0x53, 0x3b, 0x96, 0xb0, 0x6d, 0x35, 0x65, 0xeb,
+   0x2c, 0xb9, 0x54, 0x8a, 0x97, 0x9d, 0x17, 0x4a, 0x45, 0x02, 0x3e, 0x2c, 0xb2, 0x8c, 0x35, 0x0f,
+   0x4c, 0x74, 0x47, 0x95, 0x63, 0xc8, 0x30, 0x68, 0x52, 0x5d, 0xe2, 0x09, 0x9d, 0xd8, 0x1a, 0x7c,
+   0x9f, 0x41, 0x32, 0xa5, 0xb6, 0xe1, 0x35, 0xe6, 0xcf, 0x0a, 0x63, 0x64, 0x5e, 0x3b, 0xe1, 0x57,
+   0xa7, 0xac, 0xc9, 0x44, 0xfc, 0x4c, 0xc3, 0xfd, 0xb4, 0x23, 0x73, 0xc0, 0x72, 0xae, 0x54, 0xd8,
+   0x17, 0xea, 0xa5, 0xc1, 0x0e, 0x8c, 0x4b, 0x60, 0xb4, 0xbe, 0x8e, 0x06, 0x4d, 0x08, 0xaa, 0x87,
+   0x73, 0xd3, 0x42, 0xed, 0xde, 0xff, 0x30, 0xbf, 0x0b, 0x2c, 0xec, 0x3f, 0xf4, 0xf6, 0x96, 0x1c,
+   0x21, 0x0d, 0x00, 0x00,
+};
+
+// index.html: 1532 bytes, 610 gzipped
+static const uint8_t ASSET_1[] = {
+   0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x54, 0x4d, 0x6f, 0xd4, 0x30,
+   0x10, 0xbd, 0xf7, 0x57, 0x98, 0x9c, 0xd9, 0x66, 0x13, 0xed, 0xa2, 0xac, 0xe4, 0x04, 0x21, 0x5a,
+   0xe0, 0x80, 0x04, 0x2a, 0x3d, 0x50, 0x2e, 0xc8, 0xb1, 0x27, 0x1b, 0x83, 0x63, 0x47, 0xb6, 0x37,
+   0x65, 0xfb, 0xb3, 0xf8, 0x09, 0xfd, 0x65, 0x8c, 0xe3, 0xa4, 0x1f, 0xb4, 0x55, 0x57, 0x42, 0x5c,
+   0x1c, 0x7b, 0xfc, 0xe6, 0x8d, 0xdf, 0xb3, 0x33, 0xf4, 0xc5, 0xc9, 0xa7, 0xb7, 0xe7, 0x17, 0x9f,
+   0x4f, 0x49, 0xeb, 0x3b, 0x55, 0x1d, 0xd1, 0xf0, 0x21, 0x8a, 0xe9, 0x6d, 0x99, 0x80, 0x4e, 0x42,
+   0x00, 0x98, 0xc0, 0x4f, 0x07, 0x9e, 0x11, 0xde, 0x32, 0xeb, 0xc0, 0x97, 0xc9, 0xce, 0x37, 0x8b,
+   0x22, 0x99, 0xc3, 0x9a, 0x75, 0x50, 0x26, 0x83, 0x84, 0xcb, 0xde, 0x58, 0x9f, 0x10, 0x6e, 0xb4,
+   0x07, 0x8d, 0xb0, 0x4b, 0x29, 0x7c, 0x5b, 0x0a, 0x18, 0x24, 0x87, 0xc5, 0xb8, 0x78, 0x49, 0xa4,
+   0x96, 0x5e, 0x32, 0xb5, 0x70, 0x9c, 0x29, 0x28, 0xb3, 0x40, 0xe2, 0xa5, 0x57, 0x50, 0x9d, 0x99,
+   0x01, 0x2c, 0x39, 0x61, 0xae, 0xad, 0x0d, 0xb3, 0x82, 0xa6, 0x31, 0x7c, 0x44, 0x95, 0xd4, 0x3f,
+   0x89, 0x05, 0x55, 0x26, 0xce, 0xef, 0x15, 0xb8, 0x16, 0x00, 0x8b, 0xb4, 0x16, 0x9a, 0x29, 0x72,
+   0xcc, 0x9d, 0x7b, 0x3d, 0x94, 0xcd, 0xe6, 0x55, 0xdd, 0xe4, 0x50, 0xac, 0x1a, 0xb6, 0x61, 0x79,
+   0xc6, 0x03, 0x75, 0x3a, 0x1d, 0xbf, 0x36, 0x62, 0x3f, 0x89, 0x01, 0x5b, 0x1d, 0x11, 0x42, 0xdb,
+   0x2c, 0x56, 0x44, 0x48, 0x36, 0x06, 0x5c, 0xcf, 0x34, 0x91, 0x22, 0x70, 0x32, 0xbf, 0x73, 0x28,
+   0x43, 0x31, 0xe7, 0x6e, 0x96, 0x15, 0xaa, 0xd2, 0xc0, 0xbd, 0xd4, 0x5b, 0x9a, 0x06, 0xec, 0xcc,
+   0x1e, 0xf8, 0x68, 0xc7, 0xa4, 0x8e, 0x2c, 0x01, 0x62, 0xf4, 0x9c, 0xcc, 0x51, 0x49, 0x12, 0x36,
+   0x42, 0xc5, 0xbc, 0x7a, 0xc3, 0x39, 0x28, 0xb0, 0x06, 0x6d, 0x43, 0xad, 0xd4, 0x75, 0x4c, 0xa9,
+   0xaa, 0x4b, 0xdd, 0xf5, 0x6f, 0xe4, 0x1c, 0x17, 0xc8, 0x99, 0x4f, 0x78, 0xa1, 0x66, 0x16, 0x8b,
+   0x65, 0xcc, 0xce, 0x4f, 0x44, 0x61, 0xcb, 0x57, 0x5f, 0x69, 0x8a, 0x23, 0x15, 0x62, 0x3c, 0x33,
+   0xe3, 0xfc, 0xfb, 0xaf, 0xa4, 0x5a, 0x60, 0x50, 0xdc, 0x45, 0x5d, 0x3c, 0x40, 0xed, 0x1f, 0x41,
+   0x7d, 0x7b, 0x80, 0xba, 0xba, 0x87, 0xc2, 0x99, 0x9a, 0x66, 0x9c, 0xe9, 0x81, 0xb9, 0x1b, 0x5c,
+   0xaf, 0x0c, 0xde, 0x45, 0xbc, 0xe7, 0x64, 0x55, 0x2c, 0xf1, 0x5e, 0x40, 0x6e, 0x5b, 0xbc, 0xfb,
+   0x2c, 0x5f, 0x26, 0xa8, 0x26, 0xe2, 0x47, 0x6b, 0xd2, 0xc9, 0x9b, 0x03, 0x7c, 0x7a, 0xbf, 0xb7,
+   0xc6, 0x71, 0xd3, 0xc3, 0xec, 0x91, 0x65, 0x22, 0x75, 0xff, 0xe8, 0xd1, 0x16, 0x49, 0x0f, 0x30,
+   0x69, 0x84, 0x3d, 0xef, 0xd2, 0x08, 0x3b, 0xc4, 0xa6, 0x11, 0xf8, 0x9f, 0x7c, 0xfa, 0x32, 0xbe,
+   0xcd, 0x83, 0xfd, 0x38, 0x87, 0xae, 0x07, 0x8b, 0x29, 0x16, 0xee, 0x69, 0xf1, 0xb7, 0xf1, 0x47,
+   0x74, 0xbf, 0xb3, 0xf8, 0x7f, 0xbb, 0x60, 0xff, 0x9d, 0x94, 0xa6, 0x77, 0x4f, 0x69, 0x57, 0xac,
+   0x06, 0x55, 0x9d, 0x31, 0x0f, 0x33, 0x89, 0xc3, 0x47, 0xcf, 0xfd, 0x98, 0x87, 0x55, 0xe0, 0xe6,
+   0x4c, 0xb8, 0x65, 0xfa, 0x51, 0xde, 0xc0, 0xd4, 0x0e, 0x7b, 0x48, 0x86, 0x5e, 0x64, 0x4b, 0xf2,
+   0xe1, 0x8a, 0xa6, 0x71, 0xe3, 0x49, 0x64, 0xbe, 0x4e, 0x48, 0xa4, 0x05, 0x51, 0xe5, 0xeb, 0x43,
+   0x52, 0xd6, 0x48, 0xbe, 0x7e, 0x8c, 0x3c, 0x38, 0x1e, 0x98, 0x66, 0x25, 0x51, 0xc0, 0x64, 0xa8,
+   0x1c, 0x66, 0x47, 0xeb, 0x9d, 0xf7, 0x46, 0xbb, 0x5b, 0x47, 0x63, 0x80, 0x08, 0xe6, 0xd9, 0x42,
+   0x01, 0x8a, 0x4b, 0x71, 0x5c, 0x18, 0x6c, 0x9b, 0x1f, 0x4f, 0x4f, 0x88, 0xd1, 0x34, 0x8d, 0x88,
+   0xe7, 0x12, 0x9a, 0x66, 0xca, 0x68, 0x9a, 0xfb, 0x29, 0x68, 0xaa, 0x1c, 0xfe, 0x7a, 0x13, 0x34,
+   0x8d, 0xbd, 0x86, 0x3a, 0x6e, 0x65, 0xef, 0x89, 0xb3, 0x1c, 0x7f, 0xc5, 0xbe, 0x3f, 0xfe, 0x11,
+   0x7a, 0xe0, 0x6a, 0x53, 0x14, 0x45, 0xcd, 0xb3, 0x62, 0xb5, 0x12, 0x75, 0xb6, 0xcc, 0xc3, 0xd3,
+   0x8a, 0xc0, 0x90, 0x39, 0x75, 0xc1, 0x34, 0xf6, 0xfa, 0x3f, 0xa9, 0xd5, 0x77, 0x9d, 0xfc, 0x05,
+   0x00, 0x00,
+};
+
+// style.css: 1174 bytes, 527 gzipped
+static const uint8_t ASSET_2[] = {
+   0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x54, 0xdb, 0x6e, 0xa3, 0x30,
+   0x10, 0x7d, 0xef, 0x57, 0x8c, 0x54, 0xad, 0xd4, 0xae, 0x42, 0x8a, 0x09, 0x8d, 0x08, 0x7c, 0xcd,
+   0x80, 0x07, 0x70, 0x17, 0x6c, 0x64, 0x9b, 0x5c, 0xba, 0xea, 0xbf, 0xef, 0x98, 0x5c, 0x36, 0x09,
+   0x88, 0x07, 0xc0, 0x9e, 0x39, 0x73, 0x2e, 0x98, 0xdf, 0xf0, 0x17, 0x4a, 0x73, 0x8c, 0x9c, 0xfa,
+   0x56, 0xba, 0xc9, 0xf9, 0xd9, 0x4a, 0xb2, 0x11, 0x2f, 0x15, 0xf0, 0xf3, 0x52, 0x1a, 0x79, 0xe2,
+   0x82, 0x1e, 0x6d, 0xa3, 0x74, 0x0e, 0x71, 0x01, 0xb5, 0xd1, 0x3e, 0x07, 0xf1, 0x39, 0x1c, 0x3f,
+   0xc4, 0x3a, 0x05, 0x77, 0x72, 0x9e, 0xfa, 0x68, 0x54, 0x2b, 0x70, 0xa8, 0x5d, 0xe4, 0xc8, 0xaa,
+   0xba, 0x80, 0x12, 0xab, 0x3f, 0x8d, 0x35, 0xa3, 0x96, 0x39, 0xbc, 0x8a, 0x58, 0xa4, 0x22, 0x2b,
+   0xa0, 0x32, 0x9d, 0xb1, 0xfc, 0x4e, 0x5b, 0xda, 0x51, 0x15, 0xe0, 0x5b, 0x42, 0x1e, 0xc6, 0x03,
+   0xa4, 0x72, 0x43, 0x87, 0xa7, 0x1c, 0xea, 0x8e, 0x78, 0x30, 0x76, 0xaa, 0xd1, 0x91, 0x62, 0x64,
+   0x97, 0x43, 0x45, 0xda, 0x93, 0x2d, 0xe0, 0x6b, 0x74, 0x5e, 0xd5, 0xa7, 0xa8, 0x62, 0x06, 0x14,
+   0x48, 0xb8, 0x01, 0x2b, 0x8a, 0x4a, 0xf2, 0x07, 0x22, 0x5d, 0xc0, 0x80, 0x52, 0x4e, 0x12, 0x44,
+   0x32, 0x1c, 0x41, 0x6c, 0x87, 0xe3, 0x33, 0x8f, 0x32, 0x11, 0x49, 0x36, 0xcd, 0x15, 0x73, 0x51,
+   0xc1, 0x01, 0xca, 0x21, 0x89, 0x87, 0x49, 0x79, 0x9b, 0xdc, 0x97, 0xf0, 0x95, 0x85, 0xf5, 0xbb,
+   0xc2, 0xf3, 0x80, 0xa9, 0xd0, 0xf5, 0xd8, 0x75, 0x5c, 0x7e, 0x15, 0x98, 0xe1, 0x2e, 0xdd, 0xd1,
+   0xa5, 0xfa, 0x40, 0xaa, 0x69, 0x99, 0xad, 0x36, 0x96, 0xcb, 0x42, 0x47, 0x8f, 0x4a, 0xdf, 0x6b,
+   0x6e, 0xac, 0x92, 0x05, 0x34, 0x38, 0x9c, 0xa9, 0x3f, 0x29, 0x29, 0xa6, 0xfd, 0x88, 0xbd, 0xe0,
+   0x6a, 0x4f, 0x2c, 0xbf, 0x1b, 0x7b, 0xcd, 0xbe, 0x58, 0x1a, 0x08, 0xfd, 0x1b, 0x8e, 0xde, 0x44,
+   0xb5, 0xf2, 0x2b, 0xe8, 0x95, 0xee, 0xf1, 0xf8, 0xb6, 0x89, 0x59, 0xc2, 0x0a, 0x44, 0x6d, 0xdf,
+   0xdf, 0xc3, 0xb8, 0x75, 0x85, 0x56, 0x86, 0x94, 0x97, 0xbc, 0xb8, 0xc4, 0x6d, 0x51, 0xaa, 0x91,
+   0x31, 0xb3, 0x85, 0xf1, 0x8c, 0x60, 0x39, 0x27, 0x33, 0xfa, 0x05, 0xd2, 0xcb, 0xd4, 0x02, 0xa7,
+   0x40, 0xe0, 0xa2, 0x6a, 0xca, 0x63, 0xc2, 0x9a, 0x19, 0x7a, 0x07, 0x2e, 0xfd, 0x82, 0x85, 0xf7,
+   0xfb, 0x72, 0x21, 0xb4, 0x3d, 0x5a, 0x85, 0x7c, 0xd7, 0x63, 0xcf, 0x5f, 0x5e, 0x95, 0x83, 0xc7,
+   0x72, 0xec, 0xd0, 0x86, 0x05, 0x17, 0xda, 0x2b, 0xd4, 0x7b, 0x74, 0xdc, 0x79, 0x50, 0xd2, 0xb7,
+   0xac, 0x29, 0x8e, 0x7f, 0x15, 0xd0, 0x5e, 0x42, 0x11, 0xe7, 0xb8, 0x1f, 0xac, 0x89, 0xcb, 0x98,
+   0x84, 0x98, 0x59, 0x93, 0x5e, 0xe8, 0x3a, 0x8f, 0x7e, 0x0c, 0x80, 0x37, 0x9b, 0x82, 0xbc, 0x49,
+   0xcc, 0x53, 0x87, 0x98, 0x63, 0x6f, 0xcb, 0x94, 0xc4, 0xf6, 0xf1, 0x3b, 0xda, 0x3c, 0x00, 0xaf,
+   0x3b, 0xb5, 0xa7, 0x59, 0x5a, 0xf4, 0x89, 0x9b, 0x64, 0xaa, 0x2a, 0x47, 0xef, 0x8d, 0x76, 0xf3,
+   0x33, 0x33, 0x39, 0x9d, 0xfd, 0x37, 0x39, 0xf2, 0xe6, 0xba, 0xc0, 0xe7, 0x78, 0xea, 0xe2, 0x33,
+   0x4a, 0x1d, 0x55, 0xfe, 0x19, 0x3e, 0x61, 0xf0, 0x4d, 0x79, 0x3b, 0xa0, 0x4a, 0xb7, 0xec, 0xa5,
+   0xbf, 0xea, 0x61, 0x8a, 0x2c, 0xd0, 0x99, 0x4e, 0x49, 0x78, 0xdd, 0x60, 0x9a, 0xa6, 0xf5, 0xb2,
+   0x39, 0x37, 0x43, 0xb6, 0xb7, 0xbc, 0xcf, 0x7f, 0x8b, 0x1b, 0xe0, 0x95, 0x48, 0x8e, 0x95, 0x5f,
+   0x90, 0x79, 0x05, 0xff, 0x79, 0xf9, 0x07, 0xad, 0x19, 0xb5, 0xc4, 0x96, 0x04, 0x00, 0x00,
+};
+
+const web_asset_t WEB_ASSETS[] = {
+   {"/app.js", "application/javascript", "public, max-age=31536000, immutable", "\"49888bc1844db102\"", ASSET_0, sizeof(ASSET_0), 3361},
+   {"/index.html", "text/html", "no-cache", "\"6a26fe4b12408a47\"", ASSET_1, sizeof(ASSET_1), 1532},
+   {"/style.css", "text/css", "public, max-age=31536000, immutable", "\"f96bf2e84fa9a21c\"", ASSET_2, sizeof(ASSET_2), 1174},
+};
+
+const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
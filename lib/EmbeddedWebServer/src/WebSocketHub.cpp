@@ -0,0 +1,456 @@
+/**
+ * @file WebSocketHub.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief An implementation for CWebSocketHub member functions.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+#include "WebSocketHub.h"
+#include <ArduinoJson.h>
+#include <mbedtls/sha1.h>
+#include <mbedtls/base64.h>
+#include <ImuSnapshotCache.h>
+#include <JsonPoolAllocator.h>
+#include <esp_timer.h>
+#include <SocketUtil.h>
+
+// GUID appended to the client key by RFC 6455 section 4.2.2.
+static const char WS_HANDSHAKE_GUID[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+CWebSocketHub::CWebSocketHub()
+   : m_SensorPeriodUs(0), m_FramesSent(0), m_FramesSkipped(0)
+{
+   for (int i = 0; i < WS_MAX_SESSIONS; i++)
+   {
+      m_Sessions[i].active = false;
+   }
+}
+
+bool CWebSocketHub::ComputeAcceptKey(const String &clientKey, char *out, size_t outSize)
+{
+   String handshake = clientKey + WS_HANDSHAKE_GUID;
+   unsigned char digest[20];
+   if (mbedtls_sha1((const unsigned char *)handshake.c_str(), handshake.length(), digest) != 0)
+   {
+      return false;
+   }
+
+   size_t written = 0;
+   if (mbedtls_base64_encode((unsigned char *)out, outSize, &written, digest, sizeof(digest)) != 0)
+   {
+      return false;
+   }
+   out[written] = '\0';
+   return true;
+}
+
+bool CWebSocketHub::Accept(WiFiClient &client)
+{
+   for (int i = 0; i < WS_MAX_SESSIONS; i++)
+   {
+      session_t &session = m_Sessions[i];
+      if (!session.active)
+      {
+         // Holding a copy keeps the socket open after the web server drops its own.
+         session.client = client;
+         session.active = true;
+         session.subscribed = false;
+         session.binary = false;
+         session.raw = false;
+         session.paced = false;
+         session.requested_period_us = 0;
+         session.last_sequence = 0;
+         session.rx_length = 0;
+         session.client.setNoDelay(true);
+         log_i("WebSocket session %d opened", i);
+         return true;
+      }
+   }
+   log_e("WebSocket rejected, all %d sessions in use", WS_MAX_SESSIONS);
+   return false;
+}
+
+void CWebSocketHub::Poll()
+{
+   int64_t nowUs = esp_timer_get_time();
+   for (int i = 0; i < WS_MAX_SESSIONS; i++)
+   {
+      session_t &session = m_Sessions[i];
+      if (!session.active)
+      {
+         continue;
+      }
+      if (!session.client.connected())
+      {
+         session.client.stop();
+         session.active = false;
+         log_i("WebSocket session %d closed", i);
+         continue;
+      }
+      ReadFrames(session);
+      if (session.active)
+      {
+         PushImu(session, nowUs);
+      }
+   }
+}
+
+void CWebSocketHub::PushFrames()
+{
+   int64_t nowUs = esp_timer_get_time();
+   for (int i = 0; i < WS_MAX_SESSIONS; i++)
+   {
+      if (m_Sessions[i].active)
+      {
+         PushImu(m_Sessions[i], nowUs);
+      }
+   }
+}
+
+void CWebSocketHub::SetSensorPeriodUs(uint32_t periodUs)
+{
+   if (periodUs == m_SensorPeriodUs)
+   {
+      return;
+   }
+   m_SensorPeriodUs = periodUs;
+   int64_t nowUs = esp_timer_get_time();
+   for (int i = 0; i < WS_MAX_SESSIONS; i++)
+   {
+      session_t &session = m_Sessions[i];
+      if (session.active && session.subscribed && session.paced)
+      {
+         session.pacer.SetPeriod(GetPeriodUs(session), nowUs);
+      }
+   }
+}
+
+uint32_t CWebSocketHub::GetPeriodUs(const session_t &session) const
+{
+   return (session.requested_period_us < m_SensorPeriodUs) ? m_SensorPeriodUs : session.requested_period_us;
+}
+
+joystick_data_t CWebSocketHub::GetJoystickData()
+{
+   return m_JoystickData.Load();
+}
+
+uint8_t CWebSocketHub::GetSessionCount() const
+{
+   uint8_t count = 0;
+   for (int i = 0; i < WS_MAX_SESSIONS; i++)
+   {
+      if (m_Sessions[i].active)
+      {
+         count++;
+      }
+   }
+   return count;
+}
+
+ws_stats_t CWebSocketHub::TakeStats()
+{
+   ws_stats_t stats;
+   stats.frames_sent = m_FramesSent;
+   stats.frames_skipped = m_FramesSkipped;
+   stats.sessions = GetSessionCount();
+   m_FramesSent = 0;
+   m_FramesSkipped = 0;
+   return stats;
+}
+
+void CWebSocketHub::ReadFrames(session_t &session)
+{
+   while (session.client.available() && session.rx_length < sizeof(session.rx))
+   {
+      int received = session.client.read(session.rx + session.rx_length, sizeof(session.rx) - session.rx_length);
+      if (received <= 0)
+      {
+         break;
+      }
+      session.rx_length += received;
+   }
+
+   while (session.active && session.rx_length >= 2)
+   {
+      bool fin = (session.rx[0] & 0x80) != 0;
+      uint8_t opcode = session.rx[0] & 0x0F;
+      bool masked = (session.rx[1] & 0x80) != 0;
+      size_t length = session.rx[1] & 0x7F;
+      size_t headerLength = 2;
+
+      if (length == 126)
+      {
+         if (session.rx_length < 4)
+         {
+            return;
+         }
+         length = ((size_t)session.rx[2] << 8) | session.rx[3];
+         headerLength = 4;
+      }
+      else if (length == 127)
+      {
+         Close(session, 1009);
+         return;
+      }
+
+      // Clients must mask every frame (RFC 6455 section 5.1).
+      if (!masked)
+      {
+         Close(session, 1002);
+         return;
+      }
+      if (length > WS_MAX_MESSAGE_SIZE)
+      {
+         Close(session, 1009);
+         return;
+      }
+      // Fragmented messages are not needed by the dashboard protocol.
+      if (!fin || opcode == 0)
+      {
+         Close(session, 1003);
+         return;
+      }
+
+      size_t frameLength = headerLength + 4 + length;
+      if (session.rx_length < frameLength)
+      {
+         return;
+      }
+
+      const uint8_t *mask = session.rx + headerLength;
+      uint8_t *payload = session.rx + headerLength + 4;
+      for (size_t i = 0; i < length; i++)
+      {
+         payload[i] ^= mask[i & 3];
+      }
+
+      HandleMessage(session, opcode, payload, length);
+      if (!session.active)
+      {
+         return;
+      }
+
+      session.rx_length -= frameLength;
+      memmove(session.rx, session.rx + frameLength, session.rx_length);
+   }
+}
+
+void CWebSocketHub::HandleMessage(session_t &session, uint8_t opcode, uint8_t *payload, size_t length)
+{
+   switch (opcode)
+   {
+   case WS_OPCODE_TEXT:
+      HandleTextMessage(session, (const char *)payload, length);
+      break;
+   case WS_OPCODE_BINARY:
+      if (length == WS_JOYSTICK_BINARY_SIZE)
+      {
+         int16_t axes[4];
+         memcpy(axes, payload, sizeof(axes));
+         joystick_data_t joystickData;
+         joystickData.left_x = axes[0];
+         joystickData.left_y = axes[1];
+         joystickData.right_x = axes[2];
+         joystickData.right_y = axes[3];
+         joystickData.left_button = (payload[8] & 0x01) != 0;
+         joystickData.right_button = (payload[8] & 0x02) != 0;
+         joystickData.timestamp = millis();
+         joystickData.sent_us = 0;
+         joystickData.received_us = esp_timer_get_time();
+         joystickData.applied_us = joystickData.received_us;
+         m_JoystickData.Store(joystickData);
+      }
+      else
+      {
+         log_e("Unsupported binary WebSocket message of %u bytes", length);
+      }
+      break;
+   case WS_OPCODE_PING:
+      // The client pings again if this pong is dropped on a full socket.
+      if (CSocketUtil::IsWritable(session.client))
+      {
+         SendFrame(session, WS_OPCODE_PONG, payload, length);
+      }
+      break;
+   case WS_OPCODE_CLOSE:
+      Close(session, 1000);
+      break;
+   default:
+      break;
+   }
+}
+
+void CWebSocketHub::HandleTextMessage(session_t &session, const char *payload, size_t length)
+{
+   JsonDocument doc(CJsonPoolAllocator::Instance());
+   DeserializationError error = deserializeJson(doc, payload, length);
+   if (error)
+   {
+      log_e("WebSocket JSON parsing failed: %s", error.c_str());
+      return;
+   }
+
+   String type = doc["type"] | "";
+   if (type == "subscribe")
+   {
+      uint32_t rate = doc["rate"] | 0;
+      String format = doc["format"] | "json";
+      if (rate > WS_MAX_RATE_HZ)
+      {
+         rate = WS_MAX_RATE_HZ;
+      }
+      session.paced = (rate != 0);
+      session.requested_period_us = session.paced ? (1000000UL / rate) : 0;
+      session.binary = (format == "binary");
+      session.raw = (format == "raw");
+      session.subscribed = true;
+      // Microsecond periods hold rates that whole milliseconds cannot, and
+      // congested sessions back off the same way gRPC streams do.
+      if (session.paced)
+      {
+         session.pacer.Start(GetPeriodUs(session), true, esp_timer_get_time());
+         log_i("WebSocket subscribed at %u Hz, paced every %u us (%s)", rate, GetPeriodUs(session),
+               format.c_str());
+      }
+      else
+      {
+         log_i("WebSocket subscribed to every sample (%s)", format.c_str());
+      }
+   }
+   else if (type == "unsubscribe")
+   {
+      session.subscribed = false;
+   }
+   else if (type == "joystick")
+   {
+      joystick_data_t joystickData;
+      joystickData.left_x = doc["left_x"] | 0;
+      joystickData.left_y = doc["left_y"] | 0;
+      joystickData.right_x = doc["right_x"] | 0;
+      joystickData.right_y = doc["right_y"] | 0;
+      joystickData.left_button = doc["left_button"] | false;
+      joystickData.right_button = doc["right_button"] | false;
+      joystickData.timestamp = millis();
+      joystickData.sent_us = 0;
+      joystickData.received_us = esp_timer_get_time();
+      joystickData.applied_us = joystickData.received_us;
+      m_JoystickData.Store(joystickData);
+   }
+   else
+   {
+      log_e("Unknown WebSocket message type: %s", type.c_str());
+   }
+}
+
+void CWebSocketHub::PushImu(session_t &session, int64_t nowUs)
+{
+   if (!session.subscribed)
+   {
+      return;
+   }
+   if (session.paced && !session.pacer.IsDue(nowUs))
+   {
+      return;
+   }
+
+   CImuSnapshotCache *snapshots = CImuSnapshotCache::Instance();
+   uint32_t sequence = snapshots->GetSample().sequence;
+   // Only push samples the dashboard has not seen yet.
+   if (sequence == session.last_sequence)
+   {
+      return;
+   }
+
+   // A congested session loses this frame rather than stalling the server
+   // task; it is sent the newest sample once its socket drains.
+   if (!CSocketUtil::IsWritable(session.client))
+   {
+      m_FramesSkipped++;
+      if (session.paced)
+      {
+         session.pacer.OnSkipped();
+      }
+   }
+   else
+   {
+      if (session.raw)
+      {
+         uint8_t frame[IMU_SNAPSHOT_RAW_SIZE];
+         size_t length = snapshots->CopyRaw(frame);
+         SendFrame(session, WS_OPCODE_BINARY, frame, length);
+      }
+      else if (session.binary)
+      {
+         uint8_t frame[IMU_SNAPSHOT_BINARY_SIZE];
+         size_t length = snapshots->CopyBinary(frame);
+         SendFrame(session, WS_OPCODE_BINARY, frame, length);
+      }
+      else
+      {
+         char frame[IMU_SNAPSHOT_MAX_JSON];
+         size_t length = snapshots->CopyJson(IMU_JSON_GRPC, IMU_PROJECTION_ALL, frame, sizeof(frame));
+         SendFrame(session, WS_OPCODE_TEXT, (const uint8_t *)frame, length);
+      }
+      session.last_sequence = sequence;
+      if (session.paced)
+      {
+         session.pacer.OnSent();
+      }
+      m_FramesSent++;
+   }
+
+   if (session.paced)
+   {
+      session.pacer.Advance(nowUs);
+   }
+}
+
+bool CWebSocketHub::SendFrame(session_t &session, uint8_t opcode, const uint8_t *data, size_t length)
+{
+   uint8_t frame[4 + WS_MAX_MESSAGE_SIZE];
+   size_t headerLength = 2;
+   frame[0] = 0x80 | opcode;
+   if (length < 126)
+   {
+      frame[1] = (uint8_t)length;
+   }
+   else
+   {
+      frame[1] = 126;
+      frame[2] = (uint8_t)(length >> 8);
+      frame[3] = (uint8_t)(length & 0xFF);
+      headerLength = 4;
+   }
+
+   size_t written;
+   if (headerLength + length <= sizeof(frame))
+   {
+      // One write per frame keeps each message in a single TCP segment.
+      memcpy(frame + headerLength, data, length);
+      written = session.client.write(frame, headerLength + length);
+   }
+   else
+   {
+      written = session.client.write(frame, headerLength);
+      written += session.client.write(data, length);
+   }
+   return written == headerLength + length;
+}
+
+void CWebSocketHub::Close(session_t &session, uint16_t code)
+{
+   uint8_t payload[2] = {(uint8_t)(code >> 8), (uint8_t)(code & 0xFF)};
+   // A congested peer gets the TCP close alone.
+   if (CSocketUtil::IsWritable(session.client))
+   {
+      SendFrame(session, WS_OPCODE_CLOSE, payload, sizeof(payload));
+   }
+   session.client.stop();
+   session.active = false;
+   session.rx_length = 0;
+   log_i("WebSocket session closed with status %u", code);
+}
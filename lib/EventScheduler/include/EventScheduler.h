@@ -0,0 +1,187 @@
+/**
+ * @file EventScheduler.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief A small deadline scheduler that wakes FreeRTOS tasks through
+ *        task notifications, driven by the microsecond esp_timer clock.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef EVENT_SCHEDULER_H
+#define EVENT_SCHEDULER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "TimerDeadline.h"
+
+/**
+ * @brief Maximum number of timers that can be registered with the scheduler.
+ *
+ */
+#define EVENT_SCHEDULER_MAX_TIMERS 8
+
+/**
+ * @brief Shortest one-shot delay handed to esp_timer. Deadlines closer than
+ *        this are treated as already due.
+ *
+ */
+#define EVENT_SCHEDULER_MIN_ARM_US 50
+
+/**
+ * @brief Busy/idle accounting for a task that blocks in WaitForEvents().
+ *
+ */
+typedef struct {
+   int64_t window_start_us; // Start of the current measurement window
+   int64_t idle_us;         // Time spent blocked waiting for events in the window
+} scheduler_load_t;
+
+/**
+ * @brief A deadline scheduler that replaces delay()-paced loops.
+ *
+ * Each timer belongs to one task and owns a set of notification bits. When a
+ * timer expires the scheduler sets those bits on the task with xTaskNotify(),
+ * so a task can block on several event sources at once and run exactly when
+ * one of them is due. Periodic timers advance their deadline by whole periods
+ * from the previous deadline, never from the time they were serviced, so the
+ * period does not drift.
+ *
+ */
+class CEventScheduler
+{
+public:
+   /**
+    * @brief Construct a new CEventScheduler object
+    *
+    */
+   CEventScheduler();
+   /**
+    * @brief Create the underlying esp_timer and lock. Must be called before
+    *        any timer is added.
+    *
+    * @return true on success.
+    */
+   bool Begin();
+   /**
+    * @brief Register a timer that notifies a task.
+    *
+    * @param name Short name used when logging statistics.
+    * @param task Task to notify when the timer expires.
+    * @param eventBits Notification bits set on the task on expiry.
+    * @return int Timer id, or -1 if the timer table is full.
+    */
+   int AddTimer(const char *name, TaskHandle_t task, uint32_t eventBits);
+   /**
+    * @brief Start a timer firing every periodUs microseconds.
+    *
+    * @param timerId Timer id returned by AddTimer().
+    * @param periodUs Period in microseconds.
+    * @return true if the timer was started.
+    */
+   bool StartPeriodic(int timerId, uint32_t periodUs);
+   /**
+    * @brief Arm a timer to fire once at an absolute time on the scheduler clock.
+    *
+    * @param timerId Timer id returned by AddTimer().
+    * @param dueUs Absolute deadline in microseconds (see NowUs()).
+    * @return true if the timer was armed.
+    */
+   bool ArmAt(int timerId, int64_t dueUs);
+   /**
+    * @brief Next deadline of a running timer.
+    *
+    * @param timerId Timer id returned by AddTimer().
+    * @param dueUs Receives the deadline on the scheduler clock.
+    * @return true if the timer is armed.
+    */
+   bool GetDueUs(int timerId, int64_t &dueUs);
+   /**
+    * @brief Stop a timer. Pending notifications are not withdrawn.
+    *
+    * @param timerId Timer id returned by AddTimer().
+    */
+   void Stop(int timerId);
+   /**
+    * @brief Copy and reset the statistics of a timer.
+    *
+    * @param timerId Timer id returned by AddTimer().
+    * @param stats Receives the statistics collected since the last call.
+    * @return true if timerId is valid.
+    */
+   bool TakeStats(int timerId, scheduler_timer_stats_t &stats);
+   /**
+    * @brief Log and reset the statistics of all registered timers.
+    *
+    */
+   void LogStats();
+   /**
+    * @brief Current time on the scheduler clock.
+    *
+    * @return int64_t Microseconds since boot.
+    */
+   static int64_t NowUs();
+   /**
+    * @brief Block the calling task until a notification arrives or the
+    *        timeout expires.
+    *
+    * @param timeout Maximum time to block, in ticks.
+    * @param load Optional load accounting updated with the time spent blocked.
+    * @return uint32_t Notification bits received (0 on timeout).
+    */
+   static uint32_t WaitForEvents(TickType_t timeout, scheduler_load_t *load = nullptr);
+   /**
+    * @brief Compute the busy percentage of a task and start a new window.
+    *
+    * @param load Load accounting filled in by WaitForEvents().
+    * @return float Percentage of the window the task was not blocked.
+    */
+   static float TakeBusyPercent(scheduler_load_t &load);
+
+private:
+   /**
+    * @brief Internal state for a single timer.
+    *
+    */
+   typedef struct {
+      const char *name;
+      TaskHandle_t task;
+      uint32_t event_bits;
+      CTimerDeadline deadline;
+   } timer_entry_t;
+
+   /**
+    * @brief esp_timer callback trampoline.
+    *
+    * @param arg Pointer to the owning CEventScheduler.
+    */
+   static void OnTimerExpired(void *arg);
+   /**
+    * @brief Notify every due timer and re-arm esp_timer for the next deadline.
+    *
+    */
+   void Dispatch();
+   /**
+    * @brief Arm esp_timer for the earliest pending deadline. Caller holds m_Lock.
+    *
+    * @param nowUs Current time on the scheduler clock.
+    */
+   void RearmLocked(int64_t nowUs);
+   /**
+    * @brief Check a timer id.
+    *
+    * @param timerId Timer id to check.
+    * @return true if the id refers to a registered timer.
+    */
+   bool IsValid(int timerId) const;
+
+   timer_entry_t m_Timers[EVENT_SCHEDULER_MAX_TIMERS];
+   int m_TimerCount;
+   esp_timer_handle_t m_Timer;
+   SemaphoreHandle_t m_Lock;
+   StaticSemaphore_t m_LockBuffer;
+};
+
+#endif // !EVENT_SCHEDULER_H
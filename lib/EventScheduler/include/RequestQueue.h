@@ -0,0 +1,139 @@
+/**
+ * @file RequestQueue.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Per-client queue of pending requests with token bucket admission,
+ *        and the class-priority choice of which client is served next.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef REQUEST_QUEUE_H
+#define REQUEST_QUEUE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Most requests one queue holds and most request classes it meters.
+ */
+#define REQUEST_QUEUE_MAX_DEPTH   8
+#define REQUEST_QUEUE_MAX_CLASSES 4
+
+/**
+ * @brief Token bucket of one request class: sustained requests per second
+ *        and burst size. A rate of 0 leaves the class unlimited.
+ */
+typedef struct {
+   float rate_hz;
+   float burst;
+} request_class_limit_t;
+
+/**
+ * @brief Pending requests of one client in arrival order. Only the class and
+ *        arrival time are kept here; the caller stores the request itself in
+ *        the slot returned by Push(). Every time is passed in by the caller.
+ */
+class CRequestQueue
+{
+public:
+   /**
+    * @brief Construct an empty queue that admits nothing until Reset().
+    */
+   CRequestQueue();
+   /**
+    * @brief Empty the queue and fill every token bucket.
+    *
+    * @param depth Requests held before IsFull(), at most REQUEST_QUEUE_MAX_DEPTH.
+    * @param limits Token bucket per class, indexed by class.
+    * @param classCount Number of classes, at most REQUEST_QUEUE_MAX_CLASSES.
+    * @param nowUs Current time.
+    */
+   void Reset(uint8_t depth, const request_class_limit_t *limits, uint8_t classCount, int64_t nowUs);
+   /**
+    * @brief Drop every pending request; the buckets keep their level.
+    */
+   void Clear();
+   /**
+    * @brief Append a request.
+    *
+    * @param requestClass Class of the request.
+    * @param nowUs Arrival time.
+    * @return uint8_t Slot the caller stores the request in, or depth if full.
+    */
+   uint8_t Push(uint8_t requestClass, int64_t nowUs);
+   /**
+    * @brief Remove the oldest request.
+    */
+   void Pop();
+   /**
+    * @brief Slot of the oldest request, valid while not IsEmpty().
+    */
+   uint8_t GetHeadSlot() const;
+   /**
+    * @brief Class of the oldest request, valid while not IsEmpty().
+    */
+   uint8_t GetHeadClass() const;
+   /**
+    * @brief Arrival time of the oldest request, valid while not IsEmpty().
+    */
+   int64_t GetHeadSinceUs() const;
+   /**
+    * @brief Number of pending requests.
+    */
+   uint8_t GetCount() const;
+   bool IsEmpty() const;
+   bool IsFull() const;
+   /**
+    * @brief Take a token for a request, refilling the buckets for the time
+    *        since the last call.
+    *
+    * @param requestClass Class of the request.
+    * @param nowUs Current time.
+    * @return true if the request may run, false if it is over its limit.
+    */
+   bool Admit(uint8_t requestClass, int64_t nowUs);
+   /**
+    * @brief Time until the class has a token again, for a refused request.
+    *
+    * @param requestClass Class of the refused request.
+    * @return uint32_t Milliseconds to wait, rounded up.
+    */
+   uint32_t GetRetryAfterMs(uint8_t requestClass) const;
+
+private:
+   uint8_t m_Depth;
+   uint8_t m_Head;                // Slot of the oldest request
+   uint8_t m_Count;
+   uint8_t m_ClassCount;
+   uint8_t m_Class[REQUEST_QUEUE_MAX_DEPTH];       // Class of each pending request
+   int64_t m_SinceUs[REQUEST_QUEUE_MAX_DEPTH];     // Arrival time of each pending request
+   request_class_limit_t m_Limits[REQUEST_QUEUE_MAX_CLASSES];
+   float m_Tokens[REQUEST_QUEUE_MAX_CLASSES];      // Token bucket level per class
+   int64_t m_TokensUpdatedUs;     // Time the buckets were last refilled
+};
+
+/**
+ * @brief Chooses the client served next: the one whose oldest request has
+ *        the highest class, lowest value first. The starting point rotates
+ *        past the last choice so clients of equal class take turns.
+ */
+class CRequestDispatcher
+{
+public:
+   CRequestDispatcher();
+   /**
+    * @brief Pick the next queue and move the rotation past it.
+    *
+    * @param queues Queue per client; NULL for clients not to serve now.
+    * @param count Number of entries in queues.
+    * @return int Index of the chosen queue, -1 if none has a request.
+    */
+   int Select(CRequestQueue *const *queues, uint8_t count);
+
+private:
+   uint8_t m_Next;                // Index the next search starts at
+};
+
+#endif // !REQUEST_QUEUE_H
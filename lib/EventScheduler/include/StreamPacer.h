@@ -0,0 +1,123 @@
+/**
+ * @file StreamPacer.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Frame deadlines and congestion backoff of one stream subscriber,
+ *        independent of the clock that drives it.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef STREAM_PACER_H
+#define STREAM_PACER_H
+
+#include <stdint.h>
+
+/**
+ * @brief Largest factor by which a congested subscriber's stream period is
+ *        stretched.
+ */
+#define STREAM_PACER_MAX_BACKOFF 16
+
+/**
+ * @brief Consecutive frames a backed-off subscriber must accept before its
+ *        stream period is halved again.
+ */
+#define STREAM_PACER_RECOVERY_FRAMES 32
+
+/**
+ * @brief How early a frame deadline counts as reached. The scheduler treats
+ *        deadlines closer than EVENT_SCHEDULER_MIN_ARM_US as due and wakes
+ *        the stream tick up to that much early.
+ */
+#define STREAM_PACER_EARLY_US 50
+
+/**
+ * @brief Paces one subscriber. Each skipped frame doubles an adaptive
+ *        subscriber's period up to STREAM_PACER_MAX_BACKOFF times the
+ *        requested one; STREAM_PACER_RECOVERY_FRAMES frames in a row halve
+ *        it again. Deadlines advance from the previous deadline so the rate
+ *        holds, and frames that could not be sent in time are dropped rather
+ *        than bunched up. Every time is passed in by the caller.
+ */
+class CStreamPacer
+{
+public:
+   /**
+    * @brief Construct a pacer with no period.
+    */
+   CStreamPacer();
+   /**
+    * @brief Start pacing with the first frame due now.
+    *
+    * @param periodUs Requested frame period.
+    * @param adaptive Stretch the period while frames are skipped.
+    * @param nowUs Current time.
+    */
+   void Start(uint32_t periodUs, bool adaptive, int64_t nowUs);
+   /**
+    * @brief Change the requested period; backoff starts over. A shorter
+    *        period makes the next frame due now.
+    *
+    * @param periodUs New frame period.
+    * @param nowUs Current time.
+    */
+   void SetPeriod(uint32_t periodUs, int64_t nowUs);
+   /**
+    * @brief Whether a frame is due, allowing STREAM_PACER_EARLY_US of slack.
+    *
+    * @param nowUs Current time.
+    * @return true if the deadline has been reached.
+    */
+   bool IsDue(int64_t nowUs) const;
+   /**
+    * @brief Deadline of the next frame.
+    *
+    * @return int64_t Deadline in microseconds.
+    */
+   int64_t GetDueUs() const;
+   /**
+    * @brief Requested frame period.
+    *
+    * @return uint32_t Period in microseconds.
+    */
+   uint32_t GetPeriodUs() const;
+   /**
+    * @brief Frame period after backoff.
+    *
+    * @return uint32_t Period in microseconds.
+    */
+   uint32_t GetEffectivePeriodUs() const;
+   /**
+    * @brief Whether the subscriber runs below its requested rate.
+    *
+    * @return true if backed off.
+    */
+   bool IsBackedOff() const;
+   /**
+    * @brief Record that the due frame was written.
+    */
+   void OnSent();
+   /**
+    * @brief Record that the due frame was skipped for lack of room.
+    */
+   void OnSkipped();
+   /**
+    * @brief Move to the next deadline after a due frame was handled (sent,
+    *        skipped or suppressed).
+    *
+    * @param nowUs Current time.
+    */
+   void Advance(int64_t nowUs);
+
+private:
+   uint32_t m_PeriodUs;           // Requested period
+   uint32_t m_EffectivePeriodUs;  // Period after backpressure adjustment
+   int64_t m_DueUs;               // Deadline of the next frame
+   uint16_t m_CleanFrames;        // Frames sent since the last skipped one
+   bool m_Adaptive;
+};
+
+#endif // !STREAM_PACER_H
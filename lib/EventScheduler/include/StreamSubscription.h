@@ -0,0 +1,158 @@
+/**
+ * @file StreamSubscription.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Per-tick frame decision of one stream subscriber: pacing,
+ *        change-triggered suppression and congestion skips.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef STREAM_SUBSCRIPTION_H
+#define STREAM_SUBSCRIPTION_H
+
+#include <stdint.h>
+#include "StreamPacer.h"
+
+/**
+ * @brief Most fields a change-triggered subscription compares.
+ */
+#define STREAM_SUBSCRIPTION_MAX_FIELDS 8
+
+/**
+ * @brief What a stream tick did with a subscriber.
+ */
+typedef enum {
+   STREAM_FRAME_NOT_DUE,    // No frame was due
+   STREAM_FRAME_SENT,       // The frame was written
+   STREAM_FRAME_SKIPPED,    // The socket had no room; the frame was dropped
+   STREAM_FRAME_SUPPRESSED, // Nothing moved past a threshold
+} stream_frame_result_t;
+
+/**
+ * @brief Frames handled since the last read of the counters.
+ */
+typedef struct {
+   uint32_t frames_sent;
+   uint32_t frames_skipped;
+   uint32_t frames_suppressed;
+} stream_frame_counts_t;
+
+/**
+ * @brief Where a subscription's frames come from and go to. The server
+ *        implements it on a socket, the timing simulator on a modeled
+ *        send buffer.
+ */
+class CStreamSink
+{
+public:
+   virtual ~CStreamSink() {}
+   /**
+    * @brief Field values of the current sample, in the order of the
+    *        thresholds. Only asked for by change-triggered subscriptions.
+    *
+    * @return const float* Values, valid until the tick ends.
+    */
+   virtual const float *GetValues() = 0;
+   /**
+    * @brief Check without blocking whether a whole frame can be written.
+    *
+    * @return true if there is room for a frame.
+    */
+   virtual bool IsWritable() = 0;
+   /**
+    * @brief Write the current frame.
+    */
+   virtual void SendFrame() = 0;
+};
+
+/**
+ * @brief One subscriber of a periodic stream. Tick() runs the due frame
+ *        through the change thresholds and the writability check and then
+ *        paces the next one; every time is passed in by the caller.
+ */
+class CStreamSubscription
+{
+public:
+   /**
+    * @brief Construct a subscription that sends every frame.
+    */
+   CStreamSubscription();
+   /**
+    * @brief Start a subscription with the first frame due now. Counters
+    *        and the last frame sent are cleared.
+    *
+    * @param periodUs Requested frame period.
+    * @param adaptive Stretch the period while frames are skipped.
+    * @param nowUs Current time on the pacing clock.
+    * @param nowMs Current time on the heartbeat clock.
+    */
+   void Start(uint32_t periodUs, bool adaptive, int64_t nowUs, uint32_t nowMs);
+   /**
+    * @brief Send only frames where a field moved past its threshold since
+    *        the last frame sent, or the heartbeat is due.
+    *
+    * @param thresholds Threshold per field, negative to ignore a field; NULL
+    *                   to send every frame.
+    * @param fieldCount Number of thresholds, at most STREAM_SUBSCRIPTION_MAX_FIELDS.
+    * @param heartbeatMs Longest silence, 0 for none.
+    */
+   void SetDeadband(const float *thresholds, uint8_t fieldCount, uint32_t heartbeatMs);
+   /**
+    * @brief Change the requested period, as CStreamPacer::SetPeriod().
+    *
+    * @param periodUs New frame period.
+    * @param nowUs Current time on the pacing clock.
+    */
+   void SetPeriod(uint32_t periodUs, int64_t nowUs);
+   /**
+    * @brief Handle the frame due at nowUs, if any.
+    *
+    * @param nowUs Current time on the pacing clock.
+    * @param nowMs Current time on the heartbeat clock.
+    * @param sink Source of the sample and destination of the frame.
+    * @return stream_frame_result_t What was done.
+    */
+   stream_frame_result_t Tick(int64_t nowUs, uint32_t nowMs, CStreamSink &sink);
+   /**
+    * @brief Whether a change-triggered subscriber needs the given sample.
+    *
+    * @param values Field values of the sample.
+    * @param nowMs Current time on the heartbeat clock.
+    * @return true if a field moved past its threshold or the heartbeat is due.
+    */
+   bool IsFrameNeeded(const float *values, uint32_t nowMs) const;
+   /**
+    * @brief Whether frames are change-triggered.
+    *
+    * @return true if thresholds are set.
+    */
+   bool IsDeadband() const;
+   /**
+    * @brief Pacing of the subscription.
+    *
+    * @return const CStreamPacer& Pacer.
+    */
+   const CStreamPacer &GetPacer() const;
+   /**
+    * @brief Copy and reset the frame counters.
+    *
+    * @return stream_frame_counts_t Counters since the last call.
+    */
+   stream_frame_counts_t TakeCounts();
+
+private:
+   CStreamPacer m_Pacer;
+   bool m_Deadband;
+   uint8_t m_FieldCount;
+   float m_Thresholds[STREAM_SUBSCRIPTION_MAX_FIELDS];  // Negative to ignore a field
+   float m_LastSent[STREAM_SUBSCRIPTION_MAX_FIELDS];    // Field values of the last frame sent
+   bool m_HaveLastSent;           // m_LastSent holds a frame sent on this subscription
+   uint32_t m_HeartbeatMs;        // Longest silence on a deadband stream, 0 for none
+   uint32_t m_LastSentMs;         // Time of the last frame sent
+   stream_frame_counts_t m_Counts;
+};
+
+#endif // !STREAM_SUBSCRIPTION_H
@@ -0,0 +1,110 @@
+/**
+ * @file TimerDeadline.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Deadline bookkeeping of one scheduler timer, independent of the
+ *        clock that drives it.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef TIMER_DEADLINE_H
+#define TIMER_DEADLINE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Timing statistics collected for a single timer since the last reset.
+ *
+ */
+typedef struct {
+   uint32_t fires;          // Number of times the timer notified its task
+   uint32_t overruns;       // Periods skipped because the deadline was already missed
+   uint32_t max_late_us;    // Worst lateness of a notification against its deadline
+   uint64_t total_late_us;  // Sum of lateness, for computing the mean
+   uint32_t max_jitter_us;  // Worst deviation of a fire-to-fire interval from the period
+   uint64_t total_jitter_us;// Sum of absolute period deviations
+} scheduler_timer_stats_t;
+
+/**
+ * @brief The deadline of a periodic or one-shot timer and its statistics.
+ *
+ * Every time is passed in by the caller, so the same logic runs on the
+ * esp_timer clock in CEventScheduler and on a virtual clock on a host.
+ * Periodic deadlines advance by whole periods from the previous deadline,
+ * never from the time the timer was serviced, so the period does not drift.
+ *
+ */
+class CTimerDeadline
+{
+public:
+   /**
+    * @brief Construct a stopped timer.
+    *
+    */
+   CTimerDeadline();
+   /**
+    * @brief Fire every periodUs microseconds. A running periodic timer keeps
+    *        its phase when only its period changes, except that its next
+    *        deadline is never later than one new period from nowUs.
+    *
+    * @param periodUs Period in microseconds, not 0.
+    * @param nowUs Current time.
+    */
+   void StartPeriodic(uint32_t periodUs, int64_t nowUs);
+   /**
+    * @brief Fire once at an absolute time.
+    *
+    * @param dueUs Deadline in microseconds.
+    */
+   void ArmAt(int64_t dueUs);
+   /**
+    * @brief Stop the timer.
+    *
+    */
+   void Stop();
+   /**
+    * @brief Whether the timer has a pending deadline.
+    *
+    * @return true if armed.
+    */
+   bool IsArmed() const;
+   /**
+    * @brief Pending deadline, meaningful while armed.
+    *
+    * @return int64_t Deadline in microseconds.
+    */
+   int64_t GetDueUs() const;
+   /**
+    * @brief Whether the deadline has been reached.
+    *
+    * @param nowUs Current time.
+    * @param earlyUs How early a deadline may be serviced.
+    * @return true if armed and due.
+    */
+   bool IsDue(int64_t nowUs, uint32_t earlyUs) const;
+   /**
+    * @brief Record a fire at nowUs and move to the next deadline, counting
+    *        whole periods that were missed as overruns. A one-shot timer stops.
+    *
+    * @param nowUs Time the timer is serviced.
+    */
+   void Fire(int64_t nowUs);
+   /**
+    * @brief Copy and reset the statistics.
+    *
+    * @param stats Receives the statistics collected since the last call.
+    */
+   void TakeStats(scheduler_timer_stats_t &stats);
+
+private:
+   uint32_t m_PeriodUs;    // 0 for one-shot timers
+   int64_t m_DueUs;
+   int64_t m_LastFireUs;
+   bool m_Armed;
+   scheduler_timer_stats_t m_Stats;
+};
+
+#endif // !TIMER_DEADLINE_H
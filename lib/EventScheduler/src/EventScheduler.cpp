@@ -0,0 +1,258 @@
+/**
+ * @file EventScheduler.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the microsecond deadline scheduler.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+// Built for the target only; the native test build uses the portable pacer.
+#ifdef ARDUINO
+#include "EventScheduler.h"
+#include "StreamPacer.h"
+
+static_assert(STREAM_PACER_EARLY_US >= EVENT_SCHEDULER_MIN_ARM_US, "stream ticks may be woken before their frame is due");
+
+CEventScheduler::CEventScheduler() : m_TimerCount(0), m_Timer(NULL), m_Lock(NULL)
+{
+}
+
+bool CEventScheduler::Begin()
+{
+   m_Lock = xSemaphoreCreateMutexStatic(&m_LockBuffer);
+   if (m_Lock == NULL)
+   {
+      log_e("Failed to create scheduler lock.");
+      return false;
+   }
+
+   esp_timer_create_args_t timerArgs = {};
+   timerArgs.callback = &CEventScheduler::OnTimerExpired;
+   timerArgs.arg = this;
+   timerArgs.dispatch_method = ESP_TIMER_TASK;
+   timerArgs.name = "event-scheduler";
+   esp_err_t err = esp_timer_create(&timerArgs, &m_Timer);
+   if (err != ESP_OK)
+   {
+      log_e("Failed to create scheduler timer: %s", esp_err_to_name(err));
+      return false;
+   }
+   return true;
+}
+
+int CEventScheduler::AddTimer(const char *name, TaskHandle_t task, uint32_t eventBits)
+{
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   int timerId = -1;
+   if (m_TimerCount < EVENT_SCHEDULER_MAX_TIMERS)
+   {
+      timerId = m_TimerCount++;
+      timer_entry_t &entry = m_Timers[timerId];
+      entry.name = name;
+      entry.task = task;
+      entry.event_bits = eventBits;
+      entry.deadline = CTimerDeadline();
+   }
+   xSemaphoreGive(m_Lock);
+
+   if (timerId < 0)
+   {
+      log_e("Scheduler timer table full, cannot add %s.", name);
+   }
+   return timerId;
+}
+
+bool CEventScheduler::StartPeriodic(int timerId, uint32_t periodUs)
+{
+   if (!IsValid(timerId) || periodUs == 0)
+   {
+      return false;
+   }
+
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   int64_t nowUs = NowUs();
+   m_Timers[timerId].deadline.StartPeriodic(periodUs, nowUs);
+   RearmLocked(nowUs);
+   xSemaphoreGive(m_Lock);
+   return true;
+}
+
+bool CEventScheduler::ArmAt(int timerId, int64_t dueUs)
+{
+   if (!IsValid(timerId))
+   {
+      return false;
+   }
+
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   m_Timers[timerId].deadline.ArmAt(dueUs);
+   RearmLocked(NowUs());
+   xSemaphoreGive(m_Lock);
+   return true;
+}
+
+void CEventScheduler::Stop(int timerId)
+{
+   if (!IsValid(timerId))
+   {
+      return;
+   }
+
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   m_Timers[timerId].deadline.Stop();
+   RearmLocked(NowUs());
+   xSemaphoreGive(m_Lock);
+}
+
+bool CEventScheduler::GetDueUs(int timerId, int64_t &dueUs)
+{
+   if (!IsValid(timerId))
+   {
+      return false;
+   }
+
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   bool armed = m_Timers[timerId].deadline.IsArmed();
+   dueUs = m_Timers[timerId].deadline.GetDueUs();
+   xSemaphoreGive(m_Lock);
+   return armed;
+}
+
+bool CEventScheduler::TakeStats(int timerId, scheduler_timer_stats_t &stats)
+{
+   if (!IsValid(timerId))
+   {
+      return false;
+   }
+
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   m_Timers[timerId].deadline.TakeStats(stats);
+   xSemaphoreGive(m_Lock);
+   return true;
+}
+
+void CEventScheduler::LogStats()
+{
+   for (int timerId = 0; timerId < m_TimerCount; timerId++)
+   {
+      scheduler_timer_stats_t stats;
+      if (!TakeStats(timerId, stats) || stats.fires == 0)
+      {
+         continue;
+      }
+      log_i("Timer %s: fires=%u overruns=%u late(avg=%u max=%u)us jitter(avg=%u max=%u)us",
+            m_Timers[timerId].name, stats.fires, stats.overruns,
+            (uint32_t)(stats.total_late_us / stats.fires), stats.max_late_us,
+            (uint32_t)(stats.total_jitter_us / stats.fires), stats.max_jitter_us);
+   }
+}
+
+int64_t CEventScheduler::NowUs()
+{
+   return esp_timer_get_time();
+}
+
+uint32_t CEventScheduler::WaitForEvents(TickType_t timeout, scheduler_load_t *load)
+{
+   uint32_t events = 0;
+   int64_t blockStartUs = NowUs();
+   if (xTaskNotifyWait(0, UINT32_MAX, &events, timeout) != pdTRUE)
+   {
+      events = 0;
+   }
+   if (load != nullptr)
+   {
+      if (load->window_start_us == 0)
+      {
+         load->window_start_us = blockStartUs;
+      }
+      load->idle_us += NowUs() - blockStartUs;
+   }
+   return events;
+}
+
+float CEventScheduler::TakeBusyPercent(scheduler_load_t &load)
+{
+   int64_t nowUs = NowUs();
+   int64_t windowUs = nowUs - load.window_start_us;
+   float busyPercent = 0.0f;
+   if (load.window_start_us != 0 && windowUs > 0)
+   {
+      busyPercent = 100.0f * (float)(windowUs - load.idle_us) / (float)windowUs;
+   }
+   load.window_start_us = nowUs;
+   load.idle_us = 0;
+   return busyPercent;
+}
+
+void CEventScheduler::OnTimerExpired(void *arg)
+{
+   static_cast<CEventScheduler *>(arg)->Dispatch();
+}
+
+void CEventScheduler::Dispatch()
+{
+   TaskHandle_t tasks[EVENT_SCHEDULER_MAX_TIMERS];
+   uint32_t events[EVENT_SCHEDULER_MAX_TIMERS];
+   int notifyCount = 0;
+
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   int64_t nowUs = NowUs();
+   for (int timerId = 0; timerId < m_TimerCount; timerId++)
+   {
+      timer_entry_t &entry = m_Timers[timerId];
+      if (!entry.deadline.IsDue(nowUs, EVENT_SCHEDULER_MIN_ARM_US))
+      {
+         continue;
+      }
+      entry.deadline.Fire(nowUs);
+
+      tasks[notifyCount] = entry.task;
+      events[notifyCount] = entry.event_bits;
+      notifyCount++;
+   }
+   RearmLocked(nowUs);
+   xSemaphoreGive(m_Lock);
+
+   // Notify outside the lock so woken tasks can call back into the scheduler.
+   for (int i = 0; i < notifyCount; i++)
+   {
+      xTaskNotify(tasks[i], events[i], eSetBits);
+   }
+}
+
+void CEventScheduler::RearmLocked(int64_t nowUs)
+{
+   int64_t nextDueUs = INT64_MAX;
+   for (int timerId = 0; timerId < m_TimerCount; timerId++)
+   {
+      const CTimerDeadline &deadline = m_Timers[timerId].deadline;
+      if (deadline.IsArmed() && deadline.GetDueUs() < nextDueUs)
+      {
+         nextDueUs = deadline.GetDueUs();
+      }
+   }
+
+   esp_timer_stop(m_Timer);
+   if (nextDueUs == INT64_MAX)
+   {
+      return;
+   }
+
+   int64_t delayUs = nextDueUs - nowUs;
+   if (delayUs < EVENT_SCHEDULER_MIN_ARM_US)
+   {
+      delayUs = EVENT_SCHEDULER_MIN_ARM_US;
+   }
+   esp_timer_start_once(m_Timer, (uint64_t)delayUs);
+}
+
+bool CEventScheduler::IsValid(int timerId) const
+{
+   return (timerId >= 0) && (timerId < m_TimerCount);
+}
+
+#endif // ARDUINO
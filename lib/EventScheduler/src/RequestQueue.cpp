@@ -0,0 +1,139 @@
+/**
+ * @file RequestQueue.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the request queue and class-priority dispatcher.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "RequestQueue.h"
+#include <string.h>
+
+CRequestQueue::CRequestQueue()
+   : m_Depth(0), m_Head(0), m_Count(0), m_ClassCount(0), m_TokensUpdatedUs(0)
+{
+   memset(m_Class, 0, sizeof(m_Class));
+   memset(m_SinceUs, 0, sizeof(m_SinceUs));
+   memset(m_Limits, 0, sizeof(m_Limits));
+   memset(m_Tokens, 0, sizeof(m_Tokens));
+}
+
+void CRequestQueue::Reset(uint8_t depth, const request_class_limit_t *limits, uint8_t classCount, int64_t nowUs)
+{
+   m_Depth = (depth > REQUEST_QUEUE_MAX_DEPTH) ? REQUEST_QUEUE_MAX_DEPTH : depth;
+   m_ClassCount = (classCount > REQUEST_QUEUE_MAX_CLASSES) ? REQUEST_QUEUE_MAX_CLASSES : classCount;
+   for (uint8_t i = 0; i < m_ClassCount; i++)
+   {
+      m_Limits[i] = limits[i];
+      m_Tokens[i] = limits[i].burst;
+   }
+   m_TokensUpdatedUs = nowUs;
+   Clear();
+}
+
+void CRequestQueue::Clear()
+{
+   m_Head = 0;
+   m_Count = 0;
+}
+
+uint8_t CRequestQueue::Push(uint8_t requestClass, int64_t nowUs)
+{
+   if (IsFull()) return m_Depth;
+   uint8_t tail = (m_Head + m_Count) % m_Depth;
+   m_Class[tail] = requestClass;
+   m_SinceUs[tail] = nowUs;
+   m_Count++;
+   return tail;
+}
+
+void CRequestQueue::Pop()
+{
+   if (m_Count == 0) return;
+   m_Head = (m_Head + 1) % m_Depth;
+   m_Count--;
+}
+
+uint8_t CRequestQueue::GetHeadSlot() const
+{
+   return m_Head;
+}
+
+uint8_t CRequestQueue::GetHeadClass() const
+{
+   return m_Class[m_Head];
+}
+
+int64_t CRequestQueue::GetHeadSinceUs() const
+{
+   return m_SinceUs[m_Head];
+}
+
+uint8_t CRequestQueue::GetCount() const
+{
+   return m_Count;
+}
+
+bool CRequestQueue::IsEmpty() const
+{
+   return m_Count == 0;
+}
+
+bool CRequestQueue::IsFull() const
+{
+   return m_Count >= m_Depth;
+}
+
+bool CRequestQueue::Admit(uint8_t requestClass, int64_t nowUs)
+{
+   float elapsedS = (nowUs - m_TokensUpdatedUs) / 1000000.0f;
+   m_TokensUpdatedUs = nowUs;
+   for (uint8_t i = 0; i < m_ClassCount; i++)
+   {
+      m_Tokens[i] += elapsedS * m_Limits[i].rate_hz;
+      if (m_Tokens[i] > m_Limits[i].burst) m_Tokens[i] = m_Limits[i].burst;
+   }
+
+   // Classes without a bucket are not limited
+   if (requestClass >= m_ClassCount || m_Limits[requestClass].rate_hz == 0) return true;
+   if (m_Tokens[requestClass] < 1.0f) return false;
+   m_Tokens[requestClass] -= 1.0f;
+   return true;
+}
+
+uint32_t CRequestQueue::GetRetryAfterMs(uint8_t requestClass) const
+{
+   if (requestClass >= m_ClassCount || m_Limits[requestClass].rate_hz == 0) return 0;
+   return (uint32_t)((1.0f - m_Tokens[requestClass]) * 1000.0f / m_Limits[requestClass].rate_hz) + 1;
+}
+
+CRequestDispatcher::CRequestDispatcher()
+   : m_Next(0)
+{
+}
+
+int CRequestDispatcher::Select(CRequestQueue *const *queues, uint8_t count)
+{
+   if (count == 0) return -1;
+   int best = -1;
+   uint8_t bestClass = 0;
+   for (uint8_t offset = 0; offset < count; offset++)
+   {
+      uint8_t i = (m_Next + offset) % count;
+      const CRequestQueue *queue = queues[i];
+      if (queue == NULL || queue->IsEmpty()) continue;
+      if (best < 0 || queue->GetHeadClass() < bestClass)
+      {
+         best = i;
+         bestClass = queue->GetHeadClass();
+      }
+   }
+   if (best >= 0)
+   {
+      m_Next = (best + 1) % count;
+   }
+   return best;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file StreamPacer.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the stream subscriber pacing.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "StreamPacer.h"
+
+CStreamPacer::CStreamPacer()
+   : m_PeriodUs(0), m_EffectivePeriodUs(0), m_DueUs(0), m_CleanFrames(0), m_Adaptive(false)
+{
+}
+
+void CStreamPacer::Start(uint32_t periodUs, bool adaptive, int64_t nowUs)
+{
+   m_Adaptive = adaptive;
+   m_PeriodUs = periodUs;
+   m_EffectivePeriodUs = periodUs;
+   m_CleanFrames = 0;
+   m_DueUs = nowUs;
+}
+
+void CStreamPacer::SetPeriod(uint32_t periodUs, int64_t nowUs)
+{
+   if (periodUs == m_PeriodUs)
+   {
+      return;
+   }
+   // A faster stream starts right away rather than waiting out the old period
+   if (periodUs < m_PeriodUs)
+   {
+      m_DueUs = nowUs;
+   }
+   m_PeriodUs = periodUs;
+   m_EffectivePeriodUs = periodUs;
+   m_CleanFrames = 0;
+}
+
+bool CStreamPacer::IsDue(int64_t nowUs) const
+{
+   // The scheduler fires deadlines up to EVENT_SCHEDULER_MIN_ARM_US early; a
+   // tick woken that early must send its frame, not wake the task again.
+   return nowUs + STREAM_PACER_EARLY_US >= m_DueUs;
+}
+
+int64_t CStreamPacer::GetDueUs() const
+{
+   return m_DueUs;
+}
+
+uint32_t CStreamPacer::GetPeriodUs() const
+{
+   return m_PeriodUs;
+}
+
+uint32_t CStreamPacer::GetEffectivePeriodUs() const
+{
+   return m_EffectivePeriodUs;
+}
+
+bool CStreamPacer::IsBackedOff() const
+{
+   return m_EffectivePeriodUs > m_PeriodUs;
+}
+
+void CStreamPacer::OnSent()
+{
+   if (m_EffectivePeriodUs > m_PeriodUs && ++m_CleanFrames >= STREAM_PACER_RECOVERY_FRAMES)
+   {
+      m_EffectivePeriodUs = (m_EffectivePeriodUs / 2 > m_PeriodUs) ? m_EffectivePeriodUs / 2 : m_PeriodUs;
+      m_CleanFrames = 0;
+   }
+}
+
+void CStreamPacer::OnSkipped()
+{
+   m_CleanFrames = 0;
+   if (m_Adaptive)
+   {
+      uint32_t maxPeriodUs = m_PeriodUs * STREAM_PACER_MAX_BACKOFF;
+      m_EffectivePeriodUs = (m_EffectivePeriodUs * 2 < maxPeriodUs) ? m_EffectivePeriodUs * 2 : maxPeriodUs;
+   }
+}
+
+void CStreamPacer::Advance(int64_t nowUs)
+{
+   // Advance from the previous deadline so the stream keeps its rate;
+   // frames that could not be sent in time are dropped, not bunched up.
+   m_DueUs += m_EffectivePeriodUs;
+   if (m_DueUs <= nowUs)
+   {
+      int64_t missedPeriods = (nowUs - m_DueUs) / m_EffectivePeriodUs + 1;
+      m_DueUs += missedPeriods * m_EffectivePeriodUs;
+   }
+}
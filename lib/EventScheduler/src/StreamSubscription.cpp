@@ -0,0 +1,127 @@
+/**
+ * @file StreamSubscription.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the stream subscriber frame decision.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "StreamSubscription.h"
+#include <math.h>
+#include <string.h>
+
+CStreamSubscription::CStreamSubscription()
+   : m_Deadband(false), m_FieldCount(0), m_HaveLastSent(false), m_HeartbeatMs(0), m_LastSentMs(0)
+{
+   memset(m_Thresholds, 0, sizeof(m_Thresholds));
+   memset(m_LastSent, 0, sizeof(m_LastSent));
+   memset(&m_Counts, 0, sizeof(stream_frame_counts_t));
+}
+
+void CStreamSubscription::Start(uint32_t periodUs, bool adaptive, int64_t nowUs, uint32_t nowMs)
+{
+   m_Pacer.Start(periodUs, adaptive, nowUs);
+   m_HaveLastSent = false;
+   m_LastSentMs = nowMs;
+   memset(&m_Counts, 0, sizeof(stream_frame_counts_t));
+}
+
+void CStreamSubscription::SetDeadband(const float *thresholds, uint8_t fieldCount, uint32_t heartbeatMs)
+{
+   if (fieldCount > STREAM_SUBSCRIPTION_MAX_FIELDS)
+   {
+      fieldCount = STREAM_SUBSCRIPTION_MAX_FIELDS;
+   }
+   m_Deadband = (thresholds != NULL && fieldCount > 0);
+   m_FieldCount = m_Deadband ? fieldCount : 0;
+   if (m_Deadband)
+   {
+      memcpy(m_Thresholds, thresholds, fieldCount * sizeof(float));
+   }
+   m_HeartbeatMs = heartbeatMs;
+   m_HaveLastSent = false;
+}
+
+void CStreamSubscription::SetPeriod(uint32_t periodUs, int64_t nowUs)
+{
+   m_Pacer.SetPeriod(periodUs, nowUs);
+}
+
+stream_frame_result_t CStreamSubscription::Tick(int64_t nowUs, uint32_t nowMs, CStreamSink &sink)
+{
+   if (!m_Pacer.IsDue(nowUs))
+   {
+      return STREAM_FRAME_NOT_DUE;
+   }
+
+   stream_frame_result_t result;
+   const float *values = m_Deadband ? sink.GetValues() : NULL;
+   if (m_Deadband && !IsFrameNeeded(values, nowMs))
+   {
+      // Nothing moved enough: no frame, no airtime
+      m_Counts.frames_suppressed++;
+      result = STREAM_FRAME_SUPPRESSED;
+   }
+   // A blocking write would stall the caller on a weak link. Skip the frame
+   // instead and, if allowed, stretch the period until the link drains.
+   else if (!sink.IsWritable())
+   {
+      m_Counts.frames_skipped++;
+      m_Pacer.OnSkipped();
+      result = STREAM_FRAME_SKIPPED;
+   }
+   else
+   {
+      sink.SendFrame();
+      m_Counts.frames_sent++;
+      if (m_Deadband)
+      {
+         memcpy(m_LastSent, values, m_FieldCount * sizeof(float));
+         m_HaveLastSent = true;
+      }
+      m_LastSentMs = nowMs;
+      m_Pacer.OnSent();
+      result = STREAM_FRAME_SENT;
+   }
+
+   m_Pacer.Advance(nowUs);
+   return result;
+}
+
+bool CStreamSubscription::IsFrameNeeded(const float *values, uint32_t nowMs) const
+{
+   if (!m_HaveLastSent) return true;
+   if (m_HeartbeatMs != 0 && nowMs - m_LastSentMs >= m_HeartbeatMs) return true;
+
+   // Compare with the last frame sent, not the last sample, so slow drift
+   // still triggers once it adds up to a threshold.
+   for (uint8_t field = 0; field < m_FieldCount; field++)
+   {
+      float threshold = m_Thresholds[field];
+      if (threshold >= 0.0f && fabsf(values[field] - m_LastSent[field]) > threshold)
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+bool CStreamSubscription::IsDeadband() const
+{
+   return m_Deadband;
+}
+
+const CStreamPacer &CStreamSubscription::GetPacer() const
+{
+   return m_Pacer;
+}
+
+stream_frame_counts_t CStreamSubscription::TakeCounts()
+{
+   stream_frame_counts_t counts = m_Counts;
+   memset(&m_Counts, 0, sizeof(stream_frame_counts_t));
+   return counts;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file TimerDeadline.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the timer deadline bookkeeping.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "TimerDeadline.h"
+#include <string.h>
+
+CTimerDeadline::CTimerDeadline() : m_PeriodUs(0), m_DueUs(0), m_LastFireUs(0), m_Armed(false)
+{
+   memset(&m_Stats, 0, sizeof(scheduler_timer_stats_t));
+}
+
+void CTimerDeadline::StartPeriodic(uint32_t periodUs, int64_t nowUs)
+{
+   // Keep the phase of a running timer when only its period changes, unless
+   // the new period ends before the pending deadline: a faster rate then
+   // takes effect one new period from now, not after the rest of the old one.
+   if (!m_Armed || m_PeriodUs == 0)
+   {
+      m_DueUs = nowUs + periodUs;
+      m_LastFireUs = 0;
+   }
+   else if (periodUs != m_PeriodUs)
+   {
+      if (nowUs + periodUs < m_DueUs)
+      {
+         m_DueUs = nowUs + periodUs;
+      }
+      // The first interval at the new period is not a jitter sample
+      m_LastFireUs = 0;
+   }
+   m_PeriodUs = periodUs;
+   m_Armed = true;
+}
+
+void CTimerDeadline::ArmAt(int64_t dueUs)
+{
+   m_PeriodUs = 0;
+   m_DueUs = dueUs;
+   m_Armed = true;
+}
+
+void CTimerDeadline::Stop()
+{
+   m_Armed = false;
+}
+
+bool CTimerDeadline::IsArmed() const
+{
+   return m_Armed;
+}
+
+int64_t CTimerDeadline::GetDueUs() const
+{
+   return m_DueUs;
+}
+
+bool CTimerDeadline::IsDue(int64_t nowUs, uint32_t earlyUs) const
+{
+   return m_Armed && m_DueUs <= nowUs + earlyUs;
+}
+
+void CTimerDeadline::Fire(int64_t nowUs)
+{
+   uint32_t lateUs = (nowUs > m_DueUs) ? (uint32_t)(nowUs - m_DueUs) : 0;
+   m_Stats.fires++;
+   m_Stats.total_late_us += lateUs;
+   if (lateUs > m_Stats.max_late_us)
+   {
+      m_Stats.max_late_us = lateUs;
+   }
+
+   if (m_PeriodUs == 0)
+   {
+      m_Armed = false;
+      return;
+   }
+
+   if (m_LastFireUs != 0)
+   {
+      int64_t deviation = (nowUs - m_LastFireUs) - (int64_t)m_PeriodUs;
+      uint32_t jitterUs = (uint32_t)((deviation < 0) ? -deviation : deviation);
+      m_Stats.total_jitter_us += jitterUs;
+      if (jitterUs > m_Stats.max_jitter_us)
+      {
+         m_Stats.max_jitter_us = jitterUs;
+      }
+   }
+   m_LastFireUs = nowUs;
+   // Advance from the deadline, not from now, so periods never drift.
+   m_DueUs += m_PeriodUs;
+   while (m_DueUs <= nowUs)
+   {
+      m_DueUs += m_PeriodUs;
+      m_Stats.overruns++;
+   }
+}
+
+void CTimerDeadline::TakeStats(scheduler_timer_stats_t &stats)
+{
+   memcpy(&stats, &m_Stats, sizeof(scheduler_timer_stats_t));
+   memset(&m_Stats, 0, sizeof(scheduler_timer_stats_t));
+}
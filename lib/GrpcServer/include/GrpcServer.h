@@ -19,6 +19,213 @@
 #include "SensorData.h"
 #include "JoystickData.h"
 #include <AccessPointHelper.h>
+#include <SocketUtil.h>
+#include <MemoryProfiler.h>
+#include <BootProfiler.h>
+#include <LatencyHistogram.h>
+#include <ImuSnapshotCache.h>
+#include <LatestValue.h>
+#include <ImuConfig.h>
+#include <StreamSubscription.h>
+#include <RequestQueue.h>
+#include <ImuSpectrum.h>
+#include <ImuEvents.h>
+#include <ImuActivity.h>
+#include <ImuHistory.h>
+#include <AuxSensors.h>
+
+/**
+ * @brief Maximum number of simultaneously connected clients.
+ */
+#define GRPC_MAX_CLIENTS 4
+
+/**
+ * @brief Longest request line accepted from a client, in bytes.
+ */
+#define GRPC_MAX_REQUEST_LENGTH 1024
+
+/**
+ * @brief Highest IMU streaming rate a client may request, in Hz.
+ */
+#define GRPC_MAX_STREAM_RATE_HZ 5000
+
+/**
+ * @brief Room reserved for a frame marker and length prefix, in bytes.
+ */
+#define GRPC_FRAME_HEADER_SIZE 24
+
+/**
+ * @brief Bytes of a JSON response gathered before they are written to the
+ *        socket. A response up to this size leaves in a single write.
+ */
+#define GRPC_RESPONSE_CHUNK_SIZE 512
+
+/**
+ * @brief Number of IMU fields a change threshold can be set on, in sample
+ *        order: acc xyz, gyro xyz, temperature.
+ */
+#define GRPC_DEADBAND_FIELDS 7
+
+/**
+ * @brief Longest silence on a change-triggered stream when the client does
+ *        not set heartbeat_ms, in milliseconds.
+ */
+#define GRPC_DEFAULT_HEARTBEAT_MS 1000
+
+/**
+ * @brief Complete requests buffered per connection. A connection with a full
+ *        queue is not read until it drains, which pushes back on the client.
+ */
+#define GRPC_MAX_PENDING_REQUESTS 4
+
+/**
+ * @brief Requests dispatched per HandleClients() call, so a burst cannot
+ *        starve the stream ticks of the same task.
+ */
+#define GRPC_MAX_REQUESTS_PER_POLL 16
+
+/**
+ * @brief Token bucket limits per connection: sustained requests per second
+ *        and burst size. Control requests are not limited.
+ */
+#define GRPC_QUERY_RATE_HZ       50
+#define GRPC_QUERY_BURST         10
+#define GRPC_DIAGNOSTIC_RATE_HZ  1
+#define GRPC_DIAGNOSTIC_BURST    3
+
+/**
+ * @brief Clock sync exchanges kept per client. The offset is taken from the
+ *        one with the shortest round trip, which had the least queueing.
+ */
+#define GRPC_CLOCK_SYNC_SAMPLES 8
+
+/**
+ * @brief Default acknowledgement policy of a joystick stream: acknowledge
+ *        after this many frames or this many milliseconds, whichever is first.
+ */
+#define GRPC_JOYSTICK_ACK_EVERY 50
+#define GRPC_JOYSTICK_ACK_MS    1000
+
+/**
+ * @brief Most bands and peaks a spectrum subscriber may ask for per channel.
+ */
+#define GRPC_SPECTRUM_MAX_BANDS 32
+#define GRPC_SPECTRUM_MAX_PEAKS 8
+
+/**
+ * @brief Largest serialized spectrum frame, in bytes.
+ */
+#define GRPC_SPECTRUM_MAX_JSON 1536
+
+/**
+ * @brief Most points a GetImuHistory response may carry.
+ */
+#define GRPC_HISTORY_MAX_POINTS 120
+
+/**
+ * @brief Default and longest time a GetNextImuSample request waits for a new
+ *        sample, in milliseconds.
+ */
+#define GRPC_LONG_POLL_DEFAULT_MS 1000
+#define GRPC_LONG_POLL_MAX_MS     30000
+
+/**
+ * @brief Default accelerometer and gyroscope read rates while the rover is
+ *        idle, in Hz. Channels configured slower keep their rate. Motion is
+ *        detected on these samples, so onset can be noticed up to one idle
+ *        period (100ms at 10Hz) after it starts.
+ */
+#define GRPC_IDLE_ACCEL_RATE_HZ 10
+#define GRPC_IDLE_GYRO_RATE_HZ  10
+
+/**
+ * @brief Request classes in priority order. Pending control requests are
+ *        dispatched before any query, queries before diagnostics.
+ */
+typedef enum {
+    GRPC_CLASS_CONTROL,      // LED, joystick and sensor configuration
+    GRPC_CLASS_QUERY,        // IMU reads and stream subscriptions
+    GRPC_CLASS_DIAGNOSTIC,   // Profiles and unknown methods
+    GRPC_CLASS_COUNT
+} grpc_request_class_t;
+
+/**
+ * @brief Admission counters per request class.
+ */
+typedef struct {
+    uint32_t handled[GRPC_CLASS_COUNT];      // Requests dispatched
+    uint32_t rejected[GRPC_CLASS_COUNT];     // Requests refused by the token bucket
+    uint32_t max_wait_us[GRPC_CLASS_COUNT];  // Longest time from arrival to dispatch
+} grpc_admission_stats_t;
+
+/**
+ * @brief Stream delivery counters.
+ */
+typedef struct {
+    uint32_t frames_sent;        // Frames written to subscribers
+    uint32_t frames_skipped;     // Frames dropped because the socket had no room
+    uint32_t frames_suppressed;  // Frames withheld because nothing changed
+    uint8_t subscribers;       // Clients currently streaming
+    uint8_t backed_off;        // Subscribers running below their requested rate
+} grpc_stream_stats_t;
+
+/**
+ * @brief Motion-adaptive rate profile. While the rover is idle the sensor
+ *        reads accel and gyro at the idle rates and streams that asked for
+ *        an idle rate run at it; on motion the configured rates return.
+ */
+typedef struct {
+    bool enabled;                // Switch profiles on detected activity
+    float idle_accel_rate_hz;    // Accelerometer read rate while idle
+    float idle_gyro_rate_hz;     // Gyroscope read rate while idle
+} grpc_motion_profile_t;
+
+/**
+ * @brief State kept for each connected client.
+ */
+typedef struct {
+    WiFiClient client;            // Client socket
+    String rxBuffer;              // Partial request line received so far
+    bool active;                  // Slot is in use
+    bool streaming;               // Client subscribed to the IMU stream
+    bool raw;                     // Frames carry the sample as raw counts, not JSON
+    unsigned int streamRate;      // Requested streaming rate in Hz
+    unsigned int idleRate;        // Streaming rate while the rover is idle, 0 to keep streamRate
+    CStreamSubscription stream;   // Pacing, deadband and frame counters (esp_timer and millis() clocks)
+    String pending[GRPC_MAX_PENDING_REQUESTS];   // Complete requests awaiting dispatch, by queue slot
+    CRequestQueue requests;       // Class, arrival time and token buckets of the pending requests (esp_timer clock)
+    int64_t requestReceivedUs;    // Arrival time of the request being processed
+    bool syncPending;             // syncT1..syncT3 hold an exchange awaiting its t4
+    int64_t syncT1;               // Client send time of the last exchange (client clock)
+    int64_t syncT2;               // Server receive time of the last exchange
+    int64_t syncT3;               // Server reply time of the last exchange
+    int64_t syncOffsetUs[GRPC_CLOCK_SYNC_SAMPLES];   // Server minus client clock per exchange
+    uint32_t syncRttUs[GRPC_CLOCK_SYNC_SAMPLES];     // Network round trip per exchange
+    uint8_t syncSamples;          // Completed exchanges held, up to GRPC_CLOCK_SYNC_SAMPLES
+    uint8_t syncNext;             // Slot the next exchange is written to
+    bool clockSynced;             // clockOffsetUs is valid
+    int64_t clockOffsetUs;        // Server minus client clock, from the best exchange
+    uint32_t clockRttUs;          // Round trip of the best exchange
+    CLatencyHistogram uplinkLatency;   // Joystick client send to server receive
+    CLatencyHistogram applyLatency;    // Joystick server receive to publication
+    bool joystickStream;          // Client opened a joystick stream
+    uint16_t ackEvery;            // Frames between acknowledgements, 0 for time only
+    uint32_t ackPeriodMs;         // Longest time between acknowledgements, 0 for count only
+    uint16_t framesSinceAck;      // Frames applied since the last acknowledgement
+    uint32_t lastAckMs;           // millis() of the last acknowledgement
+    uint32_t joystickSeq;         // Sequence number of the last frame applied
+    uint32_t joystickFrames;      // Frames applied on the stream
+    uint32_t joystickErrors;      // Frames rejected on the stream
+    bool spectrum;                // Client subscribed to the vibration spectrum
+    uint8_t spectrumBands;        // Bands per channel in each frame, 0 to send peaks
+    uint8_t spectrumPeaks;        // Peaks per channel in each frame when not sending bands
+    bool motionEvents;            // Client subscribed to motion events
+    uint32_t eventsDropped;       // Events not sent because the socket had no room
+    bool longPoll;                // A GetNextImuSample request is parked
+    uint32_t longPollAfterSeq;    // Answer with the first sample newer than this
+    int64_t longPollDeadlineUs;   // Answer with a timeout at this time
+    imu_projection_t longPollProjection; // Fields of the answer
+} grpc_connection_t;
 
 // Since full gRPC is complex for ESP32, we'll implement a simplified
 // protocol that mimics gRPC behavior but uses a lighter TCP-based approach
@@ -34,9 +241,11 @@ public:
     CGrpcServer(int port, String SSID, String password);
     
     /**
-     * @brief Set up and bring up Access Point Network
+     * @brief Make one attempt to bring up the Access Point Network
+     * 
+     * @return true if the access point is up
      */
-    void SetupNetwork();
+    bool SetupNetwork();
     
     /**
      * @brief Start the gRPC server
@@ -44,32 +253,132 @@ public:
     void StartServer();
     
     /**
-     * @brief Handle incoming client connections and requests
+     * @brief Accept new clients and process complete requests without blocking
      */
     void HandleClients();
     
     /**
-     * @brief Updates the member variable instance of IMU Sensor data
+     * @brief Send a frame to every subscriber that is due and has room in its
+     *        socket send buffer; congested subscribers are skipped, not waited on
+     */
+    void HandleStreamTick();
+    
+    /**
+     * @brief Get the earliest deadline among all stream subscribers
+     * 
+     * @param dueUs Receives the deadline in microseconds since boot
+     * @return true if a stream is active and dueUs was set
+     */
+    bool GetNextStreamDue(int64_t& dueUs);
+    
+    /**
+     * @brief Get and reset the stream delivery counters
      * 
-     * @param imu_data An instance of IMU Sensor data
+     * @return grpc_stream_stats_t Counters since the last call
      */
-    void UpdateImuData(imu_data_t imu_data);
+    grpc_stream_stats_t TakeStreamStats();
     
     /**
-     * @brief Get the latest joystick data received from client
+     * @brief Get and reset the request admission counters
+     * 
+     * @return grpc_admission_stats_t Counters since the last call
+     */
+    grpc_admission_stats_t TakeAdmissionStats();
+    
+    /**
+     * @brief Publishes a new IMU sample to the snapshot cache served to clients
+     * 
+     * @param imu_sample An IMU sample with its sequence number and timestamp
+     */
+    void UpdateImuData(const imu_sample_t& imu_sample);
+    
+    /**
+     * @brief Sensor tick period of the configuration in effect, idle rates
+     *        included
+     * 
+     * @return uint32_t Tick period in microseconds
+     */
+    uint32_t GetImuTickPeriodUs() const;
+    
+    /**
+     * @brief Get the latest joystick data received from client. Safe to call
+     *        from any task on either core.
      * 
      * @return joystick_data_t Latest joystick control data
      */
     joystick_data_t GetJoystickData();
+    
+    /**
+     * @brief Attach the memory profiler reported by the GetMemoryProfile RPC
+     * 
+     * @param profiler Profiler sampled by the owning task
+     */
+    void SetMemoryProfiler(CMemoryProfiler* profiler);
+    
+    /**
+     * @brief Attach the boot profiler reported by the GetBootProfile RPC
+     * 
+     * @param profiler Profiler marked by the boot sequence
+     */
+    void SetBootProfiler(CBootProfiler* profiler);
+    
+    /**
+     * @brief Attach the auxiliary sensor readings reported by the
+     *        GetAuxSensorData RPC
+     * 
+     * @param auxData Readings published by the sensor task
+     */
+    void SetAuxSensorData(CLatestValue<aux_sensor_data_t>* auxData);
+    
+    /**
+     * @brief Set where SetImuConfig requests are delivered
+     * 
+     * @param queue One-slot queue of imu_config_t, overwritten by each request
+     * @param task Task notified when a new configuration is queued
+     * @param eventBits Notification bits set on the task
+     */
+    void SetImuConfigTarget(QueueHandle_t queue, TaskHandle_t task, uint32_t eventBits);
 
 private:
+    /**
+     * @brief Stream sink over one subscriber's socket; the sample is encoded
+     *        and converted at most once per tick for all subscribers
+     */
+    class CImuStreamSink;
+    
+    /**
+     * @brief Accept a pending client connection into a free slot
+     */
+    void AcceptClient();
+    
+    /**
+     * @brief Read available bytes from a client and queue complete lines
+     * 
+     * @param connection Connection slot to service
+     */
+    void PollClient(grpc_connection_t& connection);
+    
+    /**
+     * @brief Dispatch queued requests, highest class first across all
+     *        connections and in arrival order within each connection
+     */
+    void DispatchRequests();
+    
+    /**
+     * @brief Map a request line to its class
+     * 
+     * @param request Request line
+     * @return grpc_request_class_t Class of the method
+     */
+    static grpc_request_class_t ClassifyRequest(const String& request);
+    
     /**
      * @brief Process incoming gRPC-like request
      * 
-     * @param client WiFi client connection
+     * @param connection Connection the request arrived on
      * @param request Raw request data
      */
-    void ProcessRequest(WiFiClient& client, String request);
+    void ProcessRequest(grpc_connection_t& connection, String request);
     
     /**
      * @brief Handle LED control requests
@@ -88,57 +397,288 @@ private:
     void HandleImuDataRequest(WiFiClient& client, String specific_param = "");
     
     /**
-     * @brief Handle joystick data from client
+     * @brief Handle a request for rolled-up IMU history: min, max and mean per
+     *        channel over a time range, at the coarsest resolution giving the
+     *        requested number of points
      * 
      * @param client WiFi client connection
+     * @param params JSON parameters {"seconds"|"from_ms","to_ms","points","channels"}
+     */
+    void HandleImuHistoryRequest(WiFiClient& client, String params);
+    
+    /**
+     * @brief Handle a long-poll for the next IMU sample. Answered at once when
+     *        the latest sample is newer than after_seq, otherwise parked until
+     *        one arrives or the timeout expires. Later requests of the client
+     *        wait behind a parked one; other clients are not held up.
+     * 
+     * @param connection Client connection
+     * @param params JSON parameters {"after_seq","timeout_ms","parameter"}
+     */
+    void HandleNextImuSample(grpc_connection_t& connection, String params);
+    
+    /**
+     * @brief Answer the parked long-polls a new sample satisfies, and those
+     *        whose timeout has expired
+     * 
+     * @param nowUs Current time on the esp_timer clock
+     */
+    void ServiceLongPolls(int64_t nowUs);
+    
+    /**
+     * @brief Answer a long-poll with the latest sample
+     * 
+     * @param connection Client connection
+     * @param projection Fields of the answer
+     */
+    void SendNextImuSample(grpc_connection_t& connection, imu_projection_t projection);
+    
+    /**
+     * @brief Handle joystick data from client
+     * 
+     * @param connection Connection the request arrived on
      * @param joystick_json JSON string containing joystick data
      */
-    void HandleJoystickData(WiFiClient& client, String joystick_json);
+    void HandleJoystickData(grpc_connection_t& connection, String joystick_json);
+    
+    /**
+     * @brief Open or close a client-streaming joystick session
+     * 
+     * @param connection Connection the request arrived on
+     * @param open true to open, false to close
+     * @param params JSON parameters {"ack_every":..,"ack_ms":..} when opening
+     */
+    void HandleJoystickStream(grpc_connection_t& connection, bool open, String params);
+    
+    /**
+     * @brief Apply one compact joystick frame "J:seq,lx,ly,rx,ry,buttons[,t_us]".
+     *        Nothing is sent back unless an acknowledgement is due or the
+     *        frame is rejected.
+     * 
+     * @param connection Connection the frame arrived on
+     * @param frame Frame fields after "J:"
+     */
+    void HandleJoystickFrame(grpc_connection_t& connection, const String& frame);
+    
+    /**
+     * @brief Stamp joystick data with its timeline, publish it and record its
+     *        latency
+     * 
+     * @param connection Connection the command arrived on
+     * @param joystickData Command to publish; timing fields are filled in
+     * @param clientSentUs Client send time on its synchronized clock, 0 if unknown
+     */
+    void PublishJoystick(grpc_connection_t& connection, joystick_data_t& joystickData, int64_t clientSentUs);
+    
+    /**
+     * @brief Send a joystick stream acknowledgement "ACK:LEN:{...}"
+     * 
+     * @param connection Connection to acknowledge
+     * @param error Error message, or NULL for a periodic acknowledgement
+     */
+    void SendJoystickAck(grpc_connection_t& connection, const char* error);
+    
+    /**
+     * @brief Handle one NTP-style clock sync exchange. The reply carries the
+     *        client's t1 with the server's receive (t2) and send (t3) times;
+     *        the client passes its receive time t4 of that reply with its next
+     *        exchange so the server can estimate the client clock offset too.
+     * 
+     * @param connection Connection the request arrived on
+     * @param params JSON parameters {"t1":..,"t4":..}
+     */
+    void HandleClockSync(grpc_connection_t& connection, String params);
+    
+    /**
+     * @brief Handle a request for the per-client command latency histograms
+     * 
+     * @param client WiFi client to send the report to
+     */
+    void HandleLatencyStatsRequest(WiFiClient& client);
     
     /**
      * @brief Handle streaming IMU data request
      * 
+     * @param connection Connection subscribing to the stream
+     * @param params Streaming parameters (rate, adaptive, deadband, heartbeat_ms)
+     */
+    void HandleStreamImuData(grpc_connection_t& connection, String params);
+    
+    /**
+     * @brief Subscribe to or stop the vibration spectrum stream. The analysis
+     *        settings are shared by all subscribers; the latest request sets them.
+     * 
+     * @param connection Connection subscribing to the stream
+     * @param params JSON parameters {"size","overlap","window","channels","bands"|"peaks","stop"}
+     */
+    void HandleStreamSpectrum(grpc_connection_t& connection, String params);
+    
+    /**
+     * @brief Send the spectrum of the window just analyzed to every subscriber
+     *        with room in its socket send buffer
+     */
+    void SendSpectrumFrames();
+    
+    /**
+     * @brief End every spectrum stream with an error, when a sensor
+     *        configuration change leaves the analyzed channels unusable
+     * 
+     * @param reason Why the analysis cannot continue
+     */
+    void StopSpectrumStreams(const char* reason);
+    
+    /**
+     * @brief Subscribe to or stop motion events, optionally replacing the
+     *        rules, which are shared by all subscribers
+     * 
+     * @param connection Connection subscribing to the events
+     * @param params JSON parameters {"rules":[{"type","threshold","clear","hold_ms"}],"stop"}
+     */
+    void HandleStreamMotionEvents(grpc_connection_t& connection, String params);
+    
+    /**
+     * @brief Send a motion event "EVENT:LEN:{...}" to every subscriber
+     * 
+     * @param event Event to send
+     */
+    void SendMotionEvent(const imu_event_t& event);
+    
+    /**
+     * @brief Handle a motion profile request: enable or disable switching
+     *        between the idle and configured rates and set the detector
+     *        thresholds
+     * 
      * @param client WiFi client connection
-     * @param params Streaming parameters (rate, duration, etc.)
+     * @param params JSON object with the fields to change
      */
-    void HandleStreamImuData(WiFiClient& client, String params);
+    void HandleSetMotionProfile(WiFiClient& client, String params);
     
     /**
-     * @brief Send response in gRPC-like format
+     * @brief Sensor configuration for the current activity: the configured
+     *        one, with the idle read rates while the profile has the rover idle
+     * 
+     * @return imu_config_t Configuration to apply
+     */
+    imu_config_t GetEffectiveImuConfig() const;
+    
+    /**
+     * @brief Hand the effective configuration to the sensor task and restart
+     *        the rate-dependent analysis
+     */
+    void ApplyImuConfig();
+    
+    /**
+     * @brief Derive a subscriber's stream period from its rates and the
+     *        current activity
+     * 
+     * @param connection Streaming connection
+     */
+    void UpdateStreamPeriod(grpc_connection_t& connection);
+    
+    /**
+     * @brief Handle memory profile request
      * 
      * @param client WiFi client connection
-     * @param response Response data
      */
-    void SendResponse(WiFiClient& client, String response);
+    void HandleMemoryProfileRequest(WiFiClient& client);
+    
+    /**
+     * @brief Handle boot profile request
+     * 
+     * @param client WiFi client connection
+     */
+    void HandleBootProfileRequest(WiFiClient& client);
+    
+    /**
+     * @brief Handle a request for the magnetometer and power monitor readings
+     * 
+     * @param client WiFi client connection
+     */
+    void HandleAuxSensorRequest(WiFiClient& client);
+    
+    /**
+     * @brief Handle IMU configuration request
+     * 
+     * @param client WiFi client connection
+     * @param params JSON object with the fields to change
+     */
+    void HandleSetImuConfig(WiFiClient& client, String params);
     
     /**
-     * @brief Send streaming data packet
+     * @brief Serialize a JSON document as a response in gRPC-like format,
+     *        through a fixed buffer instead of a String
      * 
      * @param client WiFi client connection
+     * @param doc Response document
+     */
+    void SendJson(WiFiClient& client, const JsonDocument& doc);
+    
+    /**
+     * @brief Send an already serialized response in gRPC-like format
+     * 
+     * @param client WiFi client connection
+     * @param response Response data
+     * @param length Length of the response data
+     */
+    void SendResponse(WiFiClient& client, const char* response, size_t length);
+    
+    /**
+     * @brief Send an already serialized streaming data packet
+     * 
+     * @param connection Streaming connection
      * @param data Data to stream
+     * @param length Length of the data
      * @param isLast True if this is the last packet in stream
      */
-    void SendStreamData(WiFiClient& client, String data, bool isLast = false);
+    void SendStreamData(grpc_connection_t& connection, const char* data, size_t length, bool isLast = false);
+    
+    /**
+     * @brief Write a length-prefixed frame to a client
+     * 
+     * @param client WiFi client connection
+     * @param marker Frame marker placed before the length ("" for responses)
+     * @param data Frame payload
+     * @param length Length of the payload
+     */
+    void WriteFrame(WiFiClient& client, const char* marker, const char* data, size_t length);
 
     // Server configuration
     int m_Port;
     WiFiServer m_Server;
     CAccessPointHelper m_AccessPoint;
     
-    // Local instance data of IMU Sensor output
-    imu_data_t m_ImuData;
-    
-    // Local instance data of Joystick control input
-    joystick_data_t m_JoystickData;
+    // Latest joystick control input, readable from any task
+    CLatestValue<joystick_data_t> m_JoystickData;
     
     // Server running state
     bool m_ServerRunning;
     
-    // Streaming state
-    WiFiClient m_StreamingClient;
-    bool m_IsStreaming;
-    unsigned long m_LastStreamTime;
-    unsigned int m_StreamingRate;  // Streaming rate in Hz
+    // Connected clients
+    grpc_connection_t m_Connections[GRPC_MAX_CLIENTS];
+    
+    // Memory budget and boot profilers, owned by the caller
+    CMemoryProfiler* m_MemoryProfiler;
+    CBootProfiler* m_BootProfiler;
+    
+    // Auxiliary I2C sensor readings, owned by the caller
+    CLatestValue<aux_sensor_data_t>* m_AuxSensorData;
+    
+    // IMU configuration mailbox of the sensor task
+    imu_config_t m_ImuConfig;          // Last accepted configuration
+    QueueHandle_t m_ImuConfigQueue;
+    TaskHandle_t m_ImuConfigTask;
+    uint32_t m_ImuConfigEvent;
+    
+    // Request admission
+    CRequestDispatcher m_Dispatcher;       // Connection served next, rotating on ties
+    grpc_admission_stats_t m_AdmissionStats;
+    
+    // Motion rules evaluated on every sample while a client subscribes
+    CImuEventEngine m_MotionEvents;
+    
+    // Idle/active rate switching
+    grpc_motion_profile_t m_MotionProfile;
+    CImuActivityDetector m_Activity;
 };
 
 #endif // !GRPC_SERVER_H
\ No newline at end of file
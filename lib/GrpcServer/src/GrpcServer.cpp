@@ -11,6 +11,9 @@
 
 #include "GrpcServer.h"
 #include <ArduinoJson.h>
+#include <esp_timer.h>
+#include <JsonPoolAllocator.h>
+#include <ImuSnapshotCache.h>
 
 // gRPC-like message types
 #define MSG_LED_ON "TurnLedOn"
@@ -19,25 +22,164 @@
 #define MSG_GET_SPECIFIC_IMU "GetSpecificImuData"
 #define MSG_SEND_JOYSTICK "SendJoystickData"
 #define MSG_STREAM_IMU "StreamImuData"
+#define MSG_GET_MEMORY_PROFILE "GetMemoryProfile"
+#define MSG_GET_BOOT_PROFILE "GetBootProfile"
+#define MSG_SET_IMU_CONFIG "SetImuConfig"
+#define MSG_SYNC_CLOCK "SyncClock"
+#define MSG_OPEN_JOYSTICK_STREAM "OpenJoystickStream"
+#define MSG_CLOSE_JOYSTICK_STREAM "CloseJoystickStream"
+#define MSG_JOYSTICK_FRAME "J"
+#define MSG_GET_LATENCY_STATS "GetLatencyStats"
+#define MSG_STREAM_SPECTRUM "StreamSpectrum"
+#define MSG_STREAM_MOTION_EVENTS "StreamMotionEvents"
+#define MSG_SET_MOTION_PROFILE "SetMotionProfile"
+#define MSG_GET_IMU_HISTORY "GetImuHistory"
+#define MSG_GET_NEXT_IMU "GetNextImuSample"
+#define MSG_GET_AUX_SENSORS "GetAuxSensorData"
+
+// Turns a numeric limit into a literal so error messages follow the header
+#define GRPC_STRINGIFY_(value) #value
+#define GRPC_STRINGIFY(value) GRPC_STRINGIFY_(value)
+
+// Request class of each method; methods not listed are diagnostics
+static const struct {
+    const char* method;
+    grpc_request_class_t requestClass;
+} REQUEST_CLASSES[] = {
+    {MSG_LED_ON, GRPC_CLASS_CONTROL},
+    {MSG_LED_OFF, GRPC_CLASS_CONTROL},
+    {MSG_SEND_JOYSTICK, GRPC_CLASS_CONTROL},
+    {MSG_SET_IMU_CONFIG, GRPC_CLASS_CONTROL},
+    {MSG_SET_MOTION_PROFILE, GRPC_CLASS_CONTROL},
+    {MSG_SYNC_CLOCK, GRPC_CLASS_CONTROL},
+    {MSG_JOYSTICK_FRAME, GRPC_CLASS_CONTROL},
+    {MSG_OPEN_JOYSTICK_STREAM, GRPC_CLASS_CONTROL},
+    {MSG_CLOSE_JOYSTICK_STREAM, GRPC_CLASS_CONTROL},
+    {MSG_GET_ALL_IMU, GRPC_CLASS_QUERY},
+    {MSG_GET_SPECIFIC_IMU, GRPC_CLASS_QUERY},
+    {MSG_STREAM_IMU, GRPC_CLASS_QUERY},
+    {MSG_STREAM_SPECTRUM, GRPC_CLASS_QUERY},
+    {MSG_STREAM_MOTION_EVENTS, GRPC_CLASS_QUERY},
+    {MSG_GET_IMU_HISTORY, GRPC_CLASS_QUERY},
+    {MSG_GET_NEXT_IMU, GRPC_CLASS_QUERY},
+    {MSG_GET_AUX_SENSORS, GRPC_CLASS_QUERY},
+};
+
+// Token bucket per class; a rate of 0 is unlimited
+static const request_class_limit_t CLASS_LIMITS[GRPC_CLASS_COUNT] = {
+    {0, 0},
+    {GRPC_QUERY_RATE_HZ, GRPC_QUERY_BURST},
+    {GRPC_DIAGNOSTIC_RATE_HZ, GRPC_DIAGNOSTIC_BURST},
+};
+static_assert(GRPC_CLASS_COUNT <= REQUEST_QUEUE_MAX_CLASSES, "request classes exceed the queue");
+static_assert(GRPC_MAX_PENDING_REQUESTS <= REQUEST_QUEUE_MAX_DEPTH, "pending requests exceed the queue");
+
+// Deadband keys accepted by StreamImuData, in sample order
+static const char* const DEADBAND_KEYS[GRPC_DEADBAND_FIELDS] = {
+    "acc_x", "acc_y", "acc_z", "gyro_x", "gyro_y", "gyro_z", "temperature"
+};
+static_assert(GRPC_DEADBAND_FIELDS <= STREAM_SUBSCRIPTION_MAX_FIELDS, "deadband fields exceed the subscription");
+
+/**
+ * @brief Parse a channel selection: "acc", "gyro", a field name or an array
+ *        of them.
+ * 
+ * @param channels Selection from a request
+ * @param mask Receives the channels as a bit mask in sample order
+ * @return true if every name is known
+ */
+static bool ParseChannels(JsonVariantConst channels, uint8_t& mask)
+{
+    mask = 0;
+    bool isList = channels.is<JsonArrayConst>();
+    JsonArrayConst list = channels.as<JsonArrayConst>();
+    size_t count = isList ? list.size() : 1;
+    for (size_t item = 0; item < count; item++)
+    {
+        String name = isList ? list[item].as<String>() : channels.as<String>();
+        uint8_t bits = (name == "acc") ? 0x07 : (name == "gyro") ? 0x38 : 0;
+        for (int field = 0; bits == 0 && field < GRPC_DEADBAND_FIELDS; field++)
+        {
+            if (name == DEADBAND_KEYS[field]) bits = 1 << field;
+        }
+        if (bits == 0) return false;
+        mask |= bits;
+    }
+    return true;
+}
+
+/**
+ * @brief Rate at which analyzed channels reach the spectrum. The sensor task
+ *        ticks at the fastest read rate and repeats the last reading of a
+ *        slower channel on the ticks between its reads, so such a channel
+ *        would be analyzed as a staircase at the wrong rate and is refused.
+ * 
+ * @param config Sensor configuration in effect
+ * @param channels Analyzed channels as a bit mask in sample order
+ * @param rateHz Receives the read rate of the channels
+ * @param error Receives the reason the channels cannot be analyzed
+ * @return true if every channel is read on every tick
+ */
+static bool GetSpectrumRateHz(const imu_config_t& config, uint8_t channels, float& rateHz, const char*& error)
+{
+    float fastestHz = max(config.accel_rate_hz, max(config.gyro_rate_hz, config.temperature_rate_hz));
+    for (int channel = 0; channel < IMU_CHANNEL_COUNT; channel++)
+    {
+        if (!(channels & (1 << channel))) continue;
+        float channelHz = (channel <= IMU_CHANNEL_ACC_Z) ? config.accel_rate_hz :
+                          (channel <= IMU_CHANNEL_GYRO_Z) ? config.gyro_rate_hz : config.temperature_rate_hz;
+        if (channelHz <= 0.0f)
+        {
+            error = "channel is not read";
+            return false;
+        }
+        if (channelHz < fastestHz)
+        {
+            error = "channel is read below the tick rate";
+            return false;
+        }
+    }
+    rateHz = fastestHz;
+    return true;
+}
+
+// Spectrum analyzer shared by all subscribers. Its sample history is kept
+// out of the server object, which may live on the server task's stack.
+static CImuSpectrum s_Spectrum;
+
+// Rolled-up history of every sample, kept out of the server object for the
+// same reason.
+static CImuHistory s_History;
 
 CGrpcServer::CGrpcServer(int port, String SSID, String password) 
     : m_Port(port), m_Server(port), m_AccessPoint(SSID, password), m_ServerRunning(false),
-      m_IsStreaming(false), m_LastStreamTime(0), m_StreamingRate(10)
+      m_MemoryProfiler(nullptr), m_BootProfiler(nullptr), m_AuxSensorData(nullptr),
+      m_ImuConfig(CImuConfig::Default()), m_ImuConfigQueue(NULL), m_ImuConfigTask(NULL), m_ImuConfigEvent(0)
 {
-    memset(&m_ImuData, 0, sizeof(imu_data_t));
-    memset(&m_JoystickData, 0, sizeof(joystick_data_t));
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        m_Connections[i].active = false;
+        m_Connections[i].streaming = false;
+        m_Connections[i].spectrum = false;
+        m_Connections[i].motionEvents = false;
+    }
+    memset(&m_AdmissionStats, 0, sizeof(grpc_admission_stats_t));
+    m_MotionProfile.enabled = false;
+    m_MotionProfile.idle_accel_rate_hz = GRPC_IDLE_ACCEL_RATE_HZ;
+    m_MotionProfile.idle_gyro_rate_hz = GRPC_IDLE_GYRO_RATE_HZ;
 }
 
-void CGrpcServer::SetupNetwork()
+bool CGrpcServer::SetupNetwork()
 {
-    // Wait till Access Point is setup
-    while (!m_AccessPoint.SetupAccessPoint())
+    // The caller retries on its own schedule instead of sleeping here
+    if (!m_AccessPoint.SetupAccessPoint())
     {
-        log_e("AP Setup Failed. Waiting to retry...");
-        delay(100);
+        log_e("AP Setup Failed.");
+        return false;
     }
     
     log_i("AP IP Address: %s", m_AccessPoint.GetAccessPointIP().toString().c_str());
+    return true;
 }
 
 void CGrpcServer::StartServer()
@@ -51,77 +193,355 @@ void CGrpcServer::HandleClients()
 {
     if (!m_ServerRunning) return;
     
-    // Handle streaming to existing client
-    if (m_IsStreaming && m_StreamingClient.connected())
+    // Handle new client connections
+    AcceptClient();
+    
+    // Read every connected client without waiting on any of them, then
+    // dispatch what arrived by priority
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        if (m_Connections[i].active)
+        {
+            PollClient(m_Connections[i]);
+        }
+    }
+    // Expired long-polls are answered first so the requests behind them
+    // can be dispatched in this round
+    ServiceLongPolls(esp_timer_get_time());
+    DispatchRequests();
+}
+
+void CGrpcServer::DispatchRequests()
+{
+    for (int dispatched = 0; dispatched < GRPC_MAX_REQUESTS_PER_POLL; dispatched++)
     {
-        unsigned long currentTime = millis();
-        unsigned long interval = 1000 / m_StreamingRate; // Convert Hz to ms interval
+        // Requests behind a parked long-poll keep their order and wait
+        CRequestQueue* queues[GRPC_MAX_CLIENTS];
+        for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+        {
+            grpc_connection_t& connection = m_Connections[i];
+            queues[i] = (connection.active && !connection.longPoll) ? &connection.requests : NULL;
+        }
+        int best = m_Dispatcher.Select(queues, GRPC_MAX_CLIENTS);
+        if (best < 0) return;
         
-        if (currentTime - m_LastStreamTime >= interval)
-        {
-            // Send IMU data to streaming client
-            JsonDocument doc;
-            doc["acc_x"] = m_ImuData.accX;
-            doc["acc_y"] = m_ImuData.accY;
-            doc["acc_z"] = m_ImuData.accZ;
-            doc["gyro_x"] = m_ImuData.gyroX;
-            doc["gyro_y"] = m_ImuData.gyroY;
-            doc["gyro_z"] = m_ImuData.gyroZ;
-            doc["temperature"] = m_ImuData.temperature;
-            doc["timestamp"] = currentTime;
-            doc["success"] = true;
-            
-            String streamData;
-            serializeJson(doc, streamData);
-            SendStreamData(m_StreamingClient, streamData);
+        grpc_connection_t& connection = m_Connections[best];
+        CRequestQueue& requests = connection.requests;
+        uint8_t slot = requests.GetHeadSlot();
+        grpc_request_class_t requestClass = (grpc_request_class_t)requests.GetHeadClass();
+        int64_t receivedUs = requests.GetHeadSinceUs();
+        String request = connection.pending[slot];
+        connection.pending[slot] = "";
+        requests.Pop();
+        int64_t nowUs = esp_timer_get_time();
+        uint32_t waitUs = (uint32_t)(nowUs - receivedUs);
+        
+        if (waitUs > m_AdmissionStats.max_wait_us[requestClass])
+        {
+            m_AdmissionStats.max_wait_us[requestClass] = waitUs;
+        }
+        
+        if (!requests.Admit(requestClass, nowUs))
+        {
+            // Answer in order so the client can match the error to its request
+            m_AdmissionStats.rejected[requestClass]++;
+            JsonDocument doc(CJsonPoolAllocator::Instance());
+            doc["success"] = false;
+            doc["error"] = "Rate limited";
+            doc["retry_after_ms"] = requests.GetRetryAfterMs(requestClass);
+            doc["timestamp"] = millis();
             
-            m_LastStreamTime = currentTime;
+            SendJson(connection.client, doc);
+            continue;
+        }
+        
+        m_AdmissionStats.handled[requestClass]++;
+        connection.requestReceivedUs = receivedUs;
+        log_d("Received request: %s", request.c_str());
+        ProcessRequest(connection, request);
+    }
+}
+
+grpc_request_class_t CGrpcServer::ClassifyRequest(const String& request)
+{
+    int colonIndex = request.indexOf(':');
+    String method = (colonIndex > 0) ? request.substring(0, colonIndex) : request;
+    for (const auto& entry : REQUEST_CLASSES)
+    {
+        if (method == entry.method)
+        {
+            return entry.requestClass;
         }
     }
-    else if (m_IsStreaming && !m_StreamingClient.connected())
+    return GRPC_CLASS_DIAGNOSTIC;
+}
+
+grpc_admission_stats_t CGrpcServer::TakeAdmissionStats()
+{
+    grpc_admission_stats_t stats = m_AdmissionStats;
+    memset(&m_AdmissionStats, 0, sizeof(grpc_admission_stats_t));
+    return stats;
+}
+
+class CGrpcServer::CImuStreamSink : public CStreamSink
+{
+public:
+    CImuStreamSink(CGrpcServer& server, const imu_sample_t& sample)
+        : m_Server(server), m_Sample(sample), m_Connection(NULL), m_HaveValues(false), m_Length(0)
     {
-        // Streaming client disconnected
-        log_i("Streaming client disconnected");
-        m_IsStreaming = false;
     }
     
-    // Handle new client connections
+    void SetConnection(grpc_connection_t& connection)
+    {
+        m_Connection = &connection;
+    }
+    
+    const float* GetValues() override
+    {
+        // Converted to units only if a change-triggered subscriber needs them
+        if (!m_HaveValues)
+        {
+            imu_data_t data = ImuRawToData(m_Sample.raw);
+            const float converted[GRPC_DEADBAND_FIELDS] = {
+                data.accX, data.accY, data.accZ,
+                data.gyroX, data.gyroY, data.gyroZ,
+                data.temperature,
+            };
+            memcpy(m_Values, converted, sizeof(m_Values));
+            m_HaveValues = true;
+        }
+        return m_Values;
+    }
+    
+    bool IsWritable() override
+    {
+        // WiFiClient::write() waits for buffer space, so a subscriber on a weak
+        // link would stall this task
+        return CSocketUtil::IsWritable(m_Connection->client);
+    }
+    
+    void SendFrame() override
+    {
+        if (m_Connection->raw)
+        {
+            m_Server.SendStreamData(*m_Connection, (const char*)&m_Sample, IMU_SNAPSHOT_RAW_SIZE);
+            return;
+        }
+        // Encoded once per tick, shared by every subscriber due in it
+        if (m_Length == 0)
+        {
+            m_Length = CImuSnapshotCache::Instance()->CopyJson(IMU_JSON_GRPC, IMU_PROJECTION_ALL, m_Json, sizeof(m_Json));
+        }
+        m_Server.SendStreamData(*m_Connection, m_Json, m_Length);
+    }
+    
+private:
+    CGrpcServer& m_Server;
+    const imu_sample_t m_Sample;
+    grpc_connection_t* m_Connection;
+    float m_Values[GRPC_DEADBAND_FIELDS];
+    bool m_HaveValues;
+    char m_Json[IMU_SNAPSHOT_MAX_JSON];
+    size_t m_Length;
+};
+
+void CGrpcServer::HandleStreamTick()
+{
+    int64_t nowUs = esp_timer_get_time();
+    uint32_t nowMs = millis();
+    CImuStreamSink sink(*this, CImuSnapshotCache::Instance()->GetSample());
+    
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        grpc_connection_t& connection = m_Connections[i];
+        if (!connection.active || !connection.streaming) continue;
+        sink.SetConnection(connection);
+        connection.stream.Tick(nowUs, nowMs, sink);
+    }
+}
+
+bool CGrpcServer::GetNextStreamDue(int64_t& dueUs)
+{
+    bool streaming = false;
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        const grpc_connection_t& connection = m_Connections[i];
+        if (!connection.active || !connection.streaming) continue;
+        if (!streaming || connection.stream.GetPacer().GetDueUs() < dueUs)
+        {
+            dueUs = connection.stream.GetPacer().GetDueUs();
+        }
+        streaming = true;
+    }
+    return streaming;
+}
+
+grpc_stream_stats_t CGrpcServer::TakeStreamStats()
+{
+    grpc_stream_stats_t stats;
+    memset(&stats, 0, sizeof(grpc_stream_stats_t));
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        grpc_connection_t& connection = m_Connections[i];
+        if (!connection.active || !connection.streaming) continue;
+        stream_frame_counts_t counts = connection.stream.TakeCounts();
+        stats.frames_sent += counts.frames_sent;
+        stats.frames_skipped += counts.frames_skipped;
+        stats.frames_suppressed += counts.frames_suppressed;
+        stats.subscribers++;
+        if (connection.stream.GetPacer().IsBackedOff())
+        {
+            stats.backed_off++;
+        }
+    }
+    return stats;
+}
+
+void CGrpcServer::AcceptClient()
+{
     WiFiClient client = m_Server.available();
-    if (client)
+    if (!client) return;
+    
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
     {
-        log_i("New client connected");
-        
-        while (client.connected())
+        if (!m_Connections[i].active)
+        {
+            m_Connections[i].client = client;
+            m_Connections[i].rxBuffer = "";
+            m_Connections[i].active = true;
+            m_Connections[i].streaming = false;
+            m_Connections[i].requests.Reset(GRPC_MAX_PENDING_REQUESTS, CLASS_LIMITS, GRPC_CLASS_COUNT, esp_timer_get_time());
+            m_Connections[i].syncPending = false;
+            m_Connections[i].syncSamples = 0;
+            m_Connections[i].syncNext = 0;
+            m_Connections[i].clockSynced = false;
+            m_Connections[i].uplinkLatency.Reset();
+            m_Connections[i].applyLatency.Reset();
+            m_Connections[i].joystickStream = false;
+            m_Connections[i].spectrum = false;
+            m_Connections[i].motionEvents = false;
+            m_Connections[i].longPoll = false;
+            log_i("New client connected (slot %d)", i);
+            return;
+        }
+    }
+    
+    // No free slot - refuse the connection
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    doc["success"] = false;
+    doc["error"] = "Too many clients";
+    
+    SendJson(client, doc);
+    client.stop();
+    log_e("Client rejected, all %d slots in use", GRPC_MAX_CLIENTS);
+}
+
+void CGrpcServer::PollClient(grpc_connection_t& connection)
+{
+    WiFiClient& client = connection.client;
+    
+    // Leave further bytes in the socket while the queue is full so a client
+    // that floods requests is throttled by TCP flow control
+    while (!connection.requests.IsFull() && client.available())
+    {
+        char c = (char)client.read();
+        if (c != '\n')
         {
-            if (client.available())
+            if (connection.rxBuffer.length() < GRPC_MAX_REQUEST_LENGTH)
             {
-                String request = client.readStringUntil('\n');
-                request.trim();
-                
-                if (request.length() > 0)
-                {
-                    log_d("Received request: %s", request.c_str());
-                    ProcessRequest(client, request);
-                }
+                connection.rxBuffer += c;
             }
-            
-            // Small delay to prevent blocking
-            delay(1);
+            continue;
         }
         
+        String request = connection.rxBuffer;
+        connection.rxBuffer = "";
+        request.trim();
+        
+        if (request.length() > 0)
+        {
+            uint8_t slot = connection.requests.Push(ClassifyRequest(request), esp_timer_get_time());
+            connection.pending[slot] = request;
+        }
+    }
+    
+    if (!client.connected())
+    {
+        if (connection.streaming)
+        {
+            log_i("Streaming client disconnected");
+        }
         client.stop();
+        connection.rxBuffer = "";
+        for (int i = 0; i < GRPC_MAX_PENDING_REQUESTS; i++)
+        {
+            connection.pending[i] = "";
+        }
+        connection.requests.Clear();
+        connection.active = false;
+        connection.streaming = false;
+        connection.longPoll = false;
         log_i("Client disconnected");
     }
 }
 
-void CGrpcServer::UpdateImuData(imu_data_t imuData)
+void CGrpcServer::UpdateImuData(const imu_sample_t& imuSample)
 {
-    // Make a local copy from the provided data
-    memcpy(&m_ImuData, &imuData, sizeof(imu_data_t));
+    // Publish to the snapshot cache shared by all endpoints
+    CImuSnapshotCache::Instance()->Publish(imuSample);
+    s_History.Add(imuSample);
+    ServiceLongPolls(esp_timer_get_time());
+    
+    // Motion onset restores the configured rates at once; the detector's
+    // hysteresis delays the return to the idle rates. Onset is only seen on
+    // samples read at the idle rate, so it is detected up to one idle period
+    // late, and the first fast sample follows the config mailbox round trip
+    // to the sensor task and one new tick period: a shorter period pulls the
+    // pending idle tick forward rather than waiting it out.
+    if (m_MotionProfile.enabled && m_Activity.Update(imuSample))
+    {
+        log_i("Rover %s, switching to %s rates", m_Activity.IsActive() ? "moving" : "idle",
+              m_Activity.IsActive() ? "configured" : "idle");
+        ApplyImuConfig();
+        for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+        {
+            if (m_Connections[i].active && m_Connections[i].streaming)
+            {
+                UpdateStreamPeriod(m_Connections[i]);
+            }
+        }
+    }
+    
+    // Feed the analyzers only while someone listens
+    bool spectrum = false;
+    bool motionEvents = false;
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        if (!m_Connections[i].active) continue;
+        spectrum |= m_Connections[i].spectrum;
+        motionEvents |= m_Connections[i].motionEvents;
+    }
+    
+    // Events go out with the sample that caused them, ahead of any spectrum
+    if (motionEvents)
+    {
+        imu_event_t events[IMU_EVENTS_MAX_RULES];
+        uint8_t count = m_MotionEvents.Evaluate(imuSample, events, IMU_EVENTS_MAX_RULES);
+        for (uint8_t i = 0; i < count; i++)
+        {
+            SendMotionEvent(events[i]);
+        }
+    }
+    if (spectrum && s_Spectrum.Push(imuSample))
+    {
+        SendSpectrumFrames();
+    }
 }
 
-void CGrpcServer::ProcessRequest(WiFiClient& client, String request)
+void CGrpcServer::ProcessRequest(grpc_connection_t& connection, String request)
 {
+    WiFiClient& client = connection.client;
+    
     // Parse simple gRPC-like protocol: METHOD:PARAMS
     int colonIndex = request.indexOf(':');
     String method = request;
@@ -133,8 +553,12 @@ void CGrpcServer::ProcessRequest(WiFiClient& client, String request)
         params = request.substring(colonIndex + 1);
     }
     
-    // Handle different RPC methods
-    if (method == MSG_LED_ON)
+    // Handle different RPC methods; joystick frames first as the most frequent
+    if (method == MSG_JOYSTICK_FRAME)
+    {
+        HandleJoystickFrame(connection, params);
+    }
+    else if (method == MSG_LED_ON)
     {
         HandleLedControl(client, true);
     }
@@ -150,24 +574,74 @@ void CGrpcServer::ProcessRequest(WiFiClient& client, String request)
     {
         HandleImuDataRequest(client, params);
     }
+    else if (method == MSG_GET_IMU_HISTORY)
+    {
+        HandleImuHistoryRequest(client, params);
+    }
+    else if (method == MSG_GET_NEXT_IMU)
+    {
+        HandleNextImuSample(connection, params);
+    }
+    else if (method == MSG_GET_AUX_SENSORS)
+    {
+        HandleAuxSensorRequest(client);
+    }
     else if (method == MSG_SEND_JOYSTICK)
     {
-        HandleJoystickData(client, params);
+        HandleJoystickData(connection, params);
+    }
+    else if (method == MSG_OPEN_JOYSTICK_STREAM)
+    {
+        HandleJoystickStream(connection, true, params);
+    }
+    else if (method == MSG_CLOSE_JOYSTICK_STREAM)
+    {
+        HandleJoystickStream(connection, false, params);
+    }
+    else if (method == MSG_SYNC_CLOCK)
+    {
+        HandleClockSync(connection, params);
     }
     else if (method == MSG_STREAM_IMU)
     {
-        HandleStreamImuData(client, params);
+        HandleStreamImuData(connection, params);
+    }
+    else if (method == MSG_STREAM_SPECTRUM)
+    {
+        HandleStreamSpectrum(connection, params);
+    }
+    else if (method == MSG_STREAM_MOTION_EVENTS)
+    {
+        HandleStreamMotionEvents(connection, params);
+    }
+    else if (method == MSG_GET_MEMORY_PROFILE)
+    {
+        HandleMemoryProfileRequest(client);
+    }
+    else if (method == MSG_GET_BOOT_PROFILE)
+    {
+        HandleBootProfileRequest(client);
+    }
+    else if (method == MSG_GET_LATENCY_STATS)
+    {
+        HandleLatencyStatsRequest(client);
+    }
+    else if (method == MSG_SET_IMU_CONFIG)
+    {
+        HandleSetImuConfig(client, params);
+    }
+    else if (method == MSG_SET_MOTION_PROFILE)
+    {
+        HandleSetMotionProfile(client, params);
     }
     else
     {
         // Unknown method - send error response
-        JsonDocument doc;
+        JsonDocument doc(CJsonPoolAllocator::Instance());
         doc["success"] = false;
         doc["error"] = "Unknown method: " + method;
         
-        String response;
-        serializeJson(doc, response);
-        SendResponse(client, response);
+        SendJson(client, doc);
     }
 }
 
@@ -179,208 +653,1303 @@ void CGrpcServer::HandleLedControl(WiFiClient& client, bool ledOn)
     log_i("LED turned %s", ledOn ? "ON" : "OFF");
     
     // Send response
-    JsonDocument doc;
+    JsonDocument doc(CJsonPoolAllocator::Instance());
     doc["success"] = true;
     doc["message"] = ledOn ? "LED turned ON" : "LED turned OFF";
     
-    String response;
-    serializeJson(doc, response);
-    SendResponse(client, response);
+    SendJson(client, doc);
 }
 
 void CGrpcServer::HandleImuDataRequest(WiFiClient& client, String specific_param)
 {
-    JsonDocument doc;
-    
-    if (specific_param.length() == 0)
+    imu_projection_t projection = CImuSnapshotCache::ParseProjection(specific_param);
+    if (projection == IMU_PROJECTION_INVALID)
     {
-        // Return all IMU data
-        doc["acc_x"] = m_ImuData.accX;
-        doc["acc_y"] = m_ImuData.accY;
-        doc["acc_z"] = m_ImuData.accZ;
-        doc["gyro_x"] = m_ImuData.gyroX;
-        doc["gyro_y"] = m_ImuData.gyroY;
-        doc["gyro_z"] = m_ImuData.gyroZ;
-        doc["temperature"] = m_ImuData.temperature;
+        JsonDocument doc(CJsonPoolAllocator::Instance());
+        doc["success"] = false;
         doc["timestamp"] = millis();
-        doc["success"] = true;
+        doc["error"] = "Unknown parameter: " + specific_param;
+        
+        SendJson(client, doc);
+        return;
     }
-    else
+    
+    // Encoded at most once per sample, shared with every other poller
+    char response[IMU_SNAPSHOT_MAX_JSON];
+    size_t length = CImuSnapshotCache::Instance()->CopyJson(IMU_JSON_GRPC, projection, response, sizeof(response));
+    SendResponse(client, response, length);
+    
+    log_d("Sent IMU data response: %s", response);
+}
+
+void CGrpcServer::HandleNextImuSample(grpc_connection_t& connection, String params)
+{
+    JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+    DeserializationError error = deserializeJson(paramDoc, params.length() > 0 ? params : String("{}"));
+    imu_projection_t projection = CImuSnapshotCache::ParseProjection(paramDoc["parameter"] | "");
+    uint32_t timeoutMs = paramDoc["timeout_ms"] | GRPC_LONG_POLL_DEFAULT_MS;
+    
+    if (error || projection == IMU_PROJECTION_INVALID)
     {
-        // Return specific parameter
-        doc["success"] = true;
+        JsonDocument doc(CJsonPoolAllocator::Instance());
+        doc["success"] = false;
+        doc["error"] = error ? "JSON parsing failed" : "Unknown parameter";
         doc["timestamp"] = millis();
         
-        if (specific_param == "acc")
-        {
-            doc["acc_x"] = m_ImuData.accX;
-            doc["acc_y"] = m_ImuData.accY;
-            doc["acc_z"] = m_ImuData.accZ;
-        }
-        else if (specific_param == "gyro")
-        {
-            doc["gyro_x"] = m_ImuData.gyroX;
-            doc["gyro_y"] = m_ImuData.gyroY;
-            doc["gyro_z"] = m_ImuData.gyroZ;
-        }
-        else if (specific_param == "accx")
-        {
-            doc["acc_x"] = m_ImuData.accX;
-        }
-        else if (specific_param == "accy")
-        {
-            doc["acc_y"] = m_ImuData.accY;
-        }
-        else if (specific_param == "accz")
-        {
-            doc["acc_z"] = m_ImuData.accZ;
-        }
-        else if (specific_param == "gyrox")
-        {
-            doc["gyro_x"] = m_ImuData.gyroX;
-        }
-        else if (specific_param == "gyroy")
+        SendJson(connection.client, doc);
+        return;
+    }
+    
+    // Without after_seq the latest sample is returned, to learn the sequence
+    uint32_t latest = CImuSnapshotCache::Instance()->GetSample().sequence;
+    uint32_t fallback = (latest > 0) ? latest - 1 : 0;
+    connection.longPollAfterSeq = paramDoc["after_seq"] | fallback;
+    connection.longPollProjection = projection;
+    connection.longPollDeadlineUs = esp_timer_get_time() + (int64_t)min(timeoutMs, (uint32_t)GRPC_LONG_POLL_MAX_MS) * 1000;
+    connection.longPoll = true;
+    
+    // Answered here when a newer sample exists or timeout_ms is 0
+    ServiceLongPolls(esp_timer_get_time());
+}
+
+void CGrpcServer::ServiceLongPolls(int64_t nowUs)
+{
+    uint32_t latest = CImuSnapshotCache::Instance()->GetSample().sequence;
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        grpc_connection_t& connection = m_Connections[i];
+        if (!connection.active || !connection.longPoll) continue;
+        
+        // Any other sequence is newer: an after_seq ahead of the latest one
+        // comes from before a restart and is answered rather than left waiting
+        if (latest != connection.longPollAfterSeq)
         {
-            doc["gyro_y"] = m_ImuData.gyroY;
+            connection.longPoll = false;
+            SendNextImuSample(connection, connection.longPollProjection);
         }
-        else if (specific_param == "gyroz")
+        else if (nowUs >= connection.longPollDeadlineUs)
         {
-            doc["gyro_z"] = m_ImuData.gyroZ;
+            connection.longPoll = false;
+            JsonDocument doc(CJsonPoolAllocator::Instance());
+            doc["success"] = true;
+            doc["timed_out"] = true;
+            doc["sequence"] = latest;
+            doc["timestamp"] = millis();
+            
+            SendJson(connection.client, doc);
         }
-        else if (specific_param == "temperature")
+    }
+}
+
+void CGrpcServer::SendNextImuSample(grpc_connection_t& connection, imu_projection_t projection)
+{
+    // The same cached encoding GetSpecificImuData serves, with the sequence
+    char response[IMU_SNAPSHOT_MAX_JSON];
+    size_t length = CImuSnapshotCache::Instance()->CopyJson(IMU_JSON_GRPC, projection, response, sizeof(response));
+    SendResponse(connection.client, response, length);
+}
+
+void CGrpcServer::HandleImuHistoryRequest(WiFiClient& client, String params)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+    DeserializationError error = deserializeJson(paramDoc, params.length() > 0 ? params : String("{}"));
+    
+    // {"seconds":300} ends now; from_ms/to_ms are on the sample timestamp clock
+    uint32_t nowMs = millis();
+    uint32_t seconds = paramDoc["seconds"] | 60;
+    uint32_t toMs = paramDoc["to_ms"] | nowMs;
+    uint32_t fromMs = paramDoc["from_ms"] | ((seconds * 1000UL < toMs) ? toMs - seconds * 1000UL : 0);
+    int points = paramDoc["points"] | 60;
+    uint8_t channels = 0x07;
+    
+    if (error)
+    {
+        doc["success"] = false;
+        doc["error"] = "JSON parsing failed";
+    }
+    else if (!paramDoc["channels"].isNull() && !ParseChannels(paramDoc["channels"], channels))
+    {
+        doc["success"] = false;
+        doc["error"] = "unknown channel";
+    }
+    else if (points < 1 || points > GRPC_HISTORY_MAX_POINTS || fromMs > toMs)
+    {
+        doc["success"] = false;
+        doc["error"] = "points must be between 1 and " GRPC_STRINGIFY(GRPC_HISTORY_MAX_POINTS) " and from_ms not after to_ms";
+    }
+    else
+    {
+        // Coarsest resolution with enough buckets; adjacent buckets are
+        // merged when even the finest usable one has too many
+        uint8_t level = s_History.SelectLevel(fromMs, toMs, points);
+        uint16_t count = s_History.Count(level, fromMs, toMs);
+        uint16_t group = (count + points - 1) / points;
+        if (group == 0) group = 1;
+        
+        doc["success"] = true;
+        doc["resolution_ms"] = CImuHistory::GetPeriodMs(level) * group;
+        doc["from_ms"] = fromMs;
+        doc["to_ms"] = toMs;
+        JsonArray starts = doc["start_ms"].to<JsonArray>();
+        JsonArray samples = doc["samples"].to<JsonArray>();
+        JsonObject values = doc["channels"].to<JsonObject>();
+        JsonArray mins[GRPC_DEADBAND_FIELDS];
+        JsonArray maxes[GRPC_DEADBAND_FIELDS];
+        JsonArray means[GRPC_DEADBAND_FIELDS];
+        for (int field = 0; field < GRPC_DEADBAND_FIELDS; field++)
         {
-            doc["temperature"] = m_ImuData.temperature;
+            if ((channels & (1 << field)) == 0) continue;
+            JsonObject channel = values[DEADBAND_KEYS[field]].to<JsonObject>();
+            mins[field] = channel["min"].to<JsonArray>();
+            maxes[field] = channel["max"].to<JsonArray>();
+            means[field] = channel["mean"].to<JsonArray>();
         }
-        else
+        
+        // Read in small chunks to keep the stack bounded
+        imu_history_bucket_t buckets[8];
+        imu_history_bucket_t point;
+        uint16_t inPoint = 0;
+        for (uint16_t first = 0; first < count; first += 8)
         {
-            doc["success"] = false;
-            doc["error"] = "Unknown parameter: " + specific_param;
+            uint16_t copied = s_History.Query(level, fromMs, toMs, first, buckets, 8);
+            for (uint16_t i = 0; i < copied; i++)
+            {
+                if (inPoint == 0) point = buckets[i];
+                else CImuHistory::Merge(point, buckets[i]);
+                
+                bool last = (first + i + 1 == count);
+                if (++inPoint < group && !last) continue;
+                inPoint = 0;
+                
+                starts.add(point.start_ms);
+                samples.add(point.count);
+                for (int field = 0; field < GRPC_DEADBAND_FIELDS; field++)
+                {
+                    if ((channels & (1 << field)) == 0) continue;
+                    mins[field].add(roundf(point.min[field] * 10000.0f) / 10000.0f);
+                    maxes[field].add(roundf(point.max[field] * 10000.0f) / 10000.0f);
+                    means[field].add(roundf(point.sum[field] / point.count * 10000.0f) / 10000.0f);
+                }
+            }
+            if (copied < 8) break;
         }
     }
+    doc["timestamp"] = nowMs;
     
-    String response;
-    serializeJson(doc, response);
-    SendResponse(client, response);
-    
-    log_d("Sent IMU data response: %s", response.c_str());
+    SendJson(client, doc);
 }
 
-void CGrpcServer::HandleJoystickData(WiFiClient& client, String joystick_json)
+void CGrpcServer::HandleJoystickData(grpc_connection_t& connection, String joystick_json)
 {
+    WiFiClient& client = connection.client;
+    
     if (joystick_json.length() == 0) {
-        JsonDocument response_doc;
+        JsonDocument response_doc(CJsonPoolAllocator::Instance());
         response_doc["success"] = false;
         response_doc["message"] = "Empty joystick data";
         response_doc["timestamp"] = millis();
         
-        String response;
-        serializeJson(response_doc, response);
-        SendResponse(client, response);
+        SendJson(client, response_doc);
         return;
     }
     
-    JsonDocument doc;
+    JsonDocument doc(CJsonPoolAllocator::Instance());
     DeserializationError error = deserializeJson(doc, joystick_json);
     
     if (error) {
         log_e("Joystick JSON parsing failed: %s", error.c_str());
-        JsonDocument response_doc;
+        JsonDocument response_doc(CJsonPoolAllocator::Instance());
         response_doc["success"] = false;
         response_doc["message"] = "JSON parsing failed";
         response_doc["timestamp"] = millis();
         
-        String response;
-        serializeJson(response_doc, response);
-        SendResponse(client, response);
+        SendJson(client, response_doc);
         return;
     }
     
     // Parse joystick data from JSON
-    m_JoystickData.left_x = doc["left_x"] | 0;
-    m_JoystickData.left_y = doc["left_y"] | 0;
-    m_JoystickData.right_x = doc["right_x"] | 0;
-    m_JoystickData.right_y = doc["right_y"] | 0;
-    m_JoystickData.left_button = doc["left_button"] | false;
-    m_JoystickData.right_button = doc["right_button"] | false;
-    m_JoystickData.timestamp = millis();
+    joystick_data_t joystickData;
+    joystickData.left_x = doc["left_x"] | 0;
+    joystickData.left_y = doc["left_y"] | 0;
+    joystickData.right_x = doc["right_x"] | 0;
+    joystickData.right_y = doc["right_y"] | 0;
+    joystickData.left_button = doc["left_button"] | false;
+    joystickData.right_button = doc["right_button"] | false;
+    PublishJoystick(connection, joystickData, doc["timestamp"] | (int64_t)0);
     
     log_d("Received joystick data: L(%d,%d) R(%d,%d) Btns(L:%d,R:%d)", 
-          m_JoystickData.left_x, m_JoystickData.left_y,
-          m_JoystickData.right_x, m_JoystickData.right_y,
-          m_JoystickData.left_button, m_JoystickData.right_button);
+          joystickData.left_x, joystickData.left_y,
+          joystickData.right_x, joystickData.right_y,
+          joystickData.left_button, joystickData.right_button);
     
     // Send success response
-    JsonDocument response_doc;
+    JsonDocument response_doc(CJsonPoolAllocator::Instance());
     response_doc["success"] = true;
     response_doc["message"] = "Joystick data received";
     response_doc["timestamp"] = millis();
+    response_doc["received_us"] = joystickData.received_us;
+    response_doc["applied_us"] = joystickData.applied_us;
+    if (joystickData.sent_us != 0)
+    {
+        response_doc["uplink_us"] = joystickData.received_us - joystickData.sent_us;
+    }
     
-    String response;
-    serializeJson(response_doc, response);
-    SendResponse(client, response);
+    SendJson(client, response_doc);
 }
 
 joystick_data_t CGrpcServer::GetJoystickData()
 {
-    return m_JoystickData;
+    return m_JoystickData.Load();
 }
 
-void CGrpcServer::HandleStreamImuData(WiFiClient& client, String params)
+void CGrpcServer::SetMemoryProfiler(CMemoryProfiler* profiler)
 {
-    log_i("Starting IMU data streaming for client");
+    m_MemoryProfiler = profiler;
+}
+
+void CGrpcServer::HandleMemoryProfileRequest(WiFiClient& client)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
     
-    // Parse streaming parameters (rate, duration, etc.)
-    JsonDocument paramDoc;
-    if (params.length() > 0) {
-        DeserializationError error = deserializeJson(paramDoc, params);
-        if (!error) {
-            m_StreamingRate = paramDoc["rate"] | 10; // Default 10Hz
-        }
-    }
+    if (m_MemoryProfiler == nullptr)
+    {
+        doc["success"] = false;
+        doc["error"] = "Memory profiler not available";
+    }
+    else
+    {
+        heap_sample_t latest = m_MemoryProfiler->GetLatest();
+        doc["free_heap"] = latest.free_heap;
+        doc["min_free_heap"] = latest.min_free_heap;
+        doc["largest_free_block"] = latest.largest_block;
+        
+        json_pool_stats_t pool = CJsonPoolAllocator::Instance()->GetStats();
+        doc["json_pool_bytes"] = JSON_POOL_ARENA_SIZE;
+        doc["json_pool_peak_bytes"] = pool.peak_bytes;
+        doc["json_pool_heap_fallbacks"] = pool.heap_fallbacks;
+        
+        JsonArray tasks = doc["tasks"].to<JsonArray>();
+        task_stack_info_t task;
+        for (uint8_t i = 0; m_MemoryProfiler->GetTask(i, task); i++)
+        {
+            JsonObject entry = tasks.add<JsonObject>();
+            entry["name"] = task.name;
+            entry["stack_size"] = task.stack_size;
+            entry["stack_free_min"] = task.stack_free_min;
+        }
+        
+        JsonArray history = doc["history"].to<JsonArray>();
+        heap_sample_t sample;
+        for (uint8_t age = 0; m_MemoryProfiler->GetHistory(age, sample); age++)
+        {
+            JsonObject entry = history.add<JsonObject>();
+            entry["timestamp"] = sample.timestamp;
+            entry["free_heap"] = sample.free_heap;
+            entry["largest_free_block"] = sample.largest_block;
+        }
+        doc["success"] = true;
+    }
+    doc["timestamp"] = millis();
+    
+    SendJson(client, doc);
+}
+
+void CGrpcServer::SetBootProfiler(CBootProfiler* profiler)
+{
+    m_BootProfiler = profiler;
+}
+
+void CGrpcServer::HandleBootProfileRequest(WiFiClient& client)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    
+    if (m_BootProfiler == nullptr)
+    {
+        doc["success"] = false;
+        doc["error"] = "Boot profiler not available";
+    }
+    else
+    {
+        doc["complete"] = m_BootProfiler->IsComplete();
+        JsonArray phases = doc["phases"].to<JsonArray>();
+        boot_phase_t phase;
+        for (uint8_t i = 0; m_BootProfiler->GetPhase(i, phase); i++)
+        {
+            JsonObject entry = phases.add<JsonObject>();
+            entry["name"] = phase.name;
+            entry["time_us"] = phase.time_us;
+            entry["core"] = phase.core;
+        }
+        doc["success"] = true;
+    }
+    doc["timestamp"] = millis();
+    
+    SendJson(client, doc);
+}
+
+void CGrpcServer::SetAuxSensorData(CLatestValue<aux_sensor_data_t>* auxData)
+{
+    m_AuxSensorData = auxData;
+}
+
+void CGrpcServer::HandleAuxSensorRequest(WiFiClient& client)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    
+    if (m_AuxSensorData == nullptr)
+    {
+        doc["success"] = false;
+        doc["error"] = "Aux sensors not available";
+    }
+    else
+    {
+        // A sensor that has not answered its last read is left out
+        aux_sensor_data_t data = m_AuxSensorData->Load();
+        if (data.mag_valid)
+        {
+            JsonObject mag = doc["magnetometer"].to<JsonObject>();
+            mag["x"] = data.mag[0];
+            mag["y"] = data.mag[1];
+            mag["z"] = data.mag[2];
+            mag["timestamp"] = data.mag_timestamp;
+        }
+        if (data.power_valid)
+        {
+            JsonObject power = doc["power"].to<JsonObject>();
+            power["bus_voltage"] = data.bus_voltage;
+            power["current"] = data.current;
+            power["timestamp"] = data.power_timestamp;
+        }
+        doc["success"] = true;
+    }
+    doc["timestamp"] = millis();
+    
+    SendJson(client, doc);
+}
+
+void CGrpcServer::PublishJoystick(grpc_connection_t& connection, joystick_data_t& joystickData, int64_t clientSentUs)
+{
+    joystickData.timestamp = millis();
+    
+    // The client's timestamp is on the clock it synchronized with SyncClock
+    joystickData.sent_us = (connection.clockSynced && clientSentUs != 0) ? clientSentUs + connection.clockOffsetUs : 0;
+    joystickData.received_us = connection.requestReceivedUs;
+    joystickData.applied_us = esp_timer_get_time();
+    m_JoystickData.Store(joystickData);
+    
+    if (joystickData.sent_us != 0)
+    {
+        connection.uplinkLatency.Record(joystickData.received_us - joystickData.sent_us);
+    }
+    connection.applyLatency.Record(joystickData.applied_us - joystickData.received_us);
+}
+
+void CGrpcServer::HandleJoystickStream(grpc_connection_t& connection, bool open, String params)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    
+    if (open)
+    {
+        JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+        if (params.length() > 0 && deserializeJson(paramDoc, params))
+        {
+            doc["success"] = false;
+            doc["error"] = "JSON parsing failed";
+            doc["timestamp"] = millis();
+            
+            SendJson(connection.client, doc);
+            return;
+        }
+        
+        connection.ackEvery = paramDoc["ack_every"] | GRPC_JOYSTICK_ACK_EVERY;
+        connection.ackPeriodMs = paramDoc["ack_ms"] | GRPC_JOYSTICK_ACK_MS;
+        connection.joystickStream = true;
+        connection.framesSinceAck = 0;
+        connection.lastAckMs = millis();
+        connection.joystickSeq = 0;
+        connection.joystickFrames = 0;
+        connection.joystickErrors = 0;
+        log_i("Joystick stream opened (ack every %u frames / %u ms)", connection.ackEvery, connection.ackPeriodMs);
+        
+        doc["ack_every"] = connection.ackEvery;
+        doc["ack_ms"] = connection.ackPeriodMs;
+    }
+    else
+    {
+        connection.joystickStream = false;
+        log_i("Joystick stream closed after %u frames", connection.joystickFrames);
+    }
+    
+    // The close reply doubles as the final acknowledgement
+    doc["seq"] = connection.joystickSeq;
+    doc["frames"] = connection.joystickFrames;
+    doc["errors"] = connection.joystickErrors;
+    doc["success"] = true;
+    doc["timestamp"] = millis();
+    
+    SendJson(connection.client, doc);
+}
+
+void CGrpcServer::HandleJoystickFrame(grpc_connection_t& connection, const String& frame)
+{
+    if (!connection.joystickStream)
+    {
+        SendJoystickAck(connection, "Joystick stream not open");
+        return;
+    }
+    
+    // seq,left_x,left_y,right_x,right_y,buttons[,t_us]
+    int64_t fields[7];
+    uint8_t count = 0;
+    const char* cursor = frame.c_str();
+    while (count < 7)
+    {
+        char* end;
+        fields[count] = strtoll(cursor, &end, 10);
+        if (end == cursor) break;
+        count++;
+        cursor = end;
+        if (*cursor != ',') break;
+        cursor++;
+    }
+    
+    if (count < 6 || *cursor != '\0')
+    {
+        connection.joystickErrors++;
+        SendJoystickAck(connection, "Malformed frame");
+        return;
+    }
+    
+    joystick_data_t joystickData;
+    joystickData.left_x = (int)fields[1];
+    joystickData.left_y = (int)fields[2];
+    joystickData.right_x = (int)fields[3];
+    joystickData.right_y = (int)fields[4];
+    joystickData.left_button = (fields[5] & 0x01) != 0;
+    joystickData.right_button = (fields[5] & 0x02) != 0;
+    PublishJoystick(connection, joystickData, (count == 7) ? fields[6] : 0);
+    
+    connection.joystickSeq = (uint32_t)fields[0];
+    connection.joystickFrames++;
+    connection.framesSinceAck++;
+    
+    bool countDue = (connection.ackEvery > 0 && connection.framesSinceAck >= connection.ackEvery);
+    bool timeDue = (connection.ackPeriodMs > 0 && millis() - connection.lastAckMs >= connection.ackPeriodMs);
+    if (countDue || timeDue)
+    {
+        SendJoystickAck(connection, NULL);
+    }
+}
+
+void CGrpcServer::SendJoystickAck(grpc_connection_t& connection, const char* error)
+{
+    // Fixed layout, formatted directly rather than through a JsonDocument
+    char ack[128];
+    int length;
+    if (error == NULL)
+    {
+        length = snprintf(ack, sizeof(ack), "{\"seq\":%u,\"frames\":%u,\"errors\":%u}",
+                          connection.joystickSeq, connection.joystickFrames, connection.joystickErrors);
+    }
+    else
+    {
+        length = snprintf(ack, sizeof(ack), "{\"seq\":%u,\"frames\":%u,\"errors\":%u,\"error\":\"%s\"}",
+                          connection.joystickSeq, connection.joystickFrames, connection.joystickErrors, error);
+    }
+    if (length < 0 || length >= (int)sizeof(ack)) return;
+    
+    WriteFrame(connection.client, "ACK:", ack, length);
+    connection.framesSinceAck = 0;
+    connection.lastAckMs = millis();
+}
+
+void CGrpcServer::HandleClockSync(grpc_connection_t& connection, String params)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+    DeserializationError error = deserializeJson(paramDoc, params);
+    
+    if (error || !paramDoc["t1"].is<int64_t>())
+    {
+        doc["success"] = false;
+        doc["error"] = "Expected {\"t1\":<client time in us>}";
+        doc["timestamp"] = millis();
+        
+        SendJson(connection.client, doc);
+        return;
+    }
+    
+    // Complete the previous exchange with the client's receive time of its reply
+    if (connection.syncPending && paramDoc["t4"].is<int64_t>())
+    {
+        int64_t t4 = paramDoc["t4"].as<int64_t>();
+        int64_t rttUs = (t4 - connection.syncT1) - (connection.syncT3 - connection.syncT2);
+        if (rttUs >= 0)
+        {
+            uint8_t slot = connection.syncNext;
+            connection.syncOffsetUs[slot] = ((connection.syncT2 - connection.syncT1) + (connection.syncT3 - t4)) / 2;
+            connection.syncRttUs[slot] = (uint32_t)min(rttUs, (int64_t)UINT32_MAX);
+            connection.syncNext = (slot + 1) % GRPC_CLOCK_SYNC_SAMPLES;
+            if (connection.syncSamples < GRPC_CLOCK_SYNC_SAMPLES)
+            {
+                connection.syncSamples++;
+            }
+            
+            uint8_t best = 0;
+            for (uint8_t i = 1; i < connection.syncSamples; i++)
+            {
+                if (connection.syncRttUs[i] < connection.syncRttUs[best])
+                {
+                    best = i;
+                }
+            }
+            connection.clockOffsetUs = connection.syncOffsetUs[best];
+            connection.clockRttUs = connection.syncRttUs[best];
+            connection.clockSynced = true;
+        }
+    }
+    
+    connection.syncT1 = paramDoc["t1"].as<int64_t>();
+    connection.syncT2 = connection.requestReceivedUs;
+    
+    doc["t1"] = connection.syncT1;
+    doc["t2"] = connection.syncT2;
+    doc["synced"] = connection.clockSynced;
+    if (connection.clockSynced)
+    {
+        doc["offset_us"] = connection.clockOffsetUs;
+        doc["rtt_us"] = connection.clockRttUs;
+    }
+    doc["success"] = true;
+    
+    // t3 is taken last so only serialization and the write follow it
+    connection.syncT3 = esp_timer_get_time();
+    connection.syncPending = true;
+    doc["t3"] = connection.syncT3;
+    
+    SendJson(connection.client, doc);
+}
+
+void CGrpcServer::HandleLatencyStatsRequest(WiFiClient& client)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    
+    JsonArray limits = doc["bucket_limits_us"].to<JsonArray>();
+    for (uint8_t bucket = 0; bucket < LATENCY_HISTOGRAM_BUCKETS - 1; bucket++)
+    {
+        limits.add(CLatencyHistogram::GetBucketLimitUs(bucket));
+    }
+    
+    JsonArray clients = doc["clients"].to<JsonArray>();
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        const grpc_connection_t& connection = m_Connections[i];
+        if (!connection.active) continue;
+        
+        JsonObject entry = clients.add<JsonObject>();
+        entry["client"] = i;
+        entry["synced"] = connection.clockSynced;
+        if (connection.clockSynced)
+        {
+            entry["offset_us"] = connection.clockOffsetUs;
+            entry["rtt_us"] = connection.clockRttUs;
+        }
+        
+        const struct {
+            const char* name;
+            const CLatencyHistogram& histogram;
+        } stages[] = {
+            {"uplink", connection.uplinkLatency},
+            {"apply", connection.applyLatency},
+        };
+        for (const auto& stage : stages)
+        {
+            JsonObject stats = entry[stage.name].to<JsonObject>();
+            stats["count"] = stage.histogram.GetCount();
+            stats["mean_us"] = stage.histogram.GetMeanUs();
+            stats["p50_us"] = stage.histogram.GetPercentileUs(50);
+            stats["p99_us"] = stage.histogram.GetPercentileUs(99);
+            stats["max_us"] = stage.histogram.GetMaxUs();
+            JsonArray buckets = stats["buckets"].to<JsonArray>();
+            for (uint8_t bucket = 0; bucket < LATENCY_HISTOGRAM_BUCKETS; bucket++)
+            {
+                buckets.add(stage.histogram.GetBucket(bucket));
+            }
+        }
+    }
+    doc["success"] = true;
+    doc["timestamp"] = millis();
+    
+    SendJson(client, doc);
+}
+
+void CGrpcServer::SetImuConfigTarget(QueueHandle_t queue, TaskHandle_t task, uint32_t eventBits)
+{
+    m_ImuConfigQueue = queue;
+    m_ImuConfigTask = task;
+    m_ImuConfigEvent = eventBits;
+}
+
+void CGrpcServer::HandleSetImuConfig(WiFiClient& client, String params)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+    DeserializationError error = deserializeJson(paramDoc, params);
+    
+    if (m_ImuConfigQueue == NULL)
+    {
+        doc["success"] = false;
+        doc["error"] = "IMU configuration not available";
+    }
+    else if (error)
+    {
+        doc["success"] = false;
+        doc["error"] = "JSON parsing failed";
+    }
+    else
+    {
+        // Fields left out keep their current value
+        imu_config_t config = m_ImuConfig;
+        config.accel_odr_hz = paramDoc["accel_odr_hz"] | config.accel_odr_hz;
+        config.gyro_odr_hz = paramDoc["gyro_odr_hz"] | config.gyro_odr_hz;
+        config.accel_range_g = paramDoc["accel_range_g"] | config.accel_range_g;
+        config.gyro_range_dps = paramDoc["gyro_range_dps"] | config.gyro_range_dps;
+        config.accel_rate_hz = paramDoc["accel_rate_hz"] | config.accel_rate_hz;
+        config.gyro_rate_hz = paramDoc["gyro_rate_hz"] | config.gyro_rate_hz;
+        config.temperature_rate_hz = paramDoc["temperature_rate_hz"] | config.temperature_rate_hz;
+        
+        const char* configError = "";
+        if (!CImuConfig::Normalize(config, configError))
+        {
+            doc["success"] = false;
+            doc["error"] = configError;
+        }
+        else
+        {
+            m_ImuConfig = config;
+            ApplyImuConfig();
+            log_i("IMU config requested: ODR %u/%u Hz, +-%ug/+-%udps, reads %.1f/%.1f/%.1f Hz",
+                  config.accel_odr_hz, config.gyro_odr_hz, config.accel_range_g, config.gyro_range_dps,
+                  config.accel_rate_hz, config.gyro_rate_hz, config.temperature_rate_hz);
+            doc["success"] = true;
+        }
+    }
+    
+    // Report the configuration in effect after the request
+    doc["accel_odr_hz"] = m_ImuConfig.accel_odr_hz;
+    doc["gyro_odr_hz"] = m_ImuConfig.gyro_odr_hz;
+    doc["accel_range_g"] = m_ImuConfig.accel_range_g;
+    doc["gyro_range_dps"] = m_ImuConfig.gyro_range_dps;
+    doc["accel_rate_hz"] = m_ImuConfig.accel_rate_hz;
+    doc["gyro_rate_hz"] = m_ImuConfig.gyro_rate_hz;
+    doc["temperature_rate_hz"] = m_ImuConfig.temperature_rate_hz;
+    doc["timestamp"] = millis();
+    
+    SendJson(client, doc);
+}
+
+imu_config_t CGrpcServer::GetEffectiveImuConfig() const
+{
+    imu_config_t config = m_ImuConfig;
+    if (m_MotionProfile.enabled && !m_Activity.IsActive())
+    {
+        config.accel_rate_hz = min(config.accel_rate_hz, m_MotionProfile.idle_accel_rate_hz);
+        config.gyro_rate_hz = min(config.gyro_rate_hz, m_MotionProfile.idle_gyro_rate_hz);
+    }
+    return config;
+}
+
+uint32_t CGrpcServer::GetImuTickPeriodUs() const
+{
+    return CImuConfig::GetTickPeriodUs(GetEffectiveImuConfig());
+}
+
+void CGrpcServer::ApplyImuConfig()
+{
+    if (m_ImuConfigQueue == NULL) return;
+    
+    // The sensor task applies it on its next wake-up; only the latest
+    // request matters, so an unapplied one is overwritten.
+    imu_config_t config = GetEffectiveImuConfig();
+    xQueueOverwrite(m_ImuConfigQueue, &config);
+    if (m_ImuConfigTask != NULL)
+    {
+        xTaskNotify(m_ImuConfigTask, m_ImuConfigEvent, eSetBits);
+    }
+    
+    // A window must not mix two rates, so the analysis restarts only when
+    // the read rate of its channels changes; an idle/active switch or a
+    // range change that leaves it alone keeps the samples collected.
+    if (s_Spectrum.GetChannelCount() > 0)
+    {
+        imu_spectrum_config_t spectrumConfig = s_Spectrum.GetConfig();
+        float rateHz = 0.0f;
+        const char* spectrumError = "";
+        if (!GetSpectrumRateHz(config, spectrumConfig.channels, rateHz, spectrumError))
+        {
+            StopSpectrumStreams(spectrumError);
+        }
+        else if (rateHz != spectrumConfig.sample_rate_hz)
+        {
+            spectrumConfig.sample_rate_hz = rateHz;
+            if (!s_Spectrum.Configure(spectrumConfig, spectrumError))
+            {
+                StopSpectrumStreams(spectrumError);
+            }
+        }
+    }
+}
+
+void CGrpcServer::StopSpectrumStreams(const char* reason)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    doc["success"] = false;
+    doc["error"] = reason;
+    doc["message"] = "Spectrum streaming stopped";
+    doc["timestamp"] = millis();
     
-    // Set up streaming
-    m_StreamingClient = client;
-    m_IsStreaming = true;
-    m_LastStreamTime = millis();
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        grpc_connection_t& connection = m_Connections[i];
+        if (!connection.active || !connection.spectrum) continue;
+        connection.spectrum = false;
+        SendJson(connection.client, doc);
+    }
+    log_e("Spectrum streaming stopped: %s", reason);
+}
+
+void CGrpcServer::HandleSetMotionProfile(WiFiClient& client, String params)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+    DeserializationError error = deserializeJson(paramDoc, params.length() > 0 ? params : String("{}"));
+    
+    if (error)
+    {
+        doc["success"] = false;
+        doc["error"] = "JSON parsing failed";
+    }
+    else
+    {
+        // Fields left out keep their current value
+        grpc_motion_profile_t profile = m_MotionProfile;
+        profile.enabled = paramDoc["enabled"] | profile.enabled;
+        profile.idle_accel_rate_hz = paramDoc["idle_accel_rate_hz"] | profile.idle_accel_rate_hz;
+        profile.idle_gyro_rate_hz = paramDoc["idle_gyro_rate_hz"] | profile.idle_gyro_rate_hz;
+        imu_activity_config_t thresholds = m_Activity.GetConfig();
+        thresholds.onset_accel = paramDoc["onset_accel"] | thresholds.onset_accel;
+        thresholds.onset_gyro = paramDoc["onset_gyro"] | thresholds.onset_gyro;
+        thresholds.rest_accel = paramDoc["rest_accel"] | thresholds.rest_accel;
+        thresholds.rest_gyro = paramDoc["rest_gyro"] | thresholds.rest_gyro;
+        thresholds.rest_ms = paramDoc["rest_ms"] | thresholds.rest_ms;
+        
+        // The detector needs both channels while idle to notice motion
+        const char* profileError = "";
+        if (!(profile.idle_accel_rate_hz >= 1.0f) || !(profile.idle_gyro_rate_hz >= 1.0f))
+        {
+            doc["success"] = false;
+            doc["error"] = "idle rates must be at least 1 Hz";
+        }
+        else if (!m_Activity.Configure(thresholds, profileError))
+        {
+            doc["success"] = false;
+            doc["error"] = profileError;
+        }
+        else
+        {
+            // The detector restarts active, so the configured rates apply
+            // until the rover has been quiet for rest_ms
+            m_MotionProfile = profile;
+            ApplyImuConfig();
+            for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+            {
+                if (m_Connections[i].active && m_Connections[i].streaming)
+                {
+                    UpdateStreamPeriod(m_Connections[i]);
+                }
+            }
+            log_i("Motion profile %s: idle reads %.1f/%.1f Hz", profile.enabled ? "enabled" : "disabled",
+                  profile.idle_accel_rate_hz, profile.idle_gyro_rate_hz);
+            doc["success"] = true;
+        }
+    }
+    
+    // Report the profile in effect after the request
+    const imu_activity_config_t& thresholds = m_Activity.GetConfig();
+    doc["enabled"] = m_MotionProfile.enabled;
+    doc["idle_accel_rate_hz"] = m_MotionProfile.idle_accel_rate_hz;
+    doc["idle_gyro_rate_hz"] = m_MotionProfile.idle_gyro_rate_hz;
+    doc["onset_accel"] = thresholds.onset_accel;
+    doc["onset_gyro"] = thresholds.onset_gyro;
+    doc["rest_accel"] = thresholds.rest_accel;
+    doc["rest_gyro"] = thresholds.rest_gyro;
+    doc["rest_ms"] = thresholds.rest_ms;
+    doc["moving"] = m_Activity.IsActive();
+    doc["timestamp"] = millis();
+    
+    SendJson(client, doc);
+}
+
+void CGrpcServer::UpdateStreamPeriod(grpc_connection_t& connection)
+{
+    bool idle = m_MotionProfile.enabled && !m_Activity.IsActive() && connection.idleRate > 0;
+    unsigned int rate = idle ? min(connection.idleRate, connection.streamRate) : connection.streamRate;
+    // Backoff starts over at the new rate; a faster stream starts right away
+    // so a maneuver is not missed while waiting out an idle period
+    connection.stream.SetPeriod(1000000UL / rate, esp_timer_get_time());
+}
+
+void CGrpcServer::HandleStreamImuData(grpc_connection_t& connection, String params)
+{
+    log_i("Starting IMU data streaming for client");
+    
+    // Parse streaming parameters (rate, adaptive, deadband, heartbeat_ms)
+    unsigned int rate = 10; // Default 10Hz
+    bool adaptive = true;
+    bool raw = false;
+    bool deadband = false;
+    unsigned int idleRate = 0;
+    uint32_t heartbeatMs = GRPC_DEFAULT_HEARTBEAT_MS;
+    float thresholds[GRPC_DEADBAND_FIELDS];
+    JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+    if (params.length() > 0) {
+        DeserializationError error = deserializeJson(paramDoc, params);
+        if (!error) {
+            rate = paramDoc["rate"] | 10;
+            adaptive = paramDoc["adaptive"] | true;
+            raw = (strcmp(paramDoc["format"] | "json", "raw") == 0);
+            heartbeatMs = paramDoc["heartbeat_ms"] | GRPC_DEFAULT_HEARTBEAT_MS;
+            idleRate = paramDoc["idle_rate"] | 0;
+            
+            // {"deadband":{"acc":0.05,"gyro_z":0.01}}: "acc" and "gyro" set all
+            // three axes, per-axis keys override them.
+            JsonObject deadbandDoc = paramDoc["deadband"];
+            if (!deadbandDoc.isNull()) {
+                deadband = true;
+                float acc = deadbandDoc["acc"] | -1.0f;
+                float gyro = deadbandDoc["gyro"] | -1.0f;
+                for (int field = 0; field < GRPC_DEADBAND_FIELDS; field++)
+                {
+                    float group = (field < 3) ? acc : (field < 6) ? gyro : -1.0f;
+                    thresholds[field] = deadbandDoc[DEADBAND_KEYS[field]] | group;
+                }
+            }
+        }
+    }
+    rate = constrain(rate, 1u, (unsigned int)GRPC_MAX_STREAM_RATE_HZ);
+    idleRate = min(idleRate, rate);
+    
+    // Set up streaming for this client only
+    connection.streaming = true;
+    connection.raw = raw;
+    connection.streamRate = rate;
+    connection.idleRate = idleRate;
+    connection.stream.Start(1000000UL / rate, adaptive, esp_timer_get_time(), millis());
+    connection.stream.SetDeadband(deadband ? thresholds : NULL, GRPC_DEADBAND_FIELDS, heartbeatMs);
+    UpdateStreamPeriod(connection);
     
     // Send initial response
-    JsonDocument response_doc;
+    JsonDocument response_doc(CJsonPoolAllocator::Instance());
     response_doc["success"] = true;
     response_doc["message"] = "IMU streaming started";
-    response_doc["rate"] = m_StreamingRate;
+    response_doc["rate"] = rate;
+    if (idleRate > 0) {
+        response_doc["idle_rate"] = idleRate;
+    }
+    response_doc["adaptive"] = adaptive;
+    response_doc["format"] = raw ? "raw" : "json";
+    response_doc["deadband"] = deadband;
+    if (deadband) {
+        response_doc["heartbeat_ms"] = heartbeatMs;
+    }
     response_doc["timestamp"] = millis();
     
-    String response;
-    serializeJson(response_doc, response);
-    SendResponse(client, response);
+    SendJson(connection.client, response_doc);
     
-    log_i("IMU streaming started at %d Hz", m_StreamingRate);
+    log_i("IMU streaming started at %d Hz%s%s", rate, adaptive ? " (adaptive)" : "",
+          deadband ? " (change-triggered)" : "");
 }
 
-void CGrpcServer::SendStreamData(WiFiClient& client, String data, bool isLast)
+void CGrpcServer::HandleStreamSpectrum(grpc_connection_t& connection, String params)
 {
-    if (!client.connected()) {
-        m_IsStreaming = false;
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+    DeserializationError error = deserializeJson(paramDoc, params.length() > 0 ? params : String("{}"));
+    
+    if (error)
+    {
+        doc["success"] = false;
+        doc["error"] = "JSON parsing failed";
+    }
+    else if (paramDoc["stop"] | false)
+    {
+        connection.spectrum = false;
+        doc["success"] = true;
+        doc["message"] = "Spectrum streaming stopped";
+    }
+    else
+    {
+        // Fields left out keep the current analysis settings
+        imu_spectrum_config_t config = s_Spectrum.GetConfig();
+        if (s_Spectrum.GetChannelCount() == 0)
+        {
+            config.size = 256;
+            config.overlap = 0.5f;
+            config.window = IMU_WINDOW_HANN;
+            config.channels = (1 << IMU_CHANNEL_ACC_X) | (1 << IMU_CHANNEL_ACC_Y) | (1 << IMU_CHANNEL_ACC_Z);
+        }
+        config.size = paramDoc["size"] | config.size;
+        config.overlap = paramDoc["overlap"] | config.overlap;
+        
+        const char* configError = NULL;
+        const char* window = paramDoc["window"];
+        if (window != NULL && !CImuSpectrum::ParseWindow(window, config.window))
+        {
+            configError = "unknown window";
+        }
+        
+        if (!paramDoc["channels"].isNull() && !ParseChannels(paramDoc["channels"], config.channels))
+        {
+            configError = "unknown channel";
+        }
+        
+        // Bands unless peaks are asked for
+        bool wantPeaks = !paramDoc["peaks"].isNull();
+        int bands = wantPeaks ? 0 : (paramDoc["bands"] | 16);
+        int peaks = paramDoc["peaks"] | 0;
+        if (configError == NULL && wantPeaks && (peaks < 1 || peaks > GRPC_SPECTRUM_MAX_PEAKS))
+        {
+            configError = "peaks must be between 1 and " GRPC_STRINGIFY(GRPC_SPECTRUM_MAX_PEAKS);
+        }
+        if (configError == NULL && !wantPeaks && (bands < 1 || bands > GRPC_SPECTRUM_MAX_BANDS))
+        {
+            configError = "bands must be between 1 and " GRPC_STRINGIFY(GRPC_SPECTRUM_MAX_BANDS);
+        }
+        
+        if (configError == NULL &&
+            GetSpectrumRateHz(GetEffectiveImuConfig(), config.channels, config.sample_rate_hz, configError) &&
+            s_Spectrum.Configure(config, configError))
+        {
+            connection.spectrum = true;
+            connection.spectrumBands = bands;
+            connection.spectrumPeaks = peaks;
+            doc["success"] = true;
+            doc["message"] = "Spectrum streaming started";
+            if (bands > 0)
+            {
+                doc["bands"] = bands;
+            }
+            else
+            {
+                doc["peaks"] = peaks;
+            }
+            log_i("Spectrum streaming started: %u points, hop %u, %.1f Hz bins",
+                  config.size, s_Spectrum.GetHop(), s_Spectrum.GetBinHz());
+        }
+        else
+        {
+            doc["success"] = false;
+            doc["error"] = configError;
+        }
+    }
+    
+    // Report the analysis settings in effect, shared by all subscribers
+    if (s_Spectrum.GetChannelCount() > 0)
+    {
+        const imu_spectrum_config_t& config = s_Spectrum.GetConfig();
+        doc["size"] = config.size;
+        doc["overlap"] = config.overlap;
+        doc["window"] = CImuSpectrum::GetWindowName(config.window);
+        JsonArray channels = doc["channels"].to<JsonArray>();
+        for (uint8_t slot = 0; slot < s_Spectrum.GetChannelCount(); slot++)
+        {
+            channels.add(DEADBAND_KEYS[s_Spectrum.GetChannel(slot)]);
+        }
+        doc["sample_rate_hz"] = s_Spectrum.GetSampleRateHz();
+        doc["bin_hz"] = s_Spectrum.GetBinHz();
+        doc["hop"] = s_Spectrum.GetHop();
+    }
+    doc["timestamp"] = millis();
+    
+    SendJson(connection.client, doc);
+}
+
+void CGrpcServer::SendSpectrumFrames()
+{
+    // Encoded once per output mode; subscribers asking for the same shape share it
+    char frame[GRPC_SPECTRUM_MAX_JSON];
+    size_t length = 0;
+    uint8_t encodedBands = 0;
+    uint8_t encodedPeaks = 0;
+    
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        grpc_connection_t& connection = m_Connections[i];
+        if (!connection.active || !connection.spectrum) continue;
+        // A congested subscriber misses this window; the next one supersedes it
+        if (!CSocketUtil::IsWritable(connection.client)) continue;
+        
+        if (length == 0 || connection.spectrumBands != encodedBands || connection.spectrumPeaks != encodedPeaks)
+        {
+            JsonDocument doc(CJsonPoolAllocator::Instance());
+            doc["seq"] = s_Spectrum.GetWindowCount();
+            doc["timestamp"] = s_Spectrum.GetTimestamp();
+            doc["bin_hz"] = s_Spectrum.GetBinHz();
+            JsonObject channels = doc["channels"].to<JsonObject>();
+            for (uint8_t slot = 0; slot < s_Spectrum.GetChannelCount(); slot++)
+            {
+                // Four decimals keep the frame short; finer steps are sensor noise
+                JsonArray values = channels[DEADBAND_KEYS[s_Spectrum.GetChannel(slot)]].to<JsonArray>();
+                if (connection.spectrumBands > 0)
+                {
+                    float bands[GRPC_SPECTRUM_MAX_BANDS];
+                    uint16_t count = s_Spectrum.GetBands(slot, bands, connection.spectrumBands);
+                    for (uint16_t band = 0; band < count; band++)
+                    {
+                        values.add(roundf(bands[band] * 10000.0f) / 10000.0f);
+                    }
+                }
+                else
+                {
+                    imu_spectrum_peak_t peaks[GRPC_SPECTRUM_MAX_PEAKS];
+                    uint8_t count = s_Spectrum.GetPeaks(slot, peaks, connection.spectrumPeaks);
+                    for (uint8_t peak = 0; peak < count; peak++)
+                    {
+                        JsonArray pair = values.add<JsonArray>();
+                        pair.add(roundf(peaks[peak].frequency_hz * 100.0f) / 100.0f);
+                        pair.add(roundf(peaks[peak].magnitude * 10000.0f) / 10000.0f);
+                    }
+                }
+            }
+            length = serializeJson(doc, frame, sizeof(frame));
+            encodedBands = connection.spectrumBands;
+            encodedPeaks = connection.spectrumPeaks;
+        }
+        WriteFrame(connection.client, "SPECTRUM:", frame, length);
+    }
+}
+
+void CGrpcServer::HandleStreamMotionEvents(grpc_connection_t& connection, String params)
+{
+    JsonDocument doc(CJsonPoolAllocator::Instance());
+    JsonDocument paramDoc(CJsonPoolAllocator::Instance());
+    DeserializationError error = deserializeJson(paramDoc, params.length() > 0 ? params : String("{}"));
+    
+    bool subscribed = false;
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        subscribed |= m_Connections[i].active && m_Connections[i].motionEvents;
+    }
+    
+    const char* rulesError = NULL;
+    if (error)
+    {
+        rulesError = "JSON parsing failed";
+    }
+    else if (paramDoc["stop"] | false)
+    {
+        connection.motionEvents = false;
+        doc["message"] = "Motion events stopped";
+    }
+    else
+    {
+        // {"rules":[{"type":"tilt","threshold":30,"clear":25,"hold_ms":200}]};
+        // without rules the current ones are kept
+        JsonArray list = paramDoc["rules"];
+        if (!list.isNull())
+        {
+            imu_event_rule_t rules[IMU_EVENTS_MAX_RULES];
+            uint8_t count = 0;
+            for (JsonObject item : list)
+            {
+                if (count == IMU_EVENTS_MAX_RULES)
+                {
+                    rulesError = "at most " GRPC_STRINGIFY(IMU_EVENTS_MAX_RULES) " rules";
+                    break;
+                }
+                imu_event_rule_t& rule = rules[count++];
+                if (!CImuEventEngine::ParseType(item["type"] | "", rule.type))
+                {
+                    rulesError = "unknown rule type";
+                    break;
+                }
+                rule.threshold = item["threshold"] | -1.0f;
+                rule.clear = item["clear"] | rule.threshold;
+                rule.hold_ms = item["hold_ms"] | 0;
+            }
+            if (rulesError == NULL)
+            {
+                m_MotionEvents.SetRules(rules, count, rulesError);
+            }
+        }
+        else if (!subscribed)
+        {
+            // Nothing was evaluated while no one listened
+            m_MotionEvents.Reset();
+        }
+        
+        if (rulesError == NULL)
+        {
+            connection.motionEvents = true;
+            connection.eventsDropped = 0;
+            doc["message"] = "Motion events started";
+            log_i("Motion events started with %u rules", m_MotionEvents.GetRuleCount());
+        }
+    }
+    
+    doc["success"] = (rulesError == NULL);
+    if (rulesError != NULL)
+    {
+        doc["error"] = rulesError;
+    }
+    
+    // Report the rules in effect, shared by all subscribers
+    JsonArray rules = doc["rules"].to<JsonArray>();
+    for (uint8_t i = 0; i < m_MotionEvents.GetRuleCount(); i++)
+    {
+        const imu_event_rule_t& rule = m_MotionEvents.GetRule(i);
+        JsonObject item = rules.add<JsonObject>();
+        item["type"] = CImuEventEngine::GetTypeName(rule.type);
+        item["threshold"] = rule.threshold;
+        item["clear"] = rule.clear;
+        item["hold_ms"] = rule.hold_ms;
+        item["active"] = m_MotionEvents.IsActive(i);
+    }
+    doc["timestamp"] = millis();
+    
+    SendJson(connection.client, doc);
+}
+
+void CGrpcServer::SendMotionEvent(const imu_event_t& event)
+{
+    for (int i = 0; i < GRPC_MAX_CLIENTS; i++)
+    {
+        grpc_connection_t& connection = m_Connections[i];
+        if (!connection.active || !connection.motionEvents) continue;
+        // Never wait on a congested subscriber; it learns of the loss from
+        // the dropped count of the next event it gets
+        if (!CSocketUtil::IsWritable(connection.client))
+        {
+            connection.eventsDropped++;
+            continue;
+        }
+        
+        char data[192];
+        int length = snprintf(data, sizeof(data),
+                              "{\"rule\":%u,\"type\":\"%s\",\"state\":\"%s\",\"value\":%.3f,\"peak\":%.3f,"
+                              "\"duration_ms\":%u,\"sequence\":%u,\"timestamp\":%u,\"dropped\":%u}",
+                              event.rule, CImuEventEngine::GetTypeName(event.type), event.active ? "start" : "end",
+                              event.value, event.peak, (unsigned int)event.duration_ms, (unsigned int)event.sequence,
+                              (unsigned int)event.timestamp, (unsigned int)connection.eventsDropped);
+        if (length <= 0 || length >= (int)sizeof(data)) continue;
+        WriteFrame(connection.client, "EVENT:", data, length);
+        connection.eventsDropped = 0;
+    }
+}
+
+void CGrpcServer::SendStreamData(grpc_connection_t& connection, const char* data, size_t length, bool isLast)
+{
+    if (!connection.client.connected()) {
+        connection.streaming = false;
         return;
     }
     
     // Send streaming data with STREAM protocol marker
-    String message = "STREAM:" + String(data.length()) + ":" + data;
     if (isLast) {
-        message = "STREAM_END:" + String(data.length()) + ":" + data;
-        m_IsStreaming = false;
+        WriteFrame(connection.client, "STREAM_END:", data, length);
+        connection.streaming = false;
+    } else {
+        WriteFrame(connection.client, "STREAM:", data, length);
+    }
+    
+    log_d("Sent stream data: %d bytes", length);
+}
+
+/**
+ * @brief Print sink that gathers a frame in a fixed buffer and writes it to
+ *        the socket a buffer at a time, so a response of any size is framed
+ *        without building a String.
+ */
+class CFrameWriter : public Print
+{
+public:
+    explicit CFrameWriter(WiFiClient& client) : m_Client(client), m_Length(0)
+    {
+    }
+    
+    size_t write(uint8_t c) override
+    {
+        return write(&c, 1);
+    }
+    
+    size_t write(const uint8_t* data, size_t size) override
+    {
+        size_t copied = 0;
+        while (copied < size)
+        {
+            if (m_Length == sizeof(m_Buffer)) Send();
+            size_t chunk = min(size - copied, sizeof(m_Buffer) - m_Length);
+            memcpy(m_Buffer + m_Length, data + copied, chunk);
+            m_Length += chunk;
+            copied += chunk;
+        }
+        return size;
+    }
+    
+    void Send()
+    {
+        if (m_Length > 0) m_Client.write(m_Buffer, m_Length);
+        m_Length = 0;
     }
     
-    client.println(message);
-    client.flush();
+private:
+    WiFiClient& m_Client;
+    uint8_t m_Buffer[GRPC_RESPONSE_CHUNK_SIZE];
+    size_t m_Length;
+};
+
+void CGrpcServer::SendJson(WiFiClient& client, const JsonDocument& doc)
+{
+    // The same "<length>:<data>\r\n" frame as SendResponse(); measuring
+    // first lets the header go out before the document is written
+    char header[GRPC_FRAME_HEADER_SIZE];
+    int headerLength = snprintf(header, sizeof(header), "%u:", (unsigned int)measureJson(doc));
+    if (headerLength < 0) return;
     
-    log_d("Sent stream data: %d bytes", data.length());
+    CFrameWriter writer(client);
+    writer.write((const uint8_t*)header, headerLength);
+    serializeJson(doc, writer);
+    writer.write((const uint8_t*)"\r\n", 2);
+    writer.Send();
 }
 
-void CGrpcServer::SendResponse(WiFiClient& client, String response)
+void CGrpcServer::SendResponse(WiFiClient& client, const char* response, size_t length)
 {
     // Send response with simple protocol: LENGTH:DATA
-    String message = String(response.length()) + ":" + response;
-    client.println(message);
-    client.flush();
-}
\ No newline at end of file
+    WriteFrame(client, "", response, length);
+}
+
+void CGrpcServer::WriteFrame(WiFiClient& client, const char* marker, const char* data, size_t length)
+{
+    // Assemble "<marker><length>:<data>\r\n" so that small frames leave in a
+    // single write. No flush(): on WiFiClient it discards unread input, which
+    // would drop requests the client has already pipelined.
+    char frame[GRPC_FRAME_HEADER_SIZE + IMU_SNAPSHOT_MAX_JSON + 2];
+    int headerLength = snprintf(frame, GRPC_FRAME_HEADER_SIZE, "%s%u:", marker, (unsigned int)length);
+    if (headerLength < 0) return;
+    
+    if (headerLength + length + 2 <= sizeof(frame))
+    {
+        memcpy(frame + headerLength, data, length);
+        frame[headerLength + length] = '\r';
+        frame[headerLength + length + 1] = '\n';
+        client.write((const uint8_t*)frame, headerLength + length + 2);
+    }
+    else
+    {
+        client.write((const uint8_t*)frame, headerLength);
+        client.write((const uint8_t*)data, length);
+        client.write((const uint8_t*)"\r\n", 2);
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file AuxSensors.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief LIS3MDL magnetometer and INA219 power monitor read through an I2C
+ *        scheduler.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef AUX_SENSORS_H
+#define AUX_SENSORS_H
+
+#include <stdint.h>
+#include "I2cScheduler.h"
+
+/**
+ * @brief Default device addresses.
+ */
+#define LIS3MDL_ADDRESS 0x1C
+#define INA219_ADDRESS  0x40
+
+/**
+ * @brief Shunt resistor of the INA219 breakout, in ohms.
+ */
+#define INA219_SHUNT_OHMS 0.1f
+
+/**
+ * @brief Delay before a magnetometer that did not take its configuration
+ *        is configured again, in microseconds.
+ */
+#define AUX_CONFIG_RETRY_US 1000000
+
+/**
+ * @brief Latest readings of the auxiliary sensors.
+ */
+typedef struct {
+   float mag[3];                // Magnetic field x, y, z in microtesla
+   uint32_t mag_timestamp;      // millis() of the magnetometer reading
+   float bus_voltage;           // Supply voltage in volts
+   float current;               // Supply current in amperes
+   uint32_t power_timestamp;    // millis() of the power reading
+   bool mag_valid;              // The magnetometer answered its last read
+   bool power_valid;            // The power monitor answered its last read
+} aux_sensor_data_t;
+
+/**
+ * @brief Registers the reads of a LIS3MDL (continuous mode, 80Hz, ±4 gauss)
+ *        and an INA219 (power-on configuration) as scheduler jobs and decodes
+ *        their results. The magnetometer is configured by a one-shot write
+ *        that is repeated whenever the device stops answering.
+ */
+class CAuxSensors
+{
+public:
+   /**
+    * @brief Construct with no jobs.
+    */
+   CAuxSensors();
+   /**
+    * @brief Add the configuration and read jobs, below the priority of any
+    *        job added before.
+    *
+    * @param scheduler Scheduler of the bus the sensors are on.
+    * @param nowUs Current time.
+    * @param magPeriodUs Magnetometer read period.
+    * @param powerPeriodUs Power monitor read period.
+    * @return true if every job was added.
+    */
+   bool Register(CI2cScheduler &scheduler, int64_t nowUs, uint32_t magPeriodUs, uint32_t powerPeriodUs);
+   /**
+    * @brief Decode a result if it belongs to one of the sensor jobs.
+    *
+    * @param result Result taken from the scheduler.
+    * @param nowMs Current millis(), stamped on the reading.
+    * @return true if the readings changed.
+    */
+   bool Apply(const i2c_result_t &result, uint32_t nowMs);
+   /**
+    * @brief Latest readings.
+    *
+    * @return const aux_sensor_data_t& Readings.
+    */
+   const aux_sensor_data_t &GetData() const;
+
+private:
+   CI2cScheduler *m_Scheduler;
+   int m_MagConfigJob;
+   int m_MagJob;
+   int m_ShuntJob;
+   int m_BusJob;
+   bool m_MagConfigured;          // The configuration write was acknowledged
+   bool m_ShuntValid;             // The last shunt voltage read succeeded
+   int16_t m_ShuntRaw;            // Shunt voltage counts of the last read
+   aux_sensor_data_t m_Data;
+};
+
+#endif // !AUX_SENSORS_H
@@ -0,0 +1,86 @@
+/**
+ * @file I2cBus.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Interface of an I2C bus executing one write-then-read transaction
+ *        at a time.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+
+/**
+ * @brief Largest write (register pointer and data) and read of a transaction.
+ */
+#define I2C_MAX_WRITE 6
+#define I2C_MAX_READ  16
+
+/**
+ * @brief Fixed cost of a transaction beyond its bits on the wire: driver
+ *        setup, FIFO handling and completion interrupt, in microseconds.
+ */
+#define I2C_TRANSACTION_OVERHEAD_US 40
+
+/**
+ * @brief Outcome of a transaction.
+ */
+typedef enum {
+   I2C_OK,
+   I2C_NACK,      // No device answered at the address
+   I2C_TIMEOUT,   // The bus was held too long
+   I2C_ERROR,     // Short read or other bus error
+} i2c_status_t;
+
+/**
+ * @brief Bytes written to a device, then bytes read back with a repeated
+ *        start. Either part may be empty.
+ */
+typedef struct {
+   uint8_t address;             // 7-bit device address
+   uint8_t tx[I2C_MAX_WRITE];   // Register pointer, then data
+   uint8_t tx_length;
+   uint8_t rx_length;
+} i2c_transaction_t;
+
+/**
+ * @brief A bus executing transactions one at a time. Transfer() returns when
+ *        the transaction is over and reports how long it held the bus, so
+ *        a bus that only models time can stand in for the hardware.
+ */
+class CI2cBus
+{
+public:
+   virtual ~CI2cBus() {}
+   /**
+    * @brief Execute a transaction.
+    *
+    * @param transaction Transaction to execute.
+    * @param rx Receives transaction.rx_length bytes.
+    * @param durationUs Receives the time the bus was held.
+    * @return i2c_status_t Outcome.
+    */
+   virtual i2c_status_t Transfer(const i2c_transaction_t &transaction, uint8_t *rx, uint32_t &durationUs) = 0;
+   /**
+    * @brief Bus clock.
+    *
+    * @return uint32_t Clock in Hz.
+    */
+   virtual uint32_t GetClockHz() const = 0;
+   /**
+    * @brief Time a transaction holds the bus: start, address and 9 clocks a
+    *        byte for each part, a stop, plus I2C_TRANSACTION_OVERHEAD_US.
+    *
+    * @param transaction Transaction to estimate.
+    * @param clockHz Bus clock.
+    * @return uint32_t Estimated duration in microseconds.
+    */
+   static uint32_t EstimateUs(const i2c_transaction_t &transaction, uint32_t clockHz);
+};
+
+#endif // !I2C_BUS_H
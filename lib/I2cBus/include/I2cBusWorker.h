@@ -0,0 +1,74 @@
+/**
+ * @file I2cBusWorker.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Task executing the transactions queued on an I2C scheduler.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef I2C_BUS_WORKER_H
+#define I2C_BUS_WORKER_H
+
+#include <Arduino.h>
+#include "I2cScheduler.h"
+
+/**
+ * @brief Worker task stack size in bytes and priority.
+ */
+#define I2C_WORKER_STACK_SIZE 3072
+#define I2C_WORKER_PRIORITY   2
+
+/**
+ * @brief Runs queued transactions on its own task, so the task dispatching
+ *        them never blocks on the bus. The worker sleeps until kicked, runs
+ *        everything queued and then notifies the owner that results are
+ *        ready. Its stack and control block are members, so starting it
+ *        needs no heap.
+ */
+class CI2cBusWorker
+{
+public:
+   /**
+    * @brief Construct a worker for a scheduler.
+    *
+    * @param scheduler Scheduler whose queue the worker drains.
+    */
+   CI2cBusWorker(CI2cScheduler &scheduler);
+   /**
+    * @brief Create the worker task.
+    *
+    * @param owner Task notified when results are ready.
+    * @param eventBits Notification bits set on the owner.
+    * @param core Core the worker runs on.
+    * @return true if the task is running.
+    */
+   bool Start(TaskHandle_t owner, uint32_t eventBits, BaseType_t core);
+   /**
+    * @brief Wake the worker after Dispatch() queued transactions.
+    */
+   void Kick();
+   /**
+    * @brief Handle of the worker task, for the memory profiler.
+    *
+    * @return TaskHandle_t Task handle, NULL before Start().
+    */
+   TaskHandle_t GetTask() const;
+
+private:
+   /**
+    * @brief Task body.
+    */
+   static void WorkerTask(void *arg);
+
+   CI2cScheduler &m_Scheduler;
+   TaskHandle_t m_Task;
+   TaskHandle_t m_Owner;
+   uint32_t m_EventBits;
+   StackType_t m_Stack[I2C_WORKER_STACK_SIZE];
+   StaticTask_t m_TaskBuffer;
+};
+
+#endif // !I2C_BUS_WORKER_H
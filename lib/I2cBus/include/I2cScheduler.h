@@ -0,0 +1,190 @@
+/**
+ * @file I2cScheduler.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Periodic I2C transactions dispatched into the idle windows of a
+ *        shared bus and executed off the calling task.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef I2C_SCHEDULER_H
+#define I2C_SCHEDULER_H
+
+#include <atomic>
+#include <stdint.h>
+#include "I2cBus.h"
+#include "TimerDeadline.h"
+
+/**
+ * @brief Most jobs a scheduler holds.
+ */
+#define I2C_SCHEDULER_MAX_JOBS 8
+
+/**
+ * @brief Most transactions submitted and not yet collected.
+ */
+#define I2C_SCHEDULER_QUEUE_LENGTH 8
+
+/**
+ * @brief A transaction run on its own period, or once.
+ */
+typedef struct {
+   const char *name;                // Short name used when logging statistics
+   i2c_transaction_t transaction;
+   uint32_t period_us;              // 0 to run once, as soon as possible
+   uint8_t priority;                // 0 is dispatched first among due jobs
+} i2c_job_config_t;
+
+/**
+ * @brief A completed transaction.
+ */
+typedef struct {
+   uint8_t job;                     // Job id returned by AddJob()
+   i2c_status_t status;
+   int64_t start_us;                // Time the transaction started
+   uint32_t duration_us;            // Time it held the bus
+   uint8_t data[I2C_MAX_READ];      // Bytes read
+   uint8_t length;
+} i2c_result_t;
+
+/**
+ * @brief Counters of one job, collected as its results are taken.
+ */
+typedef struct {
+   uint32_t runs;                   // Transactions completed
+   uint32_t errors;                 // Transactions that did not return I2C_OK
+   uint32_t deferred;               // Dispatches held back for not fitting the window
+   uint32_t max_duration_us;        // Longest transaction
+   uint64_t total_duration_us;      // Sum of transaction times, for the mean
+} i2c_job_stats_t;
+
+/**
+ * @brief Schedules periodic transactions on a bus shared with a time-critical
+ *        reader. The owning task calls Dispatch() with the time the bus must
+ *        be free again; due jobs whose transaction fits before then are
+ *        queued, by priority and then deadline, and the rest wait for the
+ *        next window. A worker calls ProcessOne() to run queued transactions,
+ *        so the owning task never waits on the bus, and the owner collects
+ *        the results with TakeResult().
+ *
+ * Dispatch(), TakeResult(), AddJob() and the statistics belong to one task;
+ * ProcessOne() to one other. The two only share the lock-free queues.
+ * Every time is passed in by the caller, so the scheduler runs the same on
+ * a virtual clock.
+ */
+class CI2cScheduler
+{
+public:
+   /**
+    * @brief Construct a scheduler for a bus.
+    *
+    * @param bus Bus the transactions run on.
+    */
+   CI2cScheduler(CI2cBus &bus);
+   /**
+    * @brief Add a job. A periodic job is first due one period from now, a
+    *        one-shot job at once.
+    *
+    * @param config Job to add.
+    * @param nowUs Current time.
+    * @return int Job id, or -1 if the table is full or the transaction too long.
+    */
+   int AddJob(const i2c_job_config_t &config, int64_t nowUs);
+   /**
+    * @brief Run a job once more at a given time. A periodic job becomes
+    *        one-shot.
+    *
+    * @param job Job id.
+    * @param dueUs Time it is due.
+    */
+   void ScheduleOnce(int job, int64_t dueUs);
+   /**
+    * @brief Queue the due jobs that fit before the end of the window.
+    *
+    * @param nowUs Current time.
+    * @param windowEndUs Time by which every queued transaction must be over.
+    * @return uint8_t Number of transactions queued.
+    */
+   uint8_t Dispatch(int64_t nowUs, int64_t windowEndUs);
+   /**
+    * @brief Earliest deadline of a job not in flight.
+    *
+    * @param dueUs Receives the deadline; it may be in the past for a job
+    *              waiting for a window.
+    * @return true if a job is pending.
+    */
+   bool GetNextDueUs(int64_t &dueUs) const;
+   /**
+    * @brief Run the oldest queued transaction on the bus (worker side).
+    *
+    * @param startUs Time the transaction starts.
+    * @param endUs Receives the time it ended.
+    * @return true if a transaction was run.
+    */
+   bool ProcessOne(int64_t startUs, int64_t &endUs);
+   /**
+    * @brief Take the oldest completed transaction.
+    *
+    * @param result Receives the result.
+    * @return true if a result was taken.
+    */
+   bool TakeResult(i2c_result_t &result);
+   /**
+    * @brief Copy and reset the statistics of a job.
+    *
+    * @param job Job id.
+    * @param stats Receives the transaction counters.
+    * @param timing Receives the dispatch lateness and skipped periods.
+    * @return true if job is valid.
+    */
+   bool TakeStats(int job, i2c_job_stats_t &stats, scheduler_timer_stats_t &timing);
+   /**
+    * @brief Name of a job.
+    *
+    * @param job Job id.
+    * @return const char* Name, or NULL for an invalid id.
+    */
+   const char *GetJobName(int job) const;
+   /**
+    * @brief Number of jobs added.
+    *
+    * @return uint8_t Job count.
+    */
+   uint8_t GetJobCount() const;
+
+private:
+   /**
+    * @brief A job and its state on the owning task.
+    */
+   typedef struct {
+      i2c_job_config_t config;
+      CTimerDeadline deadline;
+      bool inFlight;                // Queued or running, result not yet taken
+      uint32_t worstUs;             // Longest of the estimate and every run
+      i2c_job_stats_t stats;
+   } job_t;
+
+   /**
+    * @brief Bit mask of jobs held back in the current window.
+    */
+   typedef uint16_t job_mask_t;
+
+   CI2cBus &m_Bus;
+   job_t m_Jobs[I2C_SCHEDULER_MAX_JOBS];
+   uint8_t m_JobCount;
+   uint8_t m_Outstanding;           // Queued or completed, not yet taken
+   int64_t m_BusFreeUs;             // Estimated end of the queued work
+
+   // Single-producer single-consumer queues between the owner and the worker
+   uint8_t m_Submitted[I2C_SCHEDULER_QUEUE_LENGTH];
+   std::atomic<uint8_t> m_SubmitHead;
+   std::atomic<uint8_t> m_SubmitTail;
+   i2c_result_t m_Completed[I2C_SCHEDULER_QUEUE_LENGTH];
+   std::atomic<uint8_t> m_CompleteHead;
+   std::atomic<uint8_t> m_CompleteTail;
+};
+
+#endif // !I2C_SCHEDULER_H
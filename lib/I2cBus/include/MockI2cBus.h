@@ -0,0 +1,128 @@
+/**
+ * @file MockI2cBus.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief An I2C bus of simulated register devices, for host timing runs.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef MOCK_I2C_BUS_H
+#define MOCK_I2C_BUS_H
+
+#include <stdint.h>
+#include "I2cBus.h"
+
+/**
+ * @brief Most devices on a mock bus.
+ */
+#define MOCK_I2C_MAX_DEVICES 8
+
+/**
+ * @brief A bus of register-file devices. Transactions complete at once and
+ *        report the time they would hold a real bus at its clock, plus any
+ *        clock stretching set for the device, so a scheduler driven by a
+ *        virtual clock sees realistic bus occupancy.
+ *
+ * A write sets the register pointer from its first byte and stores the rest
+ * from there; a read returns bytes from the pointer on. Both advance the
+ * pointer, as devices with auto-increment do.
+ */
+class CMockI2cBus : public CI2cBus
+{
+public:
+   /**
+    * @brief Construct an empty bus.
+    *
+    * @param clockHz Bus clock.
+    */
+   CMockI2cBus(uint32_t clockHz);
+   /**
+    * @brief Attach a device.
+    *
+    * @param address 7-bit address.
+    * @param registerWidth Bytes per register, 2 for devices with 16-bit registers.
+    * @param pointerMask Bits of the first write byte that select the register;
+    *                    0x7F for devices using the top bit as auto-increment.
+    * @return true if the device was added.
+    */
+   bool AddDevice(uint8_t address, uint8_t registerWidth = 1, uint8_t pointerMask = 0xFF);
+   /**
+    * @brief Let a device answer or NACK, as if powered or unplugged.
+    *
+    * @param address Device address.
+    * @param present true to answer.
+    */
+   void SetPresent(uint8_t address, bool present);
+   /**
+    * @brief Clock stretching added to every transaction of a device.
+    *
+    * @param address Device address.
+    * @param stretchUs Extra time in microseconds.
+    */
+   void SetStretch(uint8_t address, uint32_t stretchUs);
+   /**
+    * @brief Store register bytes, as the device would after a measurement.
+    *
+    * @param address Device address.
+    * @param reg First register.
+    * @param data Bytes, in the order the device sends them.
+    * @param length Number of bytes.
+    * @return true if the device exists.
+    */
+   bool SetRegisters(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t length);
+   /**
+    * @brief Read back a register byte, to check what was written.
+    *
+    * @param address Device address.
+    * @param reg Register.
+    * @param offset Byte within the register.
+    * @param value Receives the byte.
+    * @return true if the device exists.
+    */
+   bool GetRegister(uint8_t address, uint8_t reg, uint8_t offset, uint8_t &value) const;
+   /**
+    * @brief Number of transactions run, including NACKed ones.
+    *
+    * @return uint32_t Transaction count.
+    */
+   uint32_t GetTransferCount() const;
+   /**
+    * @brief Total time the bus was held.
+    *
+    * @return uint64_t Busy time in microseconds.
+    */
+   uint64_t GetBusyUs() const;
+   i2c_status_t Transfer(const i2c_transaction_t &transaction, uint8_t *rx, uint32_t &durationUs) override;
+   uint32_t GetClockHz() const override;
+
+private:
+   /**
+    * @brief A simulated device.
+    */
+   typedef struct {
+      uint8_t address;
+      uint8_t width;
+      uint8_t mask;
+      bool present;
+      uint32_t stretchUs;
+      uint8_t pointer;              // Byte offset of the next access
+      uint8_t registers[256];
+   } device_t;
+
+   /**
+    * @brief Find a device by address.
+    */
+   device_t *FindDevice(uint8_t address);
+   const device_t *FindDevice(uint8_t address) const;
+
+   uint32_t m_ClockHz;
+   device_t m_Devices[MOCK_I2C_MAX_DEVICES];
+   uint8_t m_DeviceCount;
+   uint32_t m_Transfers;
+   uint64_t m_BusyUs;
+};
+
+#endif // !MOCK_I2C_BUS_H
@@ -0,0 +1,49 @@
+/**
+ * @file WireI2cBus.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief I2C bus on an Arduino TwoWire controller.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef WIRE_I2C_BUS_H
+#define WIRE_I2C_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "I2cBus.h"
+
+/**
+ * @brief Runs transactions through a TwoWire controller that other drivers
+ *        may share; TwoWire serializes whole transactions between tasks.
+ *        The ESP32 driver moves bytes through the controller FIFO from its
+ *        interrupt, so the calling task sleeps while the bus is busy.
+ */
+class CWireI2cBus : public CI2cBus
+{
+public:
+   /**
+    * @brief Construct a bus on a controller.
+    *
+    * @param wire Controller, with its pins already set.
+    * @param clockHz Bus clock.
+    */
+   CWireI2cBus(TwoWire &wire, uint32_t clockHz);
+   /**
+    * @brief Start the controller if no other driver has, at the bus clock.
+    *
+    * @return true on success.
+    */
+   bool Begin();
+   i2c_status_t Transfer(const i2c_transaction_t &transaction, uint8_t *rx, uint32_t &durationUs) override;
+   uint32_t GetClockHz() const override;
+
+private:
+   TwoWire &m_Wire;
+   uint32_t m_ClockHz;
+};
+
+#endif // !WIRE_I2C_BUS_H
@@ -0,0 +1,141 @@
+/**
+ * @file AuxSensors.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the auxiliary sensor jobs.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "AuxSensors.h"
+#include <string.h>
+
+/**
+ * @brief LIS3MDL registers; the top bit of the address auto-increments.
+ */
+#define LIS3MDL_CTRL_REG1   0x20
+#define LIS3MDL_OUT_X_L     0x28
+#define LIS3MDL_AUTO_INC    0x80
+
+/**
+ * @brief LIS3MDL counts per gauss at ±4 gauss; one gauss is 100 microtesla.
+ */
+#define LIS3MDL_LSB_PER_GAUSS 6842.0f
+
+/**
+ * @brief INA219 registers and scales.
+ */
+#define INA219_SHUNT_VOLTAGE 0x01
+#define INA219_BUS_VOLTAGE   0x02
+#define INA219_SHUNT_LSB_V   0.00001f
+#define INA219_BUS_LSB_V     0.004f
+
+/**
+ * @brief Job priorities, below anything the owner registered first.
+ */
+#define AUX_PRIORITY_CONFIG 4
+#define AUX_PRIORITY_MAG    5
+#define AUX_PRIORITY_POWER  6
+
+CAuxSensors::CAuxSensors()
+   : m_Scheduler(NULL), m_MagConfigJob(-1), m_MagJob(-1), m_ShuntJob(-1), m_BusJob(-1),
+     m_MagConfigured(false), m_ShuntValid(false), m_ShuntRaw(0)
+{
+   memset(&m_Data, 0, sizeof(aux_sensor_data_t));
+}
+
+bool CAuxSensors::Register(CI2cScheduler &scheduler, int64_t nowUs, uint32_t magPeriodUs, uint32_t powerPeriodUs)
+{
+   m_Scheduler = &scheduler;
+
+   // CTRL_REG1..4 in one write: ultra-high performance XY at 80Hz, ±4 gauss,
+   // continuous conversion, ultra-high performance Z.
+   i2c_job_config_t magConfig = {"lis3mdl-config", {LIS3MDL_ADDRESS, {LIS3MDL_CTRL_REG1 | LIS3MDL_AUTO_INC, 0x7C, 0x00, 0x00, 0x0C}, 5, 0},
+                                 0, AUX_PRIORITY_CONFIG};
+   i2c_job_config_t mag = {"lis3mdl", {LIS3MDL_ADDRESS, {LIS3MDL_OUT_X_L | LIS3MDL_AUTO_INC}, 1, 6},
+                           magPeriodUs, AUX_PRIORITY_MAG};
+   // The INA219 does not auto-increment: one read per register.
+   i2c_job_config_t shunt = {"ina219-shunt", {INA219_ADDRESS, {INA219_SHUNT_VOLTAGE}, 1, 2},
+                             powerPeriodUs, AUX_PRIORITY_POWER};
+   i2c_job_config_t bus = {"ina219-bus", {INA219_ADDRESS, {INA219_BUS_VOLTAGE}, 1, 2},
+                           powerPeriodUs, AUX_PRIORITY_POWER};
+
+   m_MagConfigJob = scheduler.AddJob(magConfig, nowUs);
+   m_MagJob = scheduler.AddJob(mag, nowUs);
+   m_ShuntJob = scheduler.AddJob(shunt, nowUs);
+   m_BusJob = scheduler.AddJob(bus, nowUs);
+   return m_MagConfigJob >= 0 && m_MagJob >= 0 && m_ShuntJob >= 0 && m_BusJob >= 0;
+}
+
+bool CAuxSensors::Apply(const i2c_result_t &result, uint32_t nowMs)
+{
+   bool ok = result.status == I2C_OK;
+
+   if (result.job == m_MagConfigJob)
+   {
+      m_MagConfigured = ok;
+      if (!ok && m_Scheduler != NULL)
+      {
+         m_Scheduler->ScheduleOnce(m_MagConfigJob, result.start_us + AUX_CONFIG_RETRY_US);
+      }
+      return false;
+   }
+
+   if (result.job == m_MagJob)
+   {
+      bool wasValid = m_Data.mag_valid;
+      m_Data.mag_valid = ok && m_MagConfigured;
+      if (!ok && m_MagConfigured && m_Scheduler != NULL)
+      {
+         // A device that went away comes back with its power-on settings.
+         m_MagConfigured = false;
+         m_Scheduler->ScheduleOnce(m_MagConfigJob, result.start_us + AUX_CONFIG_RETRY_US);
+      }
+      if (!m_Data.mag_valid)
+      {
+         return wasValid;
+      }
+      for (int axis = 0; axis < 3; axis++)
+      {
+         int16_t counts = (int16_t)(result.data[2 * axis + 1] << 8 | result.data[2 * axis]);
+         m_Data.mag[axis] = counts * (100.0f / LIS3MDL_LSB_PER_GAUSS);
+      }
+      m_Data.mag_timestamp = nowMs;
+      return true;
+   }
+
+   if (result.job == m_ShuntJob)
+   {
+      // Paired with the bus voltage read that follows it in the same window.
+      m_ShuntValid = ok;
+      if (ok)
+      {
+         m_ShuntRaw = (int16_t)(result.data[0] << 8 | result.data[1]);
+      }
+      return false;
+   }
+
+   if (result.job == m_BusJob)
+   {
+      bool wasValid = m_Data.power_valid;
+      m_Data.power_valid = ok && m_ShuntValid;
+      if (!m_Data.power_valid)
+      {
+         return wasValid;
+      }
+      uint16_t busRaw = (uint16_t)(result.data[0] << 8 | result.data[1]);
+      m_Data.bus_voltage = (busRaw >> 3) * INA219_BUS_LSB_V;
+      m_Data.current = m_ShuntRaw * INA219_SHUNT_LSB_V / INA219_SHUNT_OHMS;
+      m_Data.power_timestamp = nowMs;
+      return true;
+   }
+
+   return false;
+}
+
+const aux_sensor_data_t &CAuxSensors::GetData() const
+{
+   return m_Data;
+}
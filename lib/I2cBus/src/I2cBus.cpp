@@ -0,0 +1,32 @@
+/**
+ * @file I2cBus.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the I2C transaction time estimate.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "I2cBus.h"
+
+uint32_t CI2cBus::EstimateUs(const i2c_transaction_t &transaction, uint32_t clockHz)
+{
+   if (clockHz == 0)
+   {
+      return I2C_TRANSACTION_OVERHEAD_US;
+   }
+   // A start (or repeated start) and the address byte open each part; every
+   // byte is 8 bits and an acknowledge. One stop closes the transaction.
+   uint32_t bits = 1;
+   if (transaction.tx_length > 0 || transaction.rx_length == 0)
+   {
+      bits += 1 + 9 * (1 + transaction.tx_length);
+   }
+   if (transaction.rx_length > 0)
+   {
+      bits += 1 + 9 * (1 + transaction.rx_length);
+   }
+   return (uint32_t)((uint64_t)bits * 1000000ULL / clockHz) + I2C_TRANSACTION_OVERHEAD_US;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file I2cBusWorker.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the I2C bus worker task.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+// Built for the target only; native tests drive CI2cScheduler directly.
+#ifdef ARDUINO
+#include "I2cBusWorker.h"
+#include <esp_timer.h>
+
+CI2cBusWorker::CI2cBusWorker(CI2cScheduler &scheduler)
+   : m_Scheduler(scheduler), m_Task(NULL), m_Owner(NULL), m_EventBits(0)
+{
+}
+
+bool CI2cBusWorker::Start(TaskHandle_t owner, uint32_t eventBits, BaseType_t core)
+{
+   if (m_Task != NULL)
+   {
+      return true;
+   }
+   m_Owner = owner;
+   m_EventBits = eventBits;
+   m_Task = xTaskCreateStaticPinnedToCore(WorkerTask, "I2cWorker", I2C_WORKER_STACK_SIZE, this,
+                                          I2C_WORKER_PRIORITY, m_Stack, &m_TaskBuffer, core);
+   if (m_Task == NULL)
+   {
+      log_e("Failed to start I2C bus worker.");
+   }
+   return m_Task != NULL;
+}
+
+void CI2cBusWorker::Kick()
+{
+   if (m_Task != NULL)
+   {
+      xTaskNotifyGive(m_Task);
+   }
+}
+
+TaskHandle_t CI2cBusWorker::GetTask() const
+{
+   return m_Task;
+}
+
+void CI2cBusWorker::WorkerTask(void *arg)
+{
+   CI2cBusWorker *worker = static_cast<CI2cBusWorker *>(arg);
+   for (;;)
+   {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      bool ran = false;
+      int64_t endUs;
+      while (worker->m_Scheduler.ProcessOne(esp_timer_get_time(), endUs))
+      {
+         ran = true;
+      }
+      if (ran && worker->m_Owner != NULL)
+      {
+         xTaskNotify(worker->m_Owner, worker->m_EventBits, eSetBits);
+      }
+   }
+}
+
+#endif // ARDUINO
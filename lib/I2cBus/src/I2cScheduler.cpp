@@ -0,0 +1,212 @@
+/**
+ * @file I2cScheduler.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the I2C transaction scheduler.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "I2cScheduler.h"
+#include <string.h>
+
+// Queue positions are free-running counters; the length must divide 256.
+static_assert((256 % I2C_SCHEDULER_QUEUE_LENGTH) == 0, "I2C_SCHEDULER_QUEUE_LENGTH must divide 256");
+static_assert(I2C_SCHEDULER_MAX_JOBS <= 16, "I2C_SCHEDULER_MAX_JOBS must fit the job mask");
+
+CI2cScheduler::CI2cScheduler(CI2cBus &bus)
+   : m_Bus(bus), m_JobCount(0), m_Outstanding(0), m_BusFreeUs(0),
+     m_SubmitHead(0), m_SubmitTail(0), m_CompleteHead(0), m_CompleteTail(0)
+{
+   memset(m_Submitted, 0, sizeof(m_Submitted));
+   memset(m_Completed, 0, sizeof(m_Completed));
+}
+
+int CI2cScheduler::AddJob(const i2c_job_config_t &config, int64_t nowUs)
+{
+   if (m_JobCount >= I2C_SCHEDULER_MAX_JOBS || config.transaction.tx_length > I2C_MAX_WRITE ||
+       config.transaction.rx_length > I2C_MAX_READ)
+   {
+      return -1;
+   }
+
+   job_t &job = m_Jobs[m_JobCount];
+   job.config = config;
+   job.deadline = CTimerDeadline();
+   job.inFlight = false;
+   job.worstUs = CI2cBus::EstimateUs(config.transaction, m_Bus.GetClockHz());
+   memset(&job.stats, 0, sizeof(i2c_job_stats_t));
+   if (config.period_us > 0)
+   {
+      job.deadline.StartPeriodic(config.period_us, nowUs);
+   }
+   else
+   {
+      job.deadline.ArmAt(nowUs);
+   }
+   return m_JobCount++;
+}
+
+void CI2cScheduler::ScheduleOnce(int job, int64_t dueUs)
+{
+   if (job < 0 || job >= m_JobCount)
+   {
+      return;
+   }
+   m_Jobs[job].deadline.ArmAt(dueUs);
+}
+
+uint8_t CI2cScheduler::Dispatch(int64_t nowUs, int64_t windowEndUs)
+{
+   // With nothing outstanding the bus is idle now; otherwise new work queues
+   // behind the estimated end of what was already handed out.
+   if (m_Outstanding == 0 || m_BusFreeUs < nowUs)
+   {
+      m_BusFreeUs = nowUs;
+   }
+
+   uint8_t queued = 0;
+   job_mask_t considered = 0;
+   while (m_Outstanding < I2C_SCHEDULER_QUEUE_LENGTH)
+   {
+      // Highest priority due job, earliest deadline among equals
+      int best = -1;
+      for (int i = 0; i < m_JobCount; i++)
+      {
+         job_t &job = m_Jobs[i];
+         if ((considered & (1 << i)) || job.inFlight || !job.deadline.IsDue(nowUs, 0))
+         {
+            continue;
+         }
+         if (best < 0 || job.config.priority < m_Jobs[best].config.priority ||
+             (job.config.priority == m_Jobs[best].config.priority &&
+              job.deadline.GetDueUs() < m_Jobs[best].deadline.GetDueUs()))
+         {
+            best = i;
+         }
+      }
+      if (best < 0)
+      {
+         break;
+      }
+      considered |= (job_mask_t)(1 << best);
+
+      // The bus cannot be preempted: a transaction that would run into the
+      // end of the window waits, and a shorter one behind it may go instead.
+      job_t &job = m_Jobs[best];
+      if (m_BusFreeUs + job.worstUs > windowEndUs)
+      {
+         job.stats.deferred++;
+         continue;
+      }
+
+      job.deadline.Fire(nowUs);
+      job.inFlight = true;
+      m_BusFreeUs += job.worstUs;
+      m_Outstanding++;
+      queued++;
+
+      uint8_t tail = m_SubmitTail.load(std::memory_order_relaxed);
+      m_Submitted[tail % I2C_SCHEDULER_QUEUE_LENGTH] = (uint8_t)best;
+      m_SubmitTail.store((uint8_t)(tail + 1), std::memory_order_release);
+   }
+   return queued;
+}
+
+bool CI2cScheduler::GetNextDueUs(int64_t &dueUs) const
+{
+   bool found = false;
+   for (int i = 0; i < m_JobCount; i++)
+   {
+      const job_t &job = m_Jobs[i];
+      if (job.inFlight || !job.deadline.IsArmed())
+      {
+         continue;
+      }
+      if (!found || job.deadline.GetDueUs() < dueUs)
+      {
+         dueUs = job.deadline.GetDueUs();
+         found = true;
+      }
+   }
+   return found;
+}
+
+bool CI2cScheduler::ProcessOne(int64_t startUs, int64_t &endUs)
+{
+   uint8_t head = m_SubmitHead.load(std::memory_order_relaxed);
+   if (head == m_SubmitTail.load(std::memory_order_acquire))
+   {
+      return false;
+   }
+   uint8_t job = m_Submitted[head % I2C_SCHEDULER_QUEUE_LENGTH];
+   m_SubmitHead.store((uint8_t)(head + 1), std::memory_order_release);
+
+   // Outstanding work never exceeds the queue length, so there is room.
+   uint8_t tail = m_CompleteTail.load(std::memory_order_relaxed);
+   i2c_result_t &result = m_Completed[tail % I2C_SCHEDULER_QUEUE_LENGTH];
+   const i2c_transaction_t &transaction = m_Jobs[job].config.transaction;
+   result.job = job;
+   result.start_us = startUs;
+   result.length = transaction.rx_length;
+   result.status = m_Bus.Transfer(transaction, result.data, result.duration_us);
+   endUs = startUs + result.duration_us;
+   m_CompleteTail.store((uint8_t)(tail + 1), std::memory_order_release);
+   return true;
+}
+
+bool CI2cScheduler::TakeResult(i2c_result_t &result)
+{
+   uint8_t head = m_CompleteHead.load(std::memory_order_relaxed);
+   if (head == m_CompleteTail.load(std::memory_order_acquire))
+   {
+      return false;
+   }
+   memcpy(&result, &m_Completed[head % I2C_SCHEDULER_QUEUE_LENGTH], sizeof(i2c_result_t));
+   m_CompleteHead.store((uint8_t)(head + 1), std::memory_order_release);
+   m_Outstanding--;
+
+   job_t &job = m_Jobs[result.job];
+   job.inFlight = false;
+   job.stats.runs++;
+   job.stats.total_duration_us += result.duration_us;
+   if (result.status != I2C_OK)
+   {
+      job.stats.errors++;
+   }
+   if (result.duration_us > job.stats.max_duration_us)
+   {
+      job.stats.max_duration_us = result.duration_us;
+   }
+   // Later windows are sized by the longest run seen, so a device that
+   // stretches the clock stops being squeezed into gaps it overruns.
+   if (result.duration_us > job.worstUs)
+   {
+      job.worstUs = result.duration_us;
+   }
+   return true;
+}
+
+bool CI2cScheduler::TakeStats(int job, i2c_job_stats_t &stats, scheduler_timer_stats_t &timing)
+{
+   if (job < 0 || job >= m_JobCount)
+   {
+      return false;
+   }
+   memcpy(&stats, &m_Jobs[job].stats, sizeof(i2c_job_stats_t));
+   memset(&m_Jobs[job].stats, 0, sizeof(i2c_job_stats_t));
+   m_Jobs[job].deadline.TakeStats(timing);
+   return true;
+}
+
+const char *CI2cScheduler::GetJobName(int job) const
+{
+   return (job >= 0 && job < m_JobCount) ? m_Jobs[job].config.name : NULL;
+}
+
+uint8_t CI2cScheduler::GetJobCount() const
+{
+   return m_JobCount;
+}
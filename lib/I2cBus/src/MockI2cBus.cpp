@@ -0,0 +1,148 @@
+/**
+ * @file MockI2cBus.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the mock I2C bus.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "MockI2cBus.h"
+#include <string.h>
+
+CMockI2cBus::CMockI2cBus(uint32_t clockHz)
+   : m_ClockHz(clockHz), m_DeviceCount(0), m_Transfers(0), m_BusyUs(0)
+{
+   memset(m_Devices, 0, sizeof(m_Devices));
+}
+
+bool CMockI2cBus::AddDevice(uint8_t address, uint8_t registerWidth, uint8_t pointerMask)
+{
+   if (m_DeviceCount >= MOCK_I2C_MAX_DEVICES || FindDevice(address) != NULL || registerWidth == 0)
+   {
+      return false;
+   }
+   device_t &device = m_Devices[m_DeviceCount++];
+   memset(&device, 0, sizeof(device_t));
+   device.address = address;
+   device.width = registerWidth;
+   device.mask = pointerMask;
+   device.present = true;
+   return true;
+}
+
+void CMockI2cBus::SetPresent(uint8_t address, bool present)
+{
+   device_t *device = FindDevice(address);
+   if (device != NULL)
+   {
+      device->present = present;
+   }
+}
+
+void CMockI2cBus::SetStretch(uint8_t address, uint32_t stretchUs)
+{
+   device_t *device = FindDevice(address);
+   if (device != NULL)
+   {
+      device->stretchUs = stretchUs;
+   }
+}
+
+bool CMockI2cBus::SetRegisters(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t length)
+{
+   device_t *device = FindDevice(address);
+   if (device == NULL)
+   {
+      return false;
+   }
+   uint8_t offset = (uint8_t)(reg * device->width);
+   for (uint8_t i = 0; i < length; i++)
+   {
+      device->registers[(uint8_t)(offset + i)] = data[i];
+   }
+   return true;
+}
+
+bool CMockI2cBus::GetRegister(uint8_t address, uint8_t reg, uint8_t offset, uint8_t &value) const
+{
+   const device_t *device = FindDevice(address);
+   if (device == NULL)
+   {
+      return false;
+   }
+   value = device->registers[(uint8_t)(reg * device->width + offset)];
+   return true;
+}
+
+uint32_t CMockI2cBus::GetTransferCount() const
+{
+   return m_Transfers;
+}
+
+uint64_t CMockI2cBus::GetBusyUs() const
+{
+   return m_BusyUs;
+}
+
+i2c_status_t CMockI2cBus::Transfer(const i2c_transaction_t &transaction, uint8_t *rx, uint32_t &durationUs)
+{
+   m_Transfers++;
+   device_t *device = FindDevice(transaction.address);
+   if (device == NULL || !device->present)
+   {
+      // The address byte goes out and is not acknowledged; nothing follows.
+      i2c_transaction_t probe = {transaction.address, {0}, 0, 0};
+      durationUs = EstimateUs(probe, m_ClockHz);
+      m_BusyUs += durationUs;
+      return I2C_NACK;
+   }
+
+   if (transaction.tx_length > 0)
+   {
+      device->pointer = (uint8_t)((transaction.tx[0] & device->mask) * device->width);
+      for (uint8_t i = 1; i < transaction.tx_length; i++)
+      {
+         device->registers[device->pointer++] = transaction.tx[i];
+      }
+   }
+   for (uint8_t i = 0; i < transaction.rx_length; i++)
+   {
+      rx[i] = device->registers[device->pointer++];
+   }
+
+   durationUs = EstimateUs(transaction, m_ClockHz) + device->stretchUs;
+   m_BusyUs += durationUs;
+   return I2C_OK;
+}
+
+uint32_t CMockI2cBus::GetClockHz() const
+{
+   return m_ClockHz;
+}
+
+CMockI2cBus::device_t *CMockI2cBus::FindDevice(uint8_t address)
+{
+   for (uint8_t i = 0; i < m_DeviceCount; i++)
+   {
+      if (m_Devices[i].address == address)
+      {
+         return &m_Devices[i];
+      }
+   }
+   return NULL;
+}
+
+const CMockI2cBus::device_t *CMockI2cBus::FindDevice(uint8_t address) const
+{
+   for (uint8_t i = 0; i < m_DeviceCount; i++)
+   {
+      if (m_Devices[i].address == address)
+      {
+         return &m_Devices[i];
+      }
+   }
+   return NULL;
+}
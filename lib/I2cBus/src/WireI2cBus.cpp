@@ -0,0 +1,76 @@
+/**
+ * @file WireI2cBus.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the TwoWire I2C bus.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+// Built for the target only; native tests use CMockI2cBus.
+#ifdef ARDUINO
+#include "WireI2cBus.h"
+#include <esp_timer.h>
+
+CWireI2cBus::CWireI2cBus(TwoWire &wire, uint32_t clockHz) : m_Wire(wire), m_ClockHz(clockHz)
+{
+}
+
+bool CWireI2cBus::Begin()
+{
+   if (!m_Wire.begin())
+   {
+      return false;
+   }
+   return m_Wire.setClock(m_ClockHz);
+}
+
+i2c_status_t CWireI2cBus::Transfer(const i2c_transaction_t &transaction, uint8_t *rx, uint32_t &durationUs)
+{
+   int64_t startUs = esp_timer_get_time();
+   i2c_status_t status = I2C_OK;
+
+   // Keep the bus with a repeated start when a read follows the write.
+   if (transaction.tx_length > 0 || transaction.rx_length == 0)
+   {
+      m_Wire.beginTransmission(transaction.address);
+      m_Wire.write(transaction.tx, transaction.tx_length);
+      uint8_t error = m_Wire.endTransmission(transaction.rx_length == 0);
+      if (error == 2 || error == 3)
+      {
+         status = I2C_NACK;
+      }
+      else if (error == 5)
+      {
+         status = I2C_TIMEOUT;
+      }
+      else if (error != 0)
+      {
+         status = I2C_ERROR;
+      }
+   }
+   if (status == I2C_OK && transaction.rx_length > 0)
+   {
+      uint8_t received = m_Wire.requestFrom(transaction.address, transaction.rx_length);
+      if (received != transaction.rx_length)
+      {
+         status = (received == 0) ? I2C_NACK : I2C_ERROR;
+      }
+      for (uint8_t i = 0; i < received; i++)
+      {
+         rx[i] = (uint8_t)m_Wire.read();
+      }
+   }
+
+   durationUs = (uint32_t)(esp_timer_get_time() - startUs);
+   return status;
+}
+
+uint32_t CWireI2cBus::GetClockHz() const
+{
+   return m_ClockHz;
+}
+
+#endif // ARDUINO
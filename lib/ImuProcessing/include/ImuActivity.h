@@ -0,0 +1,90 @@
+/**
+ * @file ImuActivity.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Motion activity detection for switching between rate profiles.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef IMU_ACTIVITY_H
+#define IMU_ACTIVITY_H
+
+#include <stdint.h>
+#include "SensorData.h"
+
+/**
+ * @brief Detector thresholds. Acceleration is measured as the distance of
+ *        the acceleration magnitude from 1 g, so it is independent of
+ *        orientation; rotation as the angular rate magnitude.
+ */
+typedef struct {
+   float onset_accel;     // Deviation from 1 g that marks motion, m/s^2
+   float onset_gyro;      // Angular rate that marks motion, rad/s
+   float rest_accel;      // Deviation from 1 g below which the rover is quiet, m/s^2
+   float rest_gyro;       // Angular rate below which the rover is quiet, rad/s
+   uint32_t rest_ms;      // Time the rover must stay quiet before it is idle
+} imu_activity_config_t;
+
+/**
+ * @brief Classifies the rover as active or idle. A single sample past an
+ *        onset threshold makes it active at once; it turns idle only after
+ *        every sample for rest_ms has been below both rest thresholds, which
+ *        are lower than the onset ones so the state does not flap.
+ */
+class CImuActivityDetector
+{
+public:
+   /**
+    * @brief Construct a detector with the default thresholds, starting active.
+    */
+   CImuActivityDetector();
+   /**
+    * @brief Default thresholds: onset at 1.0 m/s^2 or 0.35 rad/s, rest
+    *        below 0.3 m/s^2 and 0.1 rad/s for 3 seconds.
+    *
+    * @return imu_activity_config_t Default thresholds.
+    */
+   static imu_activity_config_t Default();
+   /**
+    * @brief Validate and apply thresholds; the detector restarts active.
+    *
+    * @param config Thresholds to apply.
+    * @param error Receives a description of the first invalid field.
+    * @return true if the thresholds were applied.
+    */
+   bool Configure(const imu_activity_config_t &config, const char *&error);
+   /**
+    * @brief Current thresholds.
+    *
+    * @return const imu_activity_config_t& Thresholds.
+    */
+   const imu_activity_config_t &GetConfig() const;
+   /**
+    * @brief Classify a sample.
+    *
+    * @param sample Sample in raw counts.
+    * @return true if the state changed; read it with IsActive().
+    */
+   bool Update(const imu_sample_t &sample);
+   /**
+    * @brief Whether the rover is moving.
+    *
+    * @return true if active.
+    */
+   bool IsActive() const;
+   /**
+    * @brief Return to the active state.
+    */
+   void Reset();
+
+private:
+   imu_activity_config_t m_Config;
+   bool m_Active;
+   bool m_Quiet;           // The current run of quiet samples has started
+   uint32_t m_QuietSinceMs;
+};
+
+#endif // !IMU_ACTIVITY_H
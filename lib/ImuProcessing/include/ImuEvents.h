@@ -0,0 +1,160 @@
+/**
+ * @file ImuEvents.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Threshold rules that turn IMU samples into motion events.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef IMU_EVENTS_H
+#define IMU_EVENTS_H
+
+#include <stdint.h>
+#include "SensorData.h"
+
+/**
+ * @brief Most rules evaluated at once.
+ */
+#define IMU_EVENTS_MAX_RULES 8
+
+/**
+ * @brief Quantities a rule can watch.
+ */
+typedef enum {
+   IMU_RULE_IMPACT,       // Acceleration magnitude above the threshold, m/s^2
+   IMU_RULE_FREE_FALL,    // Acceleration magnitude below the threshold, m/s^2
+   IMU_RULE_TILT,         // Angle between the measured gravity and the sensor +Z axis, degrees
+   IMU_RULE_ROTATION,     // Angular rate magnitude above the threshold, rad/s
+   IMU_RULE_COUNT
+} imu_rule_type_t;
+
+/**
+ * @brief One condition. An event starts when the quantity has been past
+ *        threshold for hold_ms and ends once it is back past clear, which
+ *        lies on the quiet side of threshold so noise around the threshold
+ *        does not toggle the event.
+ */
+typedef struct {
+   imu_rule_type_t type;
+   float threshold;       // Start level in the quantity's units
+   float clear;           // End level in the quantity's units
+   uint32_t hold_ms;      // Time the condition must persist before the event starts
+} imu_event_rule_t;
+
+/**
+ * @brief A change of a rule's state.
+ */
+typedef struct {
+   uint8_t rule;          // Index of the rule
+   imu_rule_type_t type;  // Type of the rule
+   bool active;           // true when the event starts, false when it ends
+   float value;           // Quantity at the sample that changed the state
+   float peak;            // Most extreme value while active (equals value on start)
+   uint32_t duration_ms;  // Time the event lasted, 0 on start
+   uint32_t sequence;     // Sequence number of the sample
+   uint32_t timestamp;    // millis() of the sample
+} imu_event_t;
+
+/**
+ * @brief Evaluates a set of rules on every sample and reports state changes.
+ *        Not locked; it is fed and read from one task.
+ */
+class CImuEventEngine
+{
+public:
+   /**
+    * @brief Construct an engine with the default rules.
+    */
+   CImuEventEngine();
+   /**
+    * @brief Default rules: impact above 3 g, free fall below 0.3 g for 30 ms,
+    *        tilt beyond 45 degrees for 250 ms and rotation above 3 rad/s for
+    *        500 ms.
+    *
+    * @param rules Receives IMU_RULE_COUNT rules, one per type.
+    * @return uint8_t Number of rules written.
+    */
+   static uint8_t GetDefaultRules(imu_event_rule_t *rules);
+   /**
+    * @brief Validate and replace the rules; every rule starts inactive.
+    *
+    * @param rules Rules to apply.
+    * @param count Number of rules, at most IMU_EVENTS_MAX_RULES.
+    * @param error Receives a description of the first invalid rule.
+    * @return true if the rules were applied.
+    */
+   bool SetRules(const imu_event_rule_t *rules, uint8_t count, const char *&error);
+   /**
+    * @brief Number of rules.
+    *
+    * @return uint8_t Rule count.
+    */
+   uint8_t GetRuleCount() const;
+   /**
+    * @brief A rule.
+    *
+    * @param index Rule index.
+    * @return const imu_event_rule_t& Rule.
+    */
+   const imu_event_rule_t &GetRule(uint8_t index) const;
+   /**
+    * @brief Whether a rule's event is in progress.
+    *
+    * @param index Rule index.
+    * @return true if active.
+    */
+   bool IsActive(uint8_t index) const;
+   /**
+    * @brief Return every rule to inactive without reporting it.
+    */
+   void Reset();
+   /**
+    * @brief Evaluate all rules on a sample.
+    *
+    * @param sample Sample in raw counts.
+    * @param events Receives the state changes.
+    * @param maxEvents Capacity of events; IMU_EVENTS_MAX_RULES is always enough.
+    * @return uint8_t Number of events written.
+    */
+   uint8_t Evaluate(const imu_sample_t &sample, imu_event_t *events, uint8_t maxEvents);
+   /**
+    * @brief Map a rule type name ("impact", "free_fall", "tilt", "rotation").
+    *
+    * @param name Type name.
+    * @param type Receives the type.
+    * @return true if the name is known.
+    */
+   static bool ParseType(const char *name, imu_rule_type_t &type);
+   /**
+    * @brief Name of a rule type, as accepted by ParseType.
+    *
+    * @param type Rule type.
+    * @return const char* Type name, "unknown" if out of range.
+    */
+   static const char *GetTypeName(imu_rule_type_t type);
+
+private:
+   /**
+    * @brief Whether a type starts above its threshold (rather than below).
+    */
+   static bool IsRising(imu_rule_type_t type);
+
+   /**
+    * @brief Run-time state of one rule.
+    */
+   typedef struct {
+      bool active;           // Event in progress
+      bool pending;          // Condition met, waiting for hold_ms
+      uint32_t sinceMs;      // Time the condition was first met, or the event started
+      float peak;            // Most extreme value while active
+   } rule_state_t;
+
+   imu_event_rule_t m_Rules[IMU_EVENTS_MAX_RULES];
+   rule_state_t m_State[IMU_EVENTS_MAX_RULES];
+   uint8_t m_RuleCount;
+};
+
+#endif // !IMU_EVENTS_H
@@ -0,0 +1,142 @@
+/**
+ * @file ImuHistory.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Multi-resolution min/max/mean history of the IMU channels.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef IMU_HISTORY_H
+#define IMU_HISTORY_H
+
+#include <stdint.h>
+#include "SensorData.h"
+
+/**
+ * @brief Resolutions kept: 1 second, 10 seconds and 1 minute buckets.
+ */
+#define IMU_HISTORY_LEVELS 3
+
+/**
+ * @brief Closed buckets kept per resolution, so the history spans 1 minute
+ *        at 1 second, 10 minutes at 10 seconds and 1 hour at 1 minute.
+ */
+#define IMU_HISTORY_BUCKETS 60
+
+/**
+ * @brief Aggregate of the samples whose timestamps fall in one bucket.
+ */
+typedef struct {
+   uint32_t start_ms;                  // millis() at the start of the bucket, aligned to its period
+   uint32_t count;                     // Samples aggregated
+   float min[IMU_CHANNEL_COUNT];       // Per channel, in imu_channel_t order and channel units
+   float max[IMU_CHANNEL_COUNT];
+   float sum[IMU_CHANNEL_COUNT];       // Divide by count for the mean
+} imu_history_bucket_t;
+
+/**
+ * @brief Keeps a pyramid of aggregated history in fixed memory. Each sample
+ *        updates the open 1 second bucket only; a bucket that closes is
+ *        stored and folded into the open bucket of the next resolution, so
+ *        the per-sample cost does not grow with the number of levels.
+ *        Queries include the open buckets. Not locked; it is fed and read
+ *        from one task.
+ */
+class CImuHistory
+{
+public:
+   /**
+    * @brief Construct an empty history.
+    */
+   CImuHistory();
+   /**
+    * @brief Discard all history.
+    */
+   void Reset();
+   /**
+    * @brief Aggregate a sample.
+    *
+    * @param sample Sample in raw counts; timestamps are expected not to go back.
+    */
+   void Add(const imu_sample_t &sample);
+   /**
+    * @brief Bucket period of a resolution.
+    *
+    * @param level Resolution from 0 (finest) to IMU_HISTORY_LEVELS - 1.
+    * @return uint32_t Period in milliseconds.
+    */
+   static uint32_t GetPeriodMs(uint8_t level);
+   /**
+    * @brief Pick the resolution for a query: the coarsest one that still
+    *        holds the start of the range and gives at least the requested
+    *        number of buckets over it, or else the finest one that holds the
+    *        start of the range.
+    *
+    * @param fromMs Start of the range.
+    * @param toMs End of the range.
+    * @param points Buckets wanted.
+    * @return uint8_t Resolution.
+    */
+   uint8_t SelectLevel(uint32_t fromMs, uint32_t toMs, uint16_t points) const;
+   /**
+    * @brief Number of buckets of a resolution that overlap a range.
+    *
+    * @param level Resolution.
+    * @param fromMs Start of the range.
+    * @param toMs End of the range.
+    * @return uint16_t Bucket count.
+    */
+   uint16_t Count(uint8_t level, uint32_t fromMs, uint32_t toMs) const;
+   /**
+    * @brief Copy the buckets of a resolution that overlap a range, oldest
+    *        first, starting with the first-th of them.
+    *
+    * @param level Resolution.
+    * @param fromMs Start of the range.
+    * @param toMs End of the range.
+    * @param first Index of the first bucket to copy among those in range.
+    * @param buckets Receives the buckets.
+    * @param maxBuckets Capacity of buckets.
+    * @return uint16_t Number of buckets copied.
+    */
+   uint16_t Query(uint8_t level, uint32_t fromMs, uint32_t toMs, uint16_t first,
+                  imu_history_bucket_t *buckets, uint16_t maxBuckets) const;
+   /**
+    * @brief Combine two aggregates; the start of into is kept.
+    *
+    * @param into Aggregate to extend.
+    * @param from Aggregate to add.
+    */
+   static void Merge(imu_history_bucket_t &into, const imu_history_bucket_t &from);
+
+private:
+   /**
+    * @brief Closed buckets of one resolution and its open bucket.
+    */
+   typedef struct {
+      imu_history_bucket_t buckets[IMU_HISTORY_BUCKETS];   // Ring of closed buckets
+      uint8_t head;                                       // Slot of the oldest closed bucket
+      uint8_t count;                                      // Closed buckets held
+      imu_history_bucket_t open;                          // Bucket being filled, empty if count is 0
+   } level_t;
+
+   /**
+    * @brief Add an aggregate to the open bucket of a resolution, closing
+    *        that bucket first if the aggregate starts a new period.
+    */
+   void Fold(uint8_t level, const imu_history_bucket_t &bucket);
+   /**
+    * @brief The open buckets of a resolution and the finer ones, realigned
+    *        to the resolution's period, oldest first.
+    *
+    * @return uint8_t Number of buckets written, at most IMU_HISTORY_LEVELS.
+    */
+   uint8_t GetOpen(uint8_t level, imu_history_bucket_t *buckets) const;
+
+   level_t m_Levels[IMU_HISTORY_LEVELS];
+};
+
+#endif // !IMU_HISTORY_H
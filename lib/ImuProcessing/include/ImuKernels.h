@@ -0,0 +1,85 @@
+/**
+ * @file ImuKernels.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Array kernels used by the IMU spectrum analyzer.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef IMU_KERNELS_H
+#define IMU_KERNELS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Use the ESP-DSP library where it is available, unless built with
+ *        -DIMU_KERNELS_NO_DSP. Its ESP32-S3 variants use the PIE vector
+ *        instructions, which the compiler does not generate on its own.
+ */
+#if !defined(IMU_KERNELS_NO_DSP) && defined(ESP_PLATFORM) && defined(__has_include)
+#if __has_include(<esp_dsp.h>)
+#define IMU_KERNELS_ESP_DSP 1
+#endif
+#endif
+
+/**
+ * @brief Largest real FFT, in points.
+ */
+#define IMU_KERNELS_MAX_FFT 1024
+
+/**
+ * @brief Kernels over a contiguous float array of one channel: the mean
+ *        removal, reduction and FFT of a spectrum window. The portable
+ *        versions are plain loops that build on a host.
+ */
+class CImuKernels
+{
+public:
+   /**
+    * @brief Remove a constant bias in place.
+    *
+    * @param data Values to correct.
+    * @param length Number of elements.
+    * @param bias Bias to subtract.
+    */
+   static void SubtractBias(float *data, size_t length, float bias);
+   /**
+    * @brief Minimum, maximum and mean of an array.
+    *
+    * @param in Values, at least one.
+    * @param length Number of elements.
+    * @param minimum Receives the minimum.
+    * @param maximum Receives the maximum.
+    * @param mean Receives the mean.
+    */
+   static void Reduce(const float *in, size_t length, float &minimum, float &maximum, float &mean);
+   /**
+    * @brief Prepare the FFT twiddle tables. Call once before RealFft();
+    *        later calls do nothing.
+    *
+    * @return true if the tables are ready.
+    */
+   static bool InitFft();
+   /**
+    * @brief In-place FFT of real input, computed as a complex FFT of half
+    *        the length followed by a split step.
+    *
+    * @param data Input samples; receives DC in data[0], the Nyquist term in
+    *             data[1] and bins 1 to length/2 - 1 as (re, im) pairs.
+    * @param length Points, a power of two from 4 to IMU_KERNELS_MAX_FFT.
+    * @return true if the length is supported.
+    */
+   static bool RealFft(float *data, size_t length);
+   /**
+    * @brief Name of the compiled implementation, for logs.
+    *
+    * @return const char* "esp-dsp" or "portable".
+    */
+   static const char *GetBackendName();
+};
+
+#endif // !IMU_KERNELS_H
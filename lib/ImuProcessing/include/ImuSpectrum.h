@@ -0,0 +1,207 @@
+/**
+ * @file ImuSpectrum.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Windowed spectrum analysis of IMU channels.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef IMU_SPECTRUM_H
+#define IMU_SPECTRUM_H
+
+#include <stdint.h>
+#include "SensorData.h"
+
+/**
+ * @brief Largest analysis window, in samples.
+ */
+#define IMU_SPECTRUM_MAX_SIZE 512
+
+/**
+ * @brief Most channels analyzed at once.
+ */
+#define IMU_SPECTRUM_MAX_CHANNELS 3
+
+/**
+ * @brief Largest overlap between consecutive windows.
+ */
+#define IMU_SPECTRUM_MAX_OVERLAP 0.875f
+
+/**
+ * @brief Window functions applied before the transform.
+ */
+typedef enum {
+   IMU_WINDOW_RECTANGULAR,
+   IMU_WINDOW_HANN,
+   IMU_WINDOW_HAMMING,
+   IMU_WINDOW_COUNT
+} imu_window_t;
+
+/**
+ * @brief Analysis settings.
+ */
+typedef struct {
+   uint16_t size;          // Window length in samples, a power of two from 16 to IMU_SPECTRUM_MAX_SIZE
+   float overlap;          // Fraction of a window shared with the next one, 0 to IMU_SPECTRUM_MAX_OVERLAP
+   imu_window_t window;    // Window function
+   uint8_t channels;       // Bit mask of imu_channel_t, at most IMU_SPECTRUM_MAX_CHANNELS bits
+   float sample_rate_hz;   // Expected rate of the samples pushed, used until the first window is timed
+} imu_spectrum_config_t;
+
+/**
+ * @brief A spectral peak.
+ */
+typedef struct {
+   float frequency_hz;     // Interpolated between bins
+   float magnitude;        // Amplitude in channel units
+} imu_spectrum_peak_t;
+
+/**
+ * @brief Collects samples of the selected channels and, every hop (window
+ *        size less the overlap), computes the amplitude spectrum of the most
+ *        recent window of each channel. The mean is removed first so gravity
+ *        and sensor bias do not leak into the low bins. The sample rate of
+ *        each window is measured from the timestamps of its first and last
+ *        samples, so frequencies follow the samples actually pushed. Not
+ *        locked; it is fed and read from one task.
+ */
+class CImuSpectrum
+{
+public:
+   /**
+    * @brief Construct an unconfigured analyzer.
+    */
+   CImuSpectrum();
+   /**
+    * @brief Validate and apply settings; collected samples are discarded.
+    *
+    * @param config Settings to apply.
+    * @param error Receives a description of the first invalid field.
+    * @return true if the settings were applied.
+    */
+   bool Configure(const imu_spectrum_config_t &config, const char *&error);
+   /**
+    * @brief Current settings.
+    *
+    * @return const imu_spectrum_config_t& Settings.
+    */
+   const imu_spectrum_config_t &GetConfig() const;
+   /**
+    * @brief Discard collected samples.
+    */
+   void Reset();
+   /**
+    * @brief Add a sample, computing the spectra when a hop completes.
+    *
+    * @param sample Sample in raw counts.
+    * @return true if new spectra are ready.
+    */
+   bool Push(const imu_sample_t &sample);
+   /**
+    * @brief Number of analyzed channels.
+    *
+    * @return uint8_t Channel count.
+    */
+   uint8_t GetChannelCount() const;
+   /**
+    * @brief Channel analyzed in a slot, in imu_channel_t order.
+    *
+    * @param slot Slot from 0 to GetChannelCount() - 1.
+    * @return imu_channel_t Channel.
+    */
+   imu_channel_t GetChannel(uint8_t slot) const;
+   /**
+    * @brief Sample rate of the last window, or the configured rate before
+    *        the first one.
+    *
+    * @return float Rate in Hz.
+    */
+   float GetSampleRateHz() const;
+   /**
+    * @brief Width of one frequency bin at GetSampleRateHz().
+    *
+    * @return float Bin width in Hz.
+    */
+   float GetBinHz() const;
+   /**
+    * @brief Samples between consecutive spectra.
+    *
+    * @return uint16_t Hop length.
+    */
+   uint16_t GetHop() const;
+   /**
+    * @brief Number of spectra computed since the last configuration.
+    *
+    * @return uint32_t Window count.
+    */
+   uint32_t GetWindowCount() const;
+   /**
+    * @brief Timestamp of the newest sample of the last window.
+    *
+    * @return uint32_t millis() of the sample.
+    */
+   uint32_t GetTimestamp() const;
+   /**
+    * @brief Reduce a spectrum to equal-width bands from the first bin above
+    *        DC to the Nyquist frequency; each band is the root sum of squares
+    *        of its bins.
+    *
+    * @param slot Channel slot.
+    * @param bands Receives the band amplitudes.
+    * @param count Number of bands, at most size / 2.
+    * @return uint16_t Number of bands written.
+    */
+   uint16_t GetBands(uint8_t slot, float *bands, uint16_t count) const;
+   /**
+    * @brief Find the largest local maxima of a spectrum.
+    *
+    * @param slot Channel slot.
+    * @param peaks Receives the peaks, largest first.
+    * @param count Capacity of peaks.
+    * @return uint8_t Number of peaks written.
+    */
+   uint8_t GetPeaks(uint8_t slot, imu_spectrum_peak_t *peaks, uint8_t count) const;
+   /**
+    * @brief Map a window name ("rectangular", "hann", "hamming").
+    *
+    * @param name Window name.
+    * @param window Receives the window.
+    * @return true if the name is known.
+    */
+   static bool ParseWindow(const char *name, imu_window_t &window);
+   /**
+    * @brief Name of a window, as accepted by ParseWindow.
+    *
+    * @param window Window function.
+    * @return const char* Window name, "unknown" if out of range.
+    */
+   static const char *GetWindowName(imu_window_t window);
+
+private:
+   /**
+    * @brief Transform the newest window of every channel into m_Magnitude.
+    */
+   void Analyze();
+
+   imu_spectrum_config_t m_Config;
+   uint8_t m_ChannelCount;
+   imu_channel_t m_Channels[IMU_SPECTRUM_MAX_CHANNELS];
+   uint16_t m_Hop;
+   float m_AmplitudeScale;                                  // 2 / sum of the window
+   float m_Window[IMU_SPECTRUM_MAX_SIZE];
+   float m_History[IMU_SPECTRUM_MAX_CHANNELS][IMU_SPECTRUM_MAX_SIZE];   // Ring of recent samples
+   uint32_t m_Times[IMU_SPECTRUM_MAX_SIZE];                 // Timestamp of each ring entry
+   float m_SampleRateHz;        // Rate measured over the last window
+   float m_Work[IMU_SPECTRUM_MAX_SIZE];
+   float m_Magnitude[IMU_SPECTRUM_MAX_CHANNELS][IMU_SPECTRUM_MAX_SIZE / 2 + 1];
+   uint16_t m_Write;            // Next ring index
+   uint16_t m_Filled;           // Samples in the ring, up to the window size
+   uint16_t m_SinceAnalysis;    // Samples pushed since the last spectrum
+   uint32_t m_Windows;
+   uint32_t m_Timestamp;
+};
+
+#endif // !IMU_SPECTRUM_H
@@ -0,0 +1,102 @@
+/**
+ * @file ImuActivity.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the motion activity detector.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "ImuActivity.h"
+#include <math.h>
+
+static const float STANDARD_GRAVITY = 9.80665f;
+
+CImuActivityDetector::CImuActivityDetector() : m_Config(Default())
+{
+   Reset();
+}
+
+imu_activity_config_t CImuActivityDetector::Default()
+{
+   imu_activity_config_t config;
+   config.onset_accel = 1.0f;
+   config.onset_gyro = 0.35f;
+   config.rest_accel = 0.3f;
+   config.rest_gyro = 0.1f;
+   config.rest_ms = 3000;
+   return config;
+}
+
+bool CImuActivityDetector::Configure(const imu_activity_config_t &config, const char *&error)
+{
+   if (!(config.rest_accel > 0.0f) || !(config.rest_gyro > 0.0f))
+   {
+      error = "rest levels must be positive";
+      return false;
+   }
+   if (config.onset_accel < config.rest_accel || config.onset_gyro < config.rest_gyro)
+   {
+      error = "onset levels must not be below the rest levels";
+      return false;
+   }
+   m_Config = config;
+   Reset();
+   return true;
+}
+
+const imu_activity_config_t &CImuActivityDetector::GetConfig() const
+{
+   return m_Config;
+}
+
+bool CImuActivityDetector::Update(const imu_sample_t &sample)
+{
+   imu_data_t data = ImuRawToData(sample.raw);
+   float accel = fabsf(sqrtf(data.accX * data.accX + data.accY * data.accY + data.accZ * data.accZ) - STANDARD_GRAVITY);
+   float gyro = sqrtf(data.gyroX * data.gyroX + data.gyroY * data.gyroY + data.gyroZ * data.gyroZ);
+
+   if (accel > m_Config.onset_accel || gyro > m_Config.onset_gyro)
+   {
+      m_Quiet = false;
+      if (!m_Active)
+      {
+         m_Active = true;
+         return true;
+      }
+      return false;
+   }
+
+   // Between the rest and onset levels the state holds, but the quiet run
+   // has to start over.
+   if (accel >= m_Config.rest_accel || gyro >= m_Config.rest_gyro)
+   {
+      m_Quiet = false;
+      return false;
+   }
+   if (!m_Quiet)
+   {
+      m_Quiet = true;
+      m_QuietSinceMs = sample.timestamp;
+   }
+   if (m_Active && sample.timestamp - m_QuietSinceMs >= m_Config.rest_ms)
+   {
+      m_Active = false;
+      return true;
+   }
+   return false;
+}
+
+bool CImuActivityDetector::IsActive() const
+{
+   return m_Active;
+}
+
+void CImuActivityDetector::Reset()
+{
+   m_Active = true;
+   m_Quiet = false;
+   m_QuietSinceMs = 0;
+}
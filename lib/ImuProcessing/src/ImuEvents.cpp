@@ -0,0 +1,208 @@
+/**
+ * @file ImuEvents.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the IMU motion event engine.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "ImuEvents.h"
+#include <math.h>
+#include <string.h>
+
+// Turns a numeric limit into a literal so error messages follow the header
+#define IMU_EVENTS_STRINGIFY_(value) #value
+#define IMU_EVENTS_STRINGIFY(value) IMU_EVENTS_STRINGIFY_(value)
+
+static const char *const TYPE_NAMES[IMU_RULE_COUNT] = {"impact", "free_fall", "tilt", "rotation"};
+
+static const float STANDARD_GRAVITY = 9.80665f;
+
+CImuEventEngine::CImuEventEngine() : m_RuleCount(0)
+{
+   imu_event_rule_t rules[IMU_RULE_COUNT];
+   uint8_t count = GetDefaultRules(rules);
+   const char *error = "";
+   SetRules(rules, count, error);
+}
+
+uint8_t CImuEventEngine::GetDefaultRules(imu_event_rule_t *rules)
+{
+   rules[0] = {IMU_RULE_IMPACT, 3.0f * STANDARD_GRAVITY, 2.0f * STANDARD_GRAVITY, 0};
+   rules[1] = {IMU_RULE_FREE_FALL, 0.3f * STANDARD_GRAVITY, 0.6f * STANDARD_GRAVITY, 30};
+   rules[2] = {IMU_RULE_TILT, 45.0f, 35.0f, 250};
+   rules[3] = {IMU_RULE_ROTATION, 3.0f, 2.0f, 500};
+   return IMU_RULE_COUNT;
+}
+
+bool CImuEventEngine::SetRules(const imu_event_rule_t *rules, uint8_t count, const char *&error)
+{
+   if (count > IMU_EVENTS_MAX_RULES)
+   {
+      error = "at most " IMU_EVENTS_STRINGIFY(IMU_EVENTS_MAX_RULES) " rules";
+      return false;
+   }
+   for (uint8_t i = 0; i < count; i++)
+   {
+      const imu_event_rule_t &rule = rules[i];
+      if (rule.type >= IMU_RULE_COUNT)
+      {
+         error = "unknown rule type";
+         return false;
+      }
+      if (!(rule.threshold >= 0.0f) || !(rule.clear >= 0.0f))
+      {
+         error = "levels must not be negative";
+         return false;
+      }
+      // Hysteresis must point back to the quiet side, or the event could
+      // start and end on the same sample.
+      if (IsRising(rule.type) ? rule.clear > rule.threshold : rule.clear < rule.threshold)
+      {
+         error = "clear level must be on the quiet side of the threshold";
+         return false;
+      }
+   }
+
+   memcpy(m_Rules, rules, count * sizeof(imu_event_rule_t));
+   m_RuleCount = count;
+   Reset();
+   return true;
+}
+
+uint8_t CImuEventEngine::GetRuleCount() const
+{
+   return m_RuleCount;
+}
+
+const imu_event_rule_t &CImuEventEngine::GetRule(uint8_t index) const
+{
+   return m_Rules[index];
+}
+
+bool CImuEventEngine::IsActive(uint8_t index) const
+{
+   return index < m_RuleCount && m_State[index].active;
+}
+
+void CImuEventEngine::Reset()
+{
+   memset(m_State, 0, sizeof(m_State));
+}
+
+uint8_t CImuEventEngine::Evaluate(const imu_sample_t &sample, imu_event_t *events, uint8_t maxEvents)
+{
+   // Each quantity is derived once per sample, and only if a rule needs it
+   imu_data_t data = ImuRawToData(sample.raw);
+   float accel = -1.0f;
+   float values[IMU_RULE_COUNT];
+   bool haveValue[IMU_RULE_COUNT] = {false, false, false, false};
+
+   uint8_t count = 0;
+   for (uint8_t i = 0; i < m_RuleCount; i++)
+   {
+      const imu_event_rule_t &rule = m_Rules[i];
+      rule_state_t &state = m_State[i];
+
+      if (!haveValue[rule.type])
+      {
+         if (rule.type != IMU_RULE_ROTATION && accel < 0.0f)
+         {
+            accel = sqrtf(data.accX * data.accX + data.accY * data.accY + data.accZ * data.accZ);
+         }
+         switch (rule.type)
+         {
+         case IMU_RULE_TILT:
+            // Undefined while nothing is measured, e.g. in free fall
+            values[rule.type] = (accel > 0.0f) ? acosf(fmaxf(-1.0f, fminf(1.0f, data.accZ / accel))) * 57.2957795f : 0.0f;
+            break;
+         case IMU_RULE_ROTATION:
+            values[rule.type] = sqrtf(data.gyroX * data.gyroX + data.gyroY * data.gyroY + data.gyroZ * data.gyroZ);
+            break;
+         default:
+            values[rule.type] = accel;
+            break;
+         }
+         haveValue[rule.type] = true;
+      }
+      float value = values[rule.type];
+      bool rising = IsRising(rule.type);
+
+      bool changed = false;
+      if (!state.active)
+      {
+         bool met = rising ? value > rule.threshold : value < rule.threshold;
+         if (!met)
+         {
+            state.pending = false;
+            continue;
+         }
+         if (!state.pending)
+         {
+            state.pending = true;
+            state.sinceMs = sample.timestamp;
+         }
+         if (sample.timestamp - state.sinceMs < rule.hold_ms)
+         {
+            continue;
+         }
+         state.active = true;
+         state.pending = false;
+         state.sinceMs = sample.timestamp;
+         state.peak = value;
+         changed = true;
+      }
+      else
+      {
+         if (rising ? value > state.peak : value < state.peak)
+         {
+            state.peak = value;
+         }
+         if (rising ? value < rule.clear : value > rule.clear)
+         {
+            state.active = false;
+            changed = true;
+         }
+      }
+
+      if (changed && count < maxEvents)
+      {
+         imu_event_t &event = events[count++];
+         event.rule = i;
+         event.type = rule.type;
+         event.active = state.active;
+         event.value = value;
+         event.peak = state.peak;
+         event.duration_ms = state.active ? 0 : sample.timestamp - state.sinceMs;
+         event.sequence = sample.sequence;
+         event.timestamp = sample.timestamp;
+      }
+   }
+   return count;
+}
+
+bool CImuEventEngine::ParseType(const char *name, imu_rule_type_t &type)
+{
+   for (int i = 0; i < IMU_RULE_COUNT; i++)
+   {
+      if (strcmp(name, TYPE_NAMES[i]) == 0)
+      {
+         type = (imu_rule_type_t)i;
+         return true;
+      }
+   }
+   return false;
+}
+
+const char *CImuEventEngine::GetTypeName(imu_rule_type_t type)
+{
+   return (type < IMU_RULE_COUNT) ? TYPE_NAMES[type] : "unknown";
+}
+
+bool CImuEventEngine::IsRising(imu_rule_type_t type)
+{
+   return type != IMU_RULE_FREE_FALL;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file ImuHistory.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the multi-resolution IMU history.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "ImuHistory.h"
+#include <string.h>
+
+static const uint32_t PERIOD_MS[IMU_HISTORY_LEVELS] = {1000, 10000, 60000};
+
+CImuHistory::CImuHistory()
+{
+   Reset();
+}
+
+void CImuHistory::Reset()
+{
+   memset(m_Levels, 0, sizeof(m_Levels));
+}
+
+void CImuHistory::Add(const imu_sample_t &sample)
+{
+   imu_data_t data = ImuRawToData(sample.raw);
+   const float values[IMU_CHANNEL_COUNT] = {
+      data.accX, data.accY, data.accZ,
+      data.gyroX, data.gyroY, data.gyroZ,
+      data.temperature,
+   };
+
+   imu_history_bucket_t bucket;
+   bucket.start_ms = sample.timestamp;
+   bucket.count = 1;
+   memcpy(bucket.min, values, sizeof(values));
+   memcpy(bucket.max, values, sizeof(values));
+   memcpy(bucket.sum, values, sizeof(values));
+   Fold(0, bucket);
+}
+
+void CImuHistory::Fold(uint8_t level, const imu_history_bucket_t &bucket)
+{
+   level_t &history = m_Levels[level];
+   uint32_t startMs = bucket.start_ms - bucket.start_ms % PERIOD_MS[level];
+
+   if (history.open.count > 0 && history.open.start_ms != startMs)
+   {
+      // Store the finished bucket, overwriting the oldest once full, and
+      // pass it on to the next resolution
+      uint8_t slot = (history.head + history.count) % IMU_HISTORY_BUCKETS;
+      history.buckets[slot] = history.open;
+      if (history.count < IMU_HISTORY_BUCKETS)
+      {
+         history.count++;
+      }
+      else
+      {
+         history.head = (history.head + 1) % IMU_HISTORY_BUCKETS;
+      }
+      if (level + 1 < IMU_HISTORY_LEVELS)
+      {
+         Fold(level + 1, history.open);
+      }
+      history.open.count = 0;
+   }
+
+   if (history.open.count == 0)
+   {
+      history.open = bucket;
+      history.open.start_ms = startMs;
+   }
+   else
+   {
+      Merge(history.open, bucket);
+   }
+}
+
+void CImuHistory::Merge(imu_history_bucket_t &into, const imu_history_bucket_t &from)
+{
+   for (int channel = 0; channel < IMU_CHANNEL_COUNT; channel++)
+   {
+      into.min[channel] = (from.min[channel] < into.min[channel]) ? from.min[channel] : into.min[channel];
+      into.max[channel] = (from.max[channel] > into.max[channel]) ? from.max[channel] : into.max[channel];
+      into.sum[channel] += from.sum[channel];
+   }
+   into.count += from.count;
+}
+
+uint32_t CImuHistory::GetPeriodMs(uint8_t level)
+{
+   return PERIOD_MS[level];
+}
+
+uint8_t CImuHistory::SelectLevel(uint32_t fromMs, uint32_t toMs, uint16_t points) const
+{
+   // Coarser levels reach further back, so the levels holding the start of
+   // the range are the finest such level and every one above it
+   uint8_t finest = IMU_HISTORY_LEVELS - 1;
+   for (int level = IMU_HISTORY_LEVELS - 1; level >= 0; level--)
+   {
+      const level_t &history = m_Levels[level];
+      bool holds = history.count < IMU_HISTORY_BUCKETS || history.buckets[history.head].start_ms <= fromMs;
+      if (!holds)
+      {
+         break;
+      }
+      finest = level;
+   }
+
+   for (int level = IMU_HISTORY_LEVELS - 1; level > finest; level--)
+   {
+      uint32_t buckets = toMs / PERIOD_MS[level] - fromMs / PERIOD_MS[level] + 1;
+      if (buckets >= points)
+      {
+         return level;
+      }
+   }
+   return finest;
+}
+
+uint8_t CImuHistory::GetOpen(uint8_t level, imu_history_bucket_t *buckets) const
+{
+   // Finer open buckets are as new as or newer than the coarser ones and
+   // have not been folded in yet
+   uint8_t count = 0;
+   for (int finer = level; finer >= 0; finer--)
+   {
+      const imu_history_bucket_t &open = m_Levels[finer].open;
+      if (open.count == 0)
+      {
+         continue;
+      }
+      uint32_t startMs = open.start_ms - open.start_ms % PERIOD_MS[level];
+      if (count > 0 && buckets[count - 1].start_ms == startMs)
+      {
+         Merge(buckets[count - 1], open);
+      }
+      else
+      {
+         buckets[count] = open;
+         buckets[count].start_ms = startMs;
+         count++;
+      }
+   }
+   return count;
+}
+
+uint16_t CImuHistory::Count(uint8_t level, uint32_t fromMs, uint32_t toMs) const
+{
+   return Query(level, fromMs, toMs, 0, NULL, 0);
+}
+
+uint16_t CImuHistory::Query(uint8_t level, uint32_t fromMs, uint32_t toMs, uint16_t first,
+                            imu_history_bucket_t *buckets, uint16_t maxBuckets) const
+{
+   const level_t &history = m_Levels[level];
+   imu_history_bucket_t open[IMU_HISTORY_LEVELS];
+   uint8_t openCount = GetOpen(level, open);
+
+   // Walk closed then open buckets, oldest first; without an output array
+   // only the buckets in range are counted
+   uint16_t index = 0;
+   uint16_t copied = 0;
+   for (uint16_t i = 0; i < history.count + openCount; i++)
+   {
+      const imu_history_bucket_t &bucket = (i < history.count)
+                                              ? history.buckets[(history.head + i) % IMU_HISTORY_BUCKETS]
+                                              : open[i - history.count];
+      if (bucket.start_ms + PERIOD_MS[level] <= fromMs || bucket.start_ms > toMs)
+      {
+         continue;
+      }
+      if (buckets == NULL)
+      {
+         index++;
+         continue;
+      }
+      if (index++ < first)
+      {
+         continue;
+      }
+      if (copied == maxBuckets)
+      {
+         break;
+      }
+      buckets[copied++] = bucket;
+   }
+   return (buckets == NULL) ? index : copied;
+}
@@ -0,0 +1,196 @@
+/**
+ * @file ImuKernels.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Portable and ESP-DSP implementations of the IMU array kernels.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "ImuKernels.h"
+#include <math.h>
+
+#ifdef IMU_KERNELS_ESP_DSP
+#include <esp_dsp.h>
+#endif
+
+void CImuKernels::SubtractBias(float *data, size_t length, float bias)
+{
+#ifdef IMU_KERNELS_ESP_DSP
+   dsps_addc_f32(data, data, (int)length, -bias, 1, 1);
+#else
+   for (size_t i = 0; i < length; i++)
+   {
+      data[i] -= bias;
+   }
+#endif
+}
+
+void CImuKernels::Reduce(const float *__restrict in, size_t length, float &minimum, float &maximum, float &mean)
+{
+   // Four independent lanes: compare-and-select maps onto vector min/max and
+   // partial sums break the add chain without reassociating under -ffast-math.
+   // ESP-DSP has no min/max kernel to defer to.
+   float lo[4] = {in[0], in[0], in[0], in[0]};
+   float hi[4] = {in[0], in[0], in[0], in[0]};
+   float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+   size_t i = 0;
+   for (; i + 4 <= length; i += 4)
+   {
+      for (int lane = 0; lane < 4; lane++)
+      {
+         float value = in[i + lane];
+         lo[lane] = (value < lo[lane]) ? value : lo[lane];
+         hi[lane] = (value > hi[lane]) ? value : hi[lane];
+         sum[lane] += value;
+      }
+   }
+   for (; i < length; i++)
+   {
+      lo[0] = (in[i] < lo[0]) ? in[i] : lo[0];
+      hi[0] = (in[i] > hi[0]) ? in[i] : hi[0];
+      sum[0] += in[i];
+   }
+   for (int lane = 1; lane < 4; lane++)
+   {
+      lo[0] = (lo[lane] < lo[0]) ? lo[lane] : lo[0];
+      hi[0] = (hi[lane] > hi[0]) ? hi[lane] : hi[0];
+   }
+   minimum = lo[0];
+   maximum = hi[0];
+   mean = ((sum[0] + sum[1]) + (sum[2] + sum[3])) / length;
+}
+
+/**
+ * @brief e^(-2*pi*i*k/IMU_KERNELS_MAX_FFT) for the first half turn, as
+ *        (cos, sin) pairs; smaller transforms step through it.
+ */
+static float s_Twiddle[IMU_KERNELS_MAX_FFT];
+static bool s_FftReady = false;
+
+bool CImuKernels::InitFft()
+{
+   if (s_FftReady)
+   {
+      return true;
+   }
+#ifdef IMU_KERNELS_ESP_DSP
+   if (dsps_fft2r_init_fc32(NULL, IMU_KERNELS_MAX_FFT / 2) != ESP_OK)
+   {
+      return false;
+   }
+#endif
+   for (size_t k = 0; k < IMU_KERNELS_MAX_FFT / 2; k++)
+   {
+      double angle = -2.0 * M_PI * k / IMU_KERNELS_MAX_FFT;
+      s_Twiddle[2 * k] = (float)cos(angle);
+      s_Twiddle[2 * k + 1] = (float)sin(angle);
+   }
+   s_FftReady = true;
+   return true;
+}
+
+/**
+ * @brief In-place radix-2 complex FFT over interleaved (re, im) pairs.
+ */
+static void ComplexFft(float *data, size_t points)
+{
+#ifdef IMU_KERNELS_ESP_DSP
+   dsps_fft2r_fc32(data, (int)points);
+   dsps_bit_rev_fc32(data, (int)points);
+#else
+   // Bit-reversal permutation
+   for (size_t i = 1, j = 0; i < points; i++)
+   {
+      size_t bit = points >> 1;
+      for (; j & bit; bit >>= 1)
+      {
+         j ^= bit;
+      }
+      j |= bit;
+      if (i < j)
+      {
+         float re = data[2 * i];
+         float im = data[2 * i + 1];
+         data[2 * i] = data[2 * j];
+         data[2 * i + 1] = data[2 * j + 1];
+         data[2 * j] = re;
+         data[2 * j + 1] = im;
+      }
+   }
+
+   // Butterflies; a span of n points uses every (MAX/n)-th twiddle
+   for (size_t span = 2; span <= points; span <<= 1)
+   {
+      size_t step = IMU_KERNELS_MAX_FFT / span;
+      size_t half = span >> 1;
+      for (size_t start = 0; start < points; start += span)
+      {
+         for (size_t k = 0; k < half; k++)
+         {
+            float wr = s_Twiddle[2 * k * step];
+            float wi = s_Twiddle[2 * k * step + 1];
+            float *a = &data[2 * (start + k)];
+            float *b = &data[2 * (start + k + half)];
+            float tr = b[0] * wr - b[1] * wi;
+            float ti = b[0] * wi + b[1] * wr;
+            b[0] = a[0] - tr;
+            b[1] = a[1] - ti;
+            a[0] += tr;
+            a[1] += ti;
+         }
+      }
+   }
+#endif
+}
+
+bool CImuKernels::RealFft(float *data, size_t length)
+{
+   if (!s_FftReady || length < 4 || length > IMU_KERNELS_MAX_FFT || (length & (length - 1)) != 0)
+   {
+      return false;
+   }
+
+   // Even samples as the real part, odd as the imaginary part
+   size_t half = length / 2;
+   ComplexFft(data, half);
+
+   // Split the half-length transform Z into the spectrum X of the real input:
+   // X[k] = (Z[k] + conj(Z[h-k])) / 2 - i/2 * W^k * (Z[k] - conj(Z[h-k]))
+   size_t step = IMU_KERNELS_MAX_FFT / length;
+   float dc = data[0] + data[1];
+   float nyquist = data[0] - data[1];
+   for (size_t k = 1; k <= half / 2; k++)
+   {
+      size_t j = half - k;
+      float zkr = data[2 * k], zki = data[2 * k + 1];
+      float zjr = data[2 * j], zji = data[2 * j + 1];
+      float evenR = (zkr + zjr) * 0.5f;
+      float evenI = (zki - zji) * 0.5f;
+      float oddR = (zki + zji) * 0.5f;
+      float oddI = (zjr - zkr) * 0.5f;
+      float wr = s_Twiddle[2 * k * step];
+      float wi = s_Twiddle[2 * k * step + 1];
+      float tr = wr * oddR - wi * oddI;
+      float ti = wr * oddI + wi * oddR;
+      data[2 * k] = evenR + tr;
+      data[2 * k + 1] = evenI + ti;
+      // X[h-k] = conj(even - W^k * odd)
+      data[2 * j] = evenR - tr;
+      data[2 * j + 1] = ti - evenI;
+   }
+   data[0] = dc;
+   data[1] = nyquist;
+   return true;
+}
+
+const char *CImuKernels::GetBackendName()
+{
+#ifdef IMU_KERNELS_ESP_DSP
+   return "esp-dsp";
+#else
+   return "portable";
+#endif
+}
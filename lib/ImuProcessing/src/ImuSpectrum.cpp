@@ -0,0 +1,327 @@
+/**
+ * @file ImuSpectrum.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the IMU spectrum analyzer.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "ImuSpectrum.h"
+#include "ImuKernels.h"
+#include <math.h>
+#include <string.h>
+
+// Turns a numeric limit into a literal so error messages follow the header
+#define IMU_SPECTRUM_STRINGIFY_(value) #value
+#define IMU_SPECTRUM_STRINGIFY(value) IMU_SPECTRUM_STRINGIFY_(value)
+
+static const char *const WINDOW_NAMES[IMU_WINDOW_COUNT] = {"rectangular", "hann", "hamming"};
+
+CImuSpectrum::CImuSpectrum()
+   : m_ChannelCount(0), m_Hop(0), m_AmplitudeScale(0.0f), m_SampleRateHz(0.0f), m_Write(0), m_Filled(0),
+     m_SinceAnalysis(0), m_Windows(0), m_Timestamp(0)
+{
+   memset(&m_Config, 0, sizeof(m_Config));
+   memset(m_Magnitude, 0, sizeof(m_Magnitude));
+}
+
+bool CImuSpectrum::Configure(const imu_spectrum_config_t &config, const char *&error)
+{
+   if (config.size < 16 || config.size > IMU_SPECTRUM_MAX_SIZE || (config.size & (config.size - 1)) != 0)
+   {
+      error = "size must be a power of two from 16 to 512";
+      return false;
+   }
+   if (!(config.overlap >= 0.0f && config.overlap <= IMU_SPECTRUM_MAX_OVERLAP))
+   {
+      error = "overlap must be between 0 and 0.875";
+      return false;
+   }
+   if (config.window >= IMU_WINDOW_COUNT)
+   {
+      error = "unknown window";
+      return false;
+   }
+   if (!(config.sample_rate_hz > 0.0f))
+   {
+      error = "sample rate unknown";
+      return false;
+   }
+   uint8_t channelCount = 0;
+   imu_channel_t channels[IMU_SPECTRUM_MAX_CHANNELS];
+   for (int channel = 0; channel < IMU_CHANNEL_COUNT; channel++)
+   {
+      if (config.channels & (1 << channel))
+      {
+         if (channelCount == IMU_SPECTRUM_MAX_CHANNELS)
+         {
+            error = "at most " IMU_SPECTRUM_STRINGIFY(IMU_SPECTRUM_MAX_CHANNELS) " channels";
+            return false;
+         }
+         channels[channelCount++] = (imu_channel_t)channel;
+      }
+   }
+   if (channelCount == 0)
+   {
+      error = "no channel selected";
+      return false;
+   }
+   if (!CImuKernels::InitFft())
+   {
+      error = "FFT tables unavailable";
+      return false;
+   }
+
+   m_Config = config;
+   m_ChannelCount = channelCount;
+   memcpy(m_Channels, channels, sizeof(channels));
+   m_Hop = config.size - (uint16_t)(config.size * config.overlap + 0.5f);
+   if (m_Hop == 0)
+   {
+      m_Hop = 1;
+   }
+
+   float sum = 0.0f;
+   for (uint16_t i = 0; i < config.size; i++)
+   {
+      float phase = 2.0f * (float)M_PI * i / config.size;
+      switch (config.window)
+      {
+      case IMU_WINDOW_HANN: m_Window[i] = 0.5f - 0.5f * cosf(phase); break;
+      case IMU_WINDOW_HAMMING: m_Window[i] = 0.54f - 0.46f * cosf(phase); break;
+      default: m_Window[i] = 1.0f; break;
+      }
+      sum += m_Window[i];
+   }
+   // Single-sided amplitude: a sine of amplitude A peaks at A
+   m_AmplitudeScale = 2.0f / sum;
+   m_SampleRateHz = config.sample_rate_hz;
+   m_Windows = 0;
+   Reset();
+   return true;
+}
+
+const imu_spectrum_config_t &CImuSpectrum::GetConfig() const
+{
+   return m_Config;
+}
+
+void CImuSpectrum::Reset()
+{
+   m_Write = 0;
+   m_Filled = 0;
+   m_SinceAnalysis = 0;
+}
+
+bool CImuSpectrum::Push(const imu_sample_t &sample)
+{
+   if (m_ChannelCount == 0)
+   {
+      return false;
+   }
+
+   // Only the analyzed channels are converted to units
+   for (uint8_t slot = 0; slot < m_ChannelCount; slot++)
+   {
+      imu_channel_t channel = m_Channels[slot];
+      float value;
+      if (channel <= IMU_CHANNEL_ACC_Z)
+      {
+         value = sample.raw.acc[channel - IMU_CHANNEL_ACC_X] * IMU_ACCEL_LSB_MS2 * (1 << sample.raw.accel_fs);
+      }
+      else if (channel <= IMU_CHANNEL_GYRO_Z)
+      {
+         value = sample.raw.gyro[channel - IMU_CHANNEL_GYRO_X] * IMU_GYRO_LSB_RADS * (1 << sample.raw.gyro_fs);
+      }
+      else
+      {
+         value = sample.raw.temperature * IMU_TEMPERATURE_LSB_C + IMU_TEMPERATURE_ZERO_C;
+      }
+      m_History[slot][m_Write] = value;
+   }
+   m_Times[m_Write] = sample.timestamp;
+   m_Write = (m_Write + 1) % m_Config.size;
+   m_Timestamp = sample.timestamp;
+   if (m_Filled < m_Config.size)
+   {
+      m_Filled++;
+   }
+   m_SinceAnalysis++;
+
+   if (m_Filled < m_Config.size || m_SinceAnalysis < m_Hop)
+   {
+      return false;
+   }
+   m_SinceAnalysis = 0;
+   Analyze();
+   m_Windows++;
+   return true;
+}
+
+void CImuSpectrum::Analyze()
+{
+   uint16_t size = m_Config.size;
+   uint16_t bins = size / 2;
+
+   // The ring is full, so m_Write indexes the oldest sample. A window
+   // spanning no time (timestamps held or missing) keeps the last rate.
+   uint32_t spanMs = m_Timestamp - m_Times[m_Write];
+   if (spanMs > 0)
+   {
+      m_SampleRateHz = (size - 1) * 1000.0f / spanMs;
+   }
+
+   for (uint8_t slot = 0; slot < m_ChannelCount; slot++)
+   {
+      // Unroll the ring oldest first, then remove the mean
+      uint16_t tail = size - m_Write;
+      memcpy(m_Work, &m_History[slot][m_Write], tail * sizeof(float));
+      memcpy(m_Work + tail, m_History[slot], m_Write * sizeof(float));
+      float minimum, maximum, mean;
+      CImuKernels::Reduce(m_Work, size, minimum, maximum, mean);
+      CImuKernels::SubtractBias(m_Work, size, mean);
+      for (uint16_t i = 0; i < size; i++)
+      {
+         m_Work[i] *= m_Window[i];
+      }
+
+      CImuKernels::RealFft(m_Work, size);
+
+      float *magnitude = m_Magnitude[slot];
+      magnitude[0] = fabsf(m_Work[0]) * m_AmplitudeScale * 0.5f;
+      magnitude[bins] = fabsf(m_Work[1]) * m_AmplitudeScale * 0.5f;
+      for (uint16_t k = 1; k < bins; k++)
+      {
+         float re = m_Work[2 * k];
+         float im = m_Work[2 * k + 1];
+         magnitude[k] = sqrtf(re * re + im * im) * m_AmplitudeScale;
+      }
+   }
+}
+
+uint8_t CImuSpectrum::GetChannelCount() const
+{
+   return m_ChannelCount;
+}
+
+imu_channel_t CImuSpectrum::GetChannel(uint8_t slot) const
+{
+   return (slot < m_ChannelCount) ? m_Channels[slot] : IMU_CHANNEL_COUNT;
+}
+
+float CImuSpectrum::GetSampleRateHz() const
+{
+   return m_SampleRateHz;
+}
+
+float CImuSpectrum::GetBinHz() const
+{
+   return (m_Config.size > 0) ? m_SampleRateHz / m_Config.size : 0.0f;
+}
+
+uint16_t CImuSpectrum::GetHop() const
+{
+   return m_Hop;
+}
+
+uint32_t CImuSpectrum::GetWindowCount() const
+{
+   return m_Windows;
+}
+
+uint32_t CImuSpectrum::GetTimestamp() const
+{
+   return m_Timestamp;
+}
+
+uint16_t CImuSpectrum::GetBands(uint8_t slot, float *bands, uint16_t count) const
+{
+   uint16_t bins = m_Config.size / 2;
+   if (slot >= m_ChannelCount || count == 0)
+   {
+      return 0;
+   }
+   if (count > bins)
+   {
+      count = bins;
+   }
+
+   // Bins 1..bins split as evenly as integer division allows
+   const float *magnitude = m_Magnitude[slot];
+   for (uint16_t band = 0; band < count; band++)
+   {
+      uint16_t first = 1 + (uint32_t)band * bins / count;
+      uint16_t last = (uint32_t)(band + 1) * bins / count;
+      float energy = 0.0f;
+      for (uint16_t k = first; k <= last; k++)
+      {
+         energy += magnitude[k] * magnitude[k];
+      }
+      bands[band] = sqrtf(energy);
+   }
+   return count;
+}
+
+uint8_t CImuSpectrum::GetPeaks(uint8_t slot, imu_spectrum_peak_t *peaks, uint8_t count) const
+{
+   if (slot >= m_ChannelCount || count == 0)
+   {
+      return 0;
+   }
+
+   const float *magnitude = m_Magnitude[slot];
+   uint16_t bins = m_Config.size / 2;
+   float binHz = GetBinHz();
+   uint8_t found = 0;
+   for (uint16_t k = 1; k < bins; k++)
+   {
+      if (magnitude[k] <= magnitude[k - 1] || magnitude[k] < magnitude[k + 1])
+      {
+         continue;
+      }
+      if (found == count && magnitude[k] <= peaks[found - 1].magnitude)
+      {
+         continue;
+      }
+
+      // Parabola through the peak and its neighbours
+      float left = magnitude[k - 1];
+      float right = magnitude[k + 1];
+      float denominator = left - 2.0f * magnitude[k] + right;
+      float shift = (denominator != 0.0f) ? 0.5f * (left - right) / denominator : 0.0f;
+      imu_spectrum_peak_t peak;
+      peak.frequency_hz = (k + shift) * binHz;
+      peak.magnitude = magnitude[k] - 0.25f * (left - right) * shift;
+
+      // Insert in descending order, dropping the smallest when full
+      uint8_t position = (found < count) ? found++ : count - 1;
+      while (position > 0 && peaks[position - 1].magnitude < peak.magnitude)
+      {
+         peaks[position] = peaks[position - 1];
+         position--;
+      }
+      peaks[position] = peak;
+   }
+   return found;
+}
+
+bool CImuSpectrum::ParseWindow(const char *name, imu_window_t &window)
+{
+   for (int i = 0; i < IMU_WINDOW_COUNT; i++)
+   {
+      if (strcmp(name, WINDOW_NAMES[i]) == 0)
+      {
+         window = (imu_window_t)i;
+         return true;
+      }
+   }
+   return false;
+}
+
+const char *CImuSpectrum::GetWindowName(imu_window_t window)
+{
+   return (window < IMU_WINDOW_COUNT) ? WINDOW_NAMES[window] : "unknown";
+}
@@ -0,0 +1,175 @@
+/**
+ * @file ImuSnapshotCache.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief A cache of serialized IMU snapshots keyed by sample sequence number.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef IMU_SNAPSHOT_CACHE_H
+#define IMU_SNAPSHOT_CACHE_H
+
+#include <Arduino.h>
+#include "SensorData.h"
+#include <LatestValue.h>
+
+/**
+ * @brief Largest serialized JSON snapshot, in bytes.
+ */
+#define IMU_SNAPSHOT_MAX_JSON 256
+
+/**
+ * @brief Size of the binary snapshot: sequence, timestamp and seven
+ *        little-endian floats.
+ */
+#define IMU_SNAPSHOT_BINARY_SIZE (2 * sizeof(uint32_t) + 7 * sizeof(float))
+
+/**
+ * @brief Size of the raw snapshot: the imu_sample_t as stored, i.e.
+ *        sequence, timestamp, seven little-endian int16 counts and the two
+ *        full-scale codes.
+ */
+#define IMU_SNAPSHOT_RAW_SIZE sizeof(imu_sample_t)
+
+/**
+ * @brief Subsets of the sample that can be requested.
+ */
+typedef enum {
+   IMU_PROJECTION_ALL,
+   IMU_PROJECTION_ACC,
+   IMU_PROJECTION_GYRO,
+   IMU_PROJECTION_ACC_X,
+   IMU_PROJECTION_ACC_Y,
+   IMU_PROJECTION_ACC_Z,
+   IMU_PROJECTION_GYRO_X,
+   IMU_PROJECTION_GYRO_Y,
+   IMU_PROJECTION_GYRO_Z,
+   IMU_PROJECTION_TEMPERATURE,
+   IMU_PROJECTION_COUNT,
+   IMU_PROJECTION_INVALID = IMU_PROJECTION_COUNT
+} imu_projection_t;
+
+/**
+ * @brief JSON dialects spoken by the endpoints.
+ */
+typedef enum {
+   IMU_JSON_GRPC,   // snake_case keys with timestamp, sequence and success
+   IMU_JSON_WEB,    // camelCase keys only, as served by the web server
+   IMU_JSON_STYLE_COUNT
+} imu_json_style_t;
+
+/**
+ * @brief Cache effectiveness counters.
+ */
+typedef struct {
+   uint32_t hits;       // Requests served from an already encoded payload
+   uint32_t rebuilds;   // Payloads encoded after a new sample
+} imu_snapshot_stats_t;
+
+/**
+ * @brief Holds the latest IMU sample and its encodings. Each encoding is
+ *        built lazily on the first request after a new sample and reused by
+ *        every later request for the same sample, so serialization cost per
+ *        sample does not grow with the number of pollers.
+ */
+class CImuSnapshotCache
+{
+public:
+   /**
+    * @brief Get the process-wide cache instance.
+    *
+    * @return CImuSnapshotCache* Shared cache.
+    */
+   static CImuSnapshotCache *Instance();
+   /**
+    * @brief Publish a new sample. Samples not newer than the current one are
+    *        ignored, so several endpoints may forward the same sample.
+    *
+    * @param sample Sample read from the sensor.
+    * @return true if the sample replaced the current one.
+    */
+   bool Publish(const imu_sample_t &sample);
+   /**
+    * @brief Get a copy of the current sample. Lock-free and safe from any task.
+    *
+    * @return imu_sample_t Current sample.
+    */
+   imu_sample_t GetSample();
+   /**
+    * @brief Copy the JSON encoding of the current sample.
+    *
+    * @param style JSON dialect.
+    * @param projection Fields to include.
+    * @param out Destination buffer, at least IMU_SNAPSHOT_MAX_JSON bytes.
+    * @param outSize Size of the destination buffer.
+    * @return size_t Length of the payload (0 on error).
+    */
+   size_t CopyJson(imu_json_style_t style, imu_projection_t projection, char *out, size_t outSize);
+   /**
+    * @brief Copy the binary encoding of the current sample.
+    *
+    * @param out Destination buffer of IMU_SNAPSHOT_BINARY_SIZE bytes.
+    * @return size_t Length of the payload.
+    */
+   size_t CopyBinary(uint8_t *out);
+   /**
+    * @brief Copy the current sample as raw counts, without conversion.
+    *        Lock-free.
+    *
+    * @param out Destination buffer of IMU_SNAPSHOT_RAW_SIZE bytes.
+    * @return size_t Length of the payload.
+    */
+   size_t CopyRaw(uint8_t *out);
+   /**
+    * @brief Get and reset the cache counters.
+    *
+    * @return imu_snapshot_stats_t Counters since the last call.
+    */
+   imu_snapshot_stats_t TakeStats();
+   /**
+    * @brief Map a request parameter ("acc", "gyrox", ...) to a projection.
+    *
+    * @param parameter Parameter name.
+    * @return imu_projection_t Projection, or IMU_PROJECTION_INVALID.
+    */
+   static imu_projection_t ParseProjection(const String &parameter);
+
+private:
+   CImuSnapshotCache();
+
+   /**
+    * @brief One encoded payload and the sample it was built from.
+    */
+   typedef struct {
+      uint32_t sequence;
+      uint16_t length;
+      bool valid;
+      char payload[IMU_SNAPSHOT_MAX_JSON];
+   } json_entry_t;
+
+   /**
+    * @brief Encode m_Encoded into an entry. Caller holds m_Lock.
+    *
+    * @param style JSON dialect.
+    * @param projection Fields to include.
+    * @param entry Entry to fill.
+    */
+   void EncodeJson(imu_json_style_t style, imu_projection_t projection, json_entry_t &entry);
+
+   // Latest sample, readable without the lock.
+   CLatestValue<imu_sample_t> m_Sample;
+   // Sample being encoded, taken from m_Sample under the lock.
+   imu_sample_t m_Encoded;
+   json_entry_t m_Json[IMU_JSON_STYLE_COUNT][IMU_PROJECTION_COUNT];
+   uint8_t m_Binary[IMU_SNAPSHOT_BINARY_SIZE];
+   uint32_t m_BinarySequence;
+   bool m_BinaryValid;
+   imu_snapshot_stats_t m_Stats;
+   SemaphoreHandle_t m_Lock;
+   StaticSemaphore_t m_LockBuffer;
+};
+
+#endif // !IMU_SNAPSHOT_CACHE_H
@@ -0,0 +1,191 @@
+/**
+ * @file ImuSnapshotCache.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the serialized IMU snapshot cache.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "ImuSnapshotCache.h"
+#include <ArduinoJson.h>
+#include <JsonPoolAllocator.h>
+
+/**
+ * @brief Field keys in sample order (acc xyz, gyro xyz, temperature) per dialect.
+ */
+static const char *const JSON_KEYS[IMU_JSON_STYLE_COUNT][7] = {
+   {"acc_x", "acc_y", "acc_z", "gyro_x", "gyro_y", "gyro_z", "temperature"},
+   {"accX", "accY", "accZ", "gyroX", "gyroY", "gyroZ", "temperature"},
+};
+
+/**
+ * @brief Request parameter names, indexed by projection.
+ */
+static const char *const PROJECTION_NAMES[IMU_PROJECTION_COUNT] = {
+   "all", "acc", "gyro", "accx", "accy", "accz", "gyrox", "gyroy", "gyroz", "temperature",
+};
+
+/**
+ * @brief Bit mask of the fields included in each projection, in sample order.
+ */
+static const uint8_t PROJECTION_FIELDS[IMU_PROJECTION_COUNT] = {
+   0x7F, 0x07, 0x38, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40,
+};
+
+CImuSnapshotCache *CImuSnapshotCache::Instance()
+{
+   static CImuSnapshotCache cache;
+   return &cache;
+}
+
+CImuSnapshotCache::CImuSnapshotCache() : m_BinarySequence(0), m_BinaryValid(false)
+{
+   memset(&m_Encoded, 0, sizeof(imu_sample_t));
+   memset(m_Json, 0, sizeof(m_Json));
+   memset(&m_Stats, 0, sizeof(imu_snapshot_stats_t));
+   m_Lock = xSemaphoreCreateMutexStatic(&m_LockBuffer);
+}
+
+bool CImuSnapshotCache::Publish(const imu_sample_t &sample)
+{
+   // The lock only serializes publishers; readers of the sample never take it.
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   // Compare with wrap-around so the cache keeps working after 2^32 samples.
+   bool newer = (int32_t)(sample.sequence - m_Sample.Load().sequence) > 0;
+   if (newer)
+   {
+      // Entries are invalidated implicitly by the sequence change.
+      m_Sample.Store(sample);
+   }
+   xSemaphoreGive(m_Lock);
+   return newer;
+}
+
+imu_sample_t CImuSnapshotCache::GetSample()
+{
+   return m_Sample.Load();
+}
+
+size_t CImuSnapshotCache::CopyJson(imu_json_style_t style, imu_projection_t projection, char *out, size_t outSize)
+{
+   if (style >= IMU_JSON_STYLE_COUNT || projection >= IMU_PROJECTION_COUNT)
+   {
+      return 0;
+   }
+
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   m_Encoded = m_Sample.Load();
+   json_entry_t &entry = m_Json[style][projection];
+   if (!entry.valid || entry.sequence != m_Encoded.sequence)
+   {
+      EncodeJson(style, projection, entry);
+      m_Stats.rebuilds++;
+   }
+   else
+   {
+      m_Stats.hits++;
+   }
+
+   size_t length = 0;
+   if (entry.length < outSize)
+   {
+      memcpy(out, entry.payload, entry.length + 1);
+      length = entry.length;
+   }
+   xSemaphoreGive(m_Lock);
+   return length;
+}
+
+size_t CImuSnapshotCache::CopyBinary(uint8_t *out)
+{
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   m_Encoded = m_Sample.Load();
+   if (!m_BinaryValid || m_BinarySequence != m_Encoded.sequence)
+   {
+      // ESP32 is little-endian, so the packed layout is the in-memory layout.
+      imu_data_t data = ImuRawToData(m_Encoded.raw);
+      const float values[7] = {
+         data.accX, data.accY, data.accZ,
+         data.gyroX, data.gyroY, data.gyroZ,
+         data.temperature,
+      };
+      memcpy(m_Binary, &m_Encoded.sequence, sizeof(uint32_t));
+      memcpy(m_Binary + sizeof(uint32_t), &m_Encoded.timestamp, sizeof(uint32_t));
+      memcpy(m_Binary + 2 * sizeof(uint32_t), values, sizeof(values));
+      m_BinarySequence = m_Encoded.sequence;
+      m_BinaryValid = true;
+      m_Stats.rebuilds++;
+   }
+   else
+   {
+      m_Stats.hits++;
+   }
+   memcpy(out, m_Binary, IMU_SNAPSHOT_BINARY_SIZE);
+   xSemaphoreGive(m_Lock);
+   return IMU_SNAPSHOT_BINARY_SIZE;
+}
+
+size_t CImuSnapshotCache::CopyRaw(uint8_t *out)
+{
+   // The stored sample is the wire format; nothing to encode or cache.
+   imu_sample_t sample = m_Sample.Load();
+   memcpy(out, &sample, IMU_SNAPSHOT_RAW_SIZE);
+   return IMU_SNAPSHOT_RAW_SIZE;
+}
+
+imu_snapshot_stats_t CImuSnapshotCache::TakeStats()
+{
+   xSemaphoreTake(m_Lock, portMAX_DELAY);
+   imu_snapshot_stats_t stats = m_Stats;
+   memset(&m_Stats, 0, sizeof(imu_snapshot_stats_t));
+   xSemaphoreGive(m_Lock);
+   return stats;
+}
+
+imu_projection_t CImuSnapshotCache::ParseProjection(const String &parameter)
+{
+   if (parameter.length() == 0)
+   {
+      return IMU_PROJECTION_ALL;
+   }
+   for (int projection = 0; projection < IMU_PROJECTION_COUNT; projection++)
+   {
+      if (parameter == PROJECTION_NAMES[projection])
+      {
+         return (imu_projection_t)projection;
+      }
+   }
+   return IMU_PROJECTION_INVALID;
+}
+
+void CImuSnapshotCache::EncodeJson(imu_json_style_t style, imu_projection_t projection, json_entry_t &entry)
+{
+   imu_data_t data = ImuRawToData(m_Encoded.raw);
+   const float values[7] = {
+      data.accX, data.accY, data.accZ,
+      data.gyroX, data.gyroY, data.gyroZ,
+      data.temperature,
+   };
+
+   JsonDocument doc(CJsonPoolAllocator::Instance());
+   for (uint8_t field = 0; field < 7; field++)
+   {
+      if (PROJECTION_FIELDS[projection] & (1 << field))
+      {
+         doc[JSON_KEYS[style][field]] = values[field];
+      }
+   }
+   if (style == IMU_JSON_GRPC)
+   {
+      doc["timestamp"] = m_Encoded.timestamp;
+      doc["sequence"] = m_Encoded.sequence;
+      doc["success"] = true;
+   }
+
+   entry.length = serializeJson(doc, entry.payload, sizeof(entry.payload));
+   entry.sequence = m_Encoded.sequence;
+   entry.valid = true;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file ImuConfig.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Runtime IMU configuration: output data rates, full-scale ranges and
+ *        per-channel read rates.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef IMU_CONFIG_H
+#define IMU_CONFIG_H
+
+#include <stdint.h>
+
+/**
+ * @brief Fastest rate at which the sensor task reads any channel, in Hz.
+ */
+#define IMU_MAX_READ_RATE_HZ 1000
+
+/**
+ * @brief Sensor configuration. Output data rates are the rates the sensor
+ *        produces data at; read rates are how often the sensor task fetches
+ *        each channel over I2C. A read rate of 0 stops reading the channel.
+ */
+typedef struct {
+   uint16_t accel_odr_hz;       // 0 (off), 12 (12.5Hz), 26, 52, 104, 208, 416, 833, 1660, 3330, 6660
+   uint16_t gyro_odr_hz;        // Same values as accel_odr_hz
+   uint8_t accel_range_g;       // 2, 4, 8 or 16
+   uint16_t gyro_range_dps;     // 125, 250, 500, 1000 or 2000
+   float accel_rate_hz;         // Accelerometer read rate
+   float gyro_rate_hz;          // Gyroscope read rate
+   float temperature_rate_hz;   // Temperature read rate
+} imu_config_t;
+
+/**
+ * @brief Defaults and validation for imu_config_t, using the limits of the
+ *        LSM6DSOX.
+ */
+class CImuConfig
+{
+public:
+   /**
+    * @brief Configuration applied at boot: the driver's 104Hz output data
+    *        rates and ±4g/±2000dps ranges, accel and gyro read at 50Hz and
+    *        temperature at 1Hz.
+    *
+    * @return imu_config_t Default configuration.
+    */
+   static imu_config_t Default();
+   /**
+    * @brief Validate a configuration in place. Output data rates are rounded
+    *        up to the next supported rate and read rates are capped at the
+    *        channel's output data rate and IMU_MAX_READ_RATE_HZ.
+    *
+    * @param config Configuration to normalize.
+    * @param error Receives a description of the first invalid field.
+    * @return true if the configuration is valid.
+    */
+   static bool Normalize(imu_config_t &config, const char *&error);
+   /**
+    * @brief Period of the sensor task tick needed by the fastest channel.
+    *
+    * @param config Normalized configuration.
+    * @return uint32_t Tick period in microseconds (1s when no channel is read).
+    */
+   static uint32_t GetTickPeriodUs(const imu_config_t &config);
+};
+
+#endif // !IMU_CONFIG_H
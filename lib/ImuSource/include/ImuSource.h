@@ -0,0 +1,65 @@
+/**
+ * @file ImuSource.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Interface of the sources IMU samples are read from.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef IMU_SOURCE_H
+#define IMU_SOURCE_H
+
+#include <stdint.h>
+#include "SensorData.h"
+#include "ImuConfig.h"
+
+/**
+ * @brief A producer of IMU samples, polled from the sensor task tick. The
+ *        pipeline behind it (queue, snapshot cache, server, streams) does not
+ *        depend on where samples come from, so a recorded trace can stand in
+ *        for the sensor.
+ */
+class CImuSource
+{
+public:
+   virtual ~CImuSource() {}
+   /**
+    * @brief Make one attempt to initialize the source. Never blocks waiting
+    *        for the source to appear; the caller retries.
+    *
+    * @return true if the source is ready.
+    */
+   virtual bool Begin() = 0;
+   /**
+    * @brief Read the samples that became due since the previous call.
+    *
+    * @param samples Receives the samples, oldest first. Data and timestamp
+    *                are filled in; the sequence number is left to the caller.
+    * @param maxSamples Capacity of the samples array.
+    * @return uint8_t Number of samples written.
+    */
+   virtual uint8_t Read(imu_sample_t *samples, uint8_t maxSamples) = 0;
+   /**
+    * @brief Apply a normalized configuration. Sources that cannot be
+    *        configured keep their behavior.
+    *
+    * @param config Configuration checked with CImuConfig::Normalize().
+    * @return true if the configuration was applied.
+    */
+   virtual bool Configure(const imu_config_t &config)
+   {
+      (void)config;
+      return false;
+   }
+   /**
+    * @brief Name reported in logs.
+    *
+    * @return const char* Source name.
+    */
+   virtual const char *GetName() const = 0;
+};
+
+#endif // !IMU_SOURCE_H
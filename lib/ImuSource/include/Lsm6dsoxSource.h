@@ -0,0 +1,82 @@
+/**
+ * @file Lsm6dsoxSource.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief IMU source backed by an LSM6DSOX on an I2C bus.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef LSM6DSOX_SOURCE_H
+#define LSM6DSOX_SOURCE_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_LSM6DSOX.h>
+#include "ImuSource.h"
+
+/**
+ * @brief I2C clock used once the sensor is found, in Hz.
+ */
+#define LSM6DSOX_I2C_CLOCK_HZ 400000
+
+/**
+ * @brief Reads the LSM6DSOX output registers directly, fetching on each call
+ *        only the channels (temperature, gyro, accel) whose read period is
+ *        due. Channels not due keep their last value in the sample.
+ */
+class CLsm6dsoxSource : public CImuSource
+{
+public:
+   /**
+    * @brief Construct a new CLsm6dsoxSource object
+    *
+    * @param wire I2C controller, with its pins set. Other drivers may share
+    *             it; TwoWire serializes their transactions.
+    */
+   CLsm6dsoxSource(TwoWire &wire);
+   bool Begin() override;
+   uint8_t Read(imu_sample_t *samples, uint8_t maxSamples) override;
+   bool Configure(const imu_config_t &config) override;
+   const char *GetName() const override;
+
+private:
+   /**
+    * @brief Output channels, in register order.
+    */
+   typedef enum {
+      CHANNEL_TEMPERATURE,
+      CHANNEL_GYRO,
+      CHANNEL_ACCEL,
+      CHANNEL_COUNT
+   } channel_t;
+
+   /**
+    * @brief Driver with access to raw register reads.
+    */
+   class CDevice : public Adafruit_LSM6DSOX
+   {
+   public:
+      /**
+       * @brief Read consecutive registers in one transaction.
+       *
+       * @param reg First register.
+       * @param buffer Receives the register values.
+       * @param length Number of registers.
+       * @return true on success.
+       */
+      bool ReadRegisters(uint8_t reg, uint8_t *buffer, uint8_t length);
+   };
+
+   TwoWire &m_Wire;
+   CDevice m_Sensor;
+   imu_config_t m_Config;
+   uint32_t m_PeriodUs[CHANNEL_COUNT];   // Read period per channel, 0 when off
+   int64_t m_DueUs[CHANNEL_COUNT];       // Next read deadline per channel
+   uint32_t m_SlackUs;                   // Early tolerance, half the tick period
+   imu_raw_t m_Raw;                      // Latest counts of every channel
+};
+
+#endif // !LSM6DSOX_SOURCE_H
@@ -0,0 +1,113 @@
+/**
+ * @file TraceReplaySource.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief IMU source replaying a recorded sample trace.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef TRACE_REPLAY_SOURCE_H
+#define TRACE_REPLAY_SOURCE_H
+
+#include <stdio.h>
+#include "ImuSource.h"
+
+/**
+ * @brief Replay as fast as the caller reads, ignoring the recorded timing.
+ */
+#define TRACE_REPLAY_AS_FAST_AS_POSSIBLE 0.0f
+
+/**
+ * @brief Longest line accepted in a trace file, in bytes.
+ */
+#define TRACE_REPLAY_MAX_LINE 160
+
+/**
+ * @brief Replays a CSV trace with one sample per line:
+ *
+ *        timestamp_ms,accX,accY,accZ,gyroX,gyroY,gyroZ,temperature
+ *
+ *        Blank lines and lines starting with '#' are skipped. Samples are
+ *        released when the replay clock, started by Begin() and scaled by the
+ *        speed factor, reaches their recorded offset from the first sample.
+ *        Output timestamps are the Begin() time plus that offset, in ms.
+ *
+ *        Uses stdio only, so it builds on a Linux host as well as on the
+ *        rover, where the path must be on a mounted VFS (e.g. /littlefs/...).
+ */
+class CTraceReplaySource : public CImuSource
+{
+public:
+   /**
+    * @brief Construct a new CTraceReplaySource object
+    *
+    * @param path Trace file path.
+    * @param speed Multiple of real time (1.0 for real time), or
+    *              TRACE_REPLAY_AS_FAST_AS_POSSIBLE.
+    * @param loop Restart from the first sample at the end of the trace.
+    */
+   CTraceReplaySource(const char *path, float speed = 1.0f, bool loop = false);
+   ~CTraceReplaySource();
+   bool Begin() override;
+   uint8_t Read(imu_sample_t *samples, uint8_t maxSamples) override;
+   const char *GetName() const override;
+   /**
+    * @brief Whether a non-looping replay has released its last sample.
+    *
+    * @return true at the end of the trace.
+    */
+   bool IsFinished() const;
+   /**
+    * @brief Number of malformed lines skipped so far.
+    *
+    * @return uint32_t Skipped line count.
+    */
+   uint32_t GetSkippedLines() const;
+
+private:
+   /**
+    * @brief Read the next well-formed sample from the file into m_Pending,
+    *        rewinding once at the end of a looping trace.
+    *
+    * @return true if a sample is pending.
+    */
+   bool LoadNext();
+   /**
+    * @brief Parse one trace line.
+    *
+    * @param line Line to parse.
+    * @param timestampMs Receives the recorded timestamp.
+    * @param data Receives the sample data.
+    * @return true if the line holds a sample.
+    */
+   static bool ParseLine(const char *line, uint32_t &timestampMs, imu_data_t &data);
+   /**
+    * @brief Monotonic clock of the replay, in microseconds.
+    *
+    * @return int64_t Current time.
+    */
+   static int64_t NowUs();
+
+   const char *m_Path;
+   float m_Speed;
+   bool m_Loop;
+   FILE *m_File;
+   int64_t m_StartUs;           // Replay clock at Begin()
+   uint32_t m_StartMs;          // Output timestamp of the first sample
+   uint32_t m_FirstRecordedMs;  // Recorded timestamp of the first sample
+   uint32_t m_LastRecordedMs;   // Recorded timestamp of the last sample read
+   uint32_t m_LastIntervalMs;   // Interval between the last two samples read
+   uint32_t m_PassOffsetMs;     // Trace time covered by completed passes
+   bool m_HaveFirst;
+   bool m_HavePending;
+   imu_data_t m_Pending;        // Next sample in recorded units
+   uint8_t m_AccelFs;           // Full-scale codes the samples are quantized at
+   uint8_t m_GyroFs;
+   uint32_t m_PendingOffsetMs;  // Trace time of the pending sample
+   uint32_t m_SkippedLines;
+};
+
+#endif // !TRACE_REPLAY_SOURCE_H
@@ -0,0 +1,141 @@
+/**
+ * @file ImuConfig.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the IMU configuration helpers.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "ImuConfig.h"
+
+/**
+ * @brief Output data rates supported by the LSM6DSOX, 12 standing for 12.5Hz.
+ */
+static const uint16_t SUPPORTED_ODR_HZ[] = {12, 26, 52, 104, 208, 416, 833, 1660, 3330, 6660};
+
+/**
+ * @brief Round an output data rate up to a supported one.
+ *
+ * @param odrHz Requested rate, normalized in place.
+ * @return true if a supported rate exists.
+ */
+static bool NormalizeOdr(uint16_t &odrHz)
+{
+   if (odrHz == 0)
+   {
+      return true;
+   }
+   for (uint16_t supported : SUPPORTED_ODR_HZ)
+   {
+      if (odrHz <= supported)
+      {
+         odrHz = supported;
+         return true;
+      }
+   }
+   return false;
+}
+
+/**
+ * @brief Cap a read rate at what the channel can deliver.
+ *
+ * @param rateHz Requested read rate, normalized in place.
+ * @param odrHz Normalized output data rate of the channel.
+ * @return true if the rate is valid.
+ */
+static bool NormalizeReadRate(float &rateHz, uint16_t odrHz)
+{
+   if (!(rateHz >= 0.0f))
+   {
+      return false;
+   }
+   // 12.5Hz is stored as 12; reading a little faster than 12 is still new data.
+   float limitHz = (odrHz == 12) ? 12.5f : (float)odrHz;
+   if (limitHz > IMU_MAX_READ_RATE_HZ)
+   {
+      limitHz = IMU_MAX_READ_RATE_HZ;
+   }
+   if (rateHz > limitHz)
+   {
+      rateHz = limitHz;
+   }
+   return true;
+}
+
+imu_config_t CImuConfig::Default()
+{
+   imu_config_t config;
+   config.accel_odr_hz = 104;
+   config.gyro_odr_hz = 104;
+   config.accel_range_g = 4;
+   config.gyro_range_dps = 2000;
+   config.accel_rate_hz = 50.0f;
+   config.gyro_rate_hz = 50.0f;
+   config.temperature_rate_hz = 1.0f;
+   return config;
+}
+
+bool CImuConfig::Normalize(imu_config_t &config, const char *&error)
+{
+   if (!NormalizeOdr(config.accel_odr_hz))
+   {
+      error = "Unsupported accel_odr_hz";
+      return false;
+   }
+   if (!NormalizeOdr(config.gyro_odr_hz))
+   {
+      error = "Unsupported gyro_odr_hz";
+      return false;
+   }
+   if (config.accel_range_g != 2 && config.accel_range_g != 4 &&
+       config.accel_range_g != 8 && config.accel_range_g != 16)
+   {
+      error = "Unsupported accel_range_g";
+      return false;
+   }
+   if (config.gyro_range_dps != 125 && config.gyro_range_dps != 250 && config.gyro_range_dps != 500 &&
+       config.gyro_range_dps != 1000 && config.gyro_range_dps != 2000)
+   {
+      error = "Unsupported gyro_range_dps";
+      return false;
+   }
+   if (!NormalizeReadRate(config.accel_rate_hz, config.accel_odr_hz))
+   {
+      error = "Invalid accel_rate_hz";
+      return false;
+   }
+   if (!NormalizeReadRate(config.gyro_rate_hz, config.gyro_odr_hz))
+   {
+      error = "Invalid gyro_rate_hz";
+      return false;
+   }
+   // The temperature sensor runs whenever either motion channel is on.
+   uint16_t temperatureOdrHz = (config.accel_odr_hz || config.gyro_odr_hz) ? 52 : 0;
+   if (!NormalizeReadRate(config.temperature_rate_hz, temperatureOdrHz))
+   {
+      error = "Invalid temperature_rate_hz";
+      return false;
+   }
+   return true;
+}
+
+uint32_t CImuConfig::GetTickPeriodUs(const imu_config_t &config)
+{
+   float fastestHz = config.accel_rate_hz;
+   if (config.gyro_rate_hz > fastestHz)
+   {
+      fastestHz = config.gyro_rate_hz;
+   }
+   if (config.temperature_rate_hz > fastestHz)
+   {
+      fastestHz = config.temperature_rate_hz;
+   }
+   if (fastestHz <= 0.0f)
+   {
+      return 1000000;
+   }
+   return (uint32_t)(1000000.0f / fastestHz);
+}
@@ -0,0 +1,197 @@
+/**
+ * @file TraceReplaySource.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the trace replay IMU source.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "TraceReplaySource.h"
+#include <stdlib.h>
+
+#ifdef ARDUINO
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+CTraceReplaySource::CTraceReplaySource(const char *path, float speed, bool loop)
+   : m_Path(path), m_Speed(speed), m_Loop(loop), m_File(NULL), m_StartUs(0), m_StartMs(0),
+     m_FirstRecordedMs(0), m_LastRecordedMs(0), m_LastIntervalMs(0), m_PassOffsetMs(0),
+     m_HaveFirst(false), m_HavePending(false), m_PendingOffsetMs(0), m_SkippedLines(0)
+{
+   // Recorded values are quantized at the boot ranges, as the sensor would be
+   imu_config_t config = CImuConfig::Default();
+   m_AccelFs = ImuAccelFsCode(config.accel_range_g);
+   m_GyroFs = ImuGyroFsCode(config.gyro_range_dps);
+}
+
+CTraceReplaySource::~CTraceReplaySource()
+{
+   if (m_File != NULL)
+   {
+      fclose(m_File);
+   }
+}
+
+bool CTraceReplaySource::Begin()
+{
+   if (m_File == NULL)
+   {
+      m_File = fopen(m_Path, "r");
+      if (m_File == NULL)
+      {
+         return false;
+      }
+   }
+
+   m_HaveFirst = false;
+   m_PassOffsetMs = 0;
+   if (!LoadNext())
+   {
+      // An empty trace never becomes ready.
+      return false;
+   }
+   m_StartUs = NowUs();
+   m_StartMs = (uint32_t)(m_StartUs / 1000);
+   return true;
+}
+
+uint8_t CTraceReplaySource::Read(imu_sample_t *samples, uint8_t maxSamples)
+{
+   bool asFastAsPossible = (m_Speed <= TRACE_REPLAY_AS_FAST_AS_POSSIBLE);
+   int64_t traceNowMs = 0;
+   if (!asFastAsPossible)
+   {
+      traceNowMs = (int64_t)((NowUs() - m_StartUs) * m_Speed) / 1000;
+   }
+
+   uint8_t count = 0;
+   while (count < maxSamples && m_HavePending)
+   {
+      if (!asFastAsPossible && (int64_t)m_PendingOffsetMs > traceNowMs)
+      {
+         break;
+      }
+      samples[count].timestamp = m_StartMs + m_PendingOffsetMs;
+      samples[count].raw = ImuDataToRaw(m_Pending, m_AccelFs, m_GyroFs);
+      count++;
+      LoadNext();
+   }
+   return count;
+}
+
+const char *CTraceReplaySource::GetName() const
+{
+   return "trace replay";
+}
+
+bool CTraceReplaySource::IsFinished() const
+{
+   return m_File != NULL && !m_HavePending;
+}
+
+uint32_t CTraceReplaySource::GetSkippedLines() const
+{
+   return m_SkippedLines;
+}
+
+bool CTraceReplaySource::LoadNext()
+{
+   char line[TRACE_REPLAY_MAX_LINE];
+   bool rewound = false;
+   m_HavePending = false;
+
+   while (!m_HavePending)
+   {
+      if (fgets(line, sizeof(line), m_File) == NULL)
+      {
+         // Rewind at most once per call so a trace without samples cannot spin.
+         if (!m_Loop || !m_HaveFirst || rewound)
+         {
+            return false;
+         }
+         rewind(m_File);
+         rewound = true;
+         // The next pass starts one sample interval after the last sample.
+         m_PassOffsetMs += m_LastRecordedMs - m_FirstRecordedMs + m_LastIntervalMs;
+         m_HaveFirst = false;
+         continue;
+      }
+
+      uint32_t recordedMs;
+      if (!ParseLine(line, recordedMs, m_Pending))
+      {
+         if (line[0] != '#' && line[0] != '\n' && line[0] != '\r' && line[0] != '\0')
+         {
+            m_SkippedLines++;
+         }
+         continue;
+      }
+
+      if (!m_HaveFirst)
+      {
+         m_FirstRecordedMs = recordedMs;
+         m_LastRecordedMs = recordedMs;
+         m_HaveFirst = true;
+      }
+      // Out of order samples are released immediately instead of going back in time.
+      if (recordedMs < m_LastRecordedMs)
+      {
+         recordedMs = m_LastRecordedMs;
+      }
+      m_LastIntervalMs = recordedMs - m_LastRecordedMs;
+      m_LastRecordedMs = recordedMs;
+      m_PendingOffsetMs = m_PassOffsetMs + (recordedMs - m_FirstRecordedMs);
+      m_HavePending = true;
+   }
+   return true;
+}
+
+bool CTraceReplaySource::ParseLine(const char *line, uint32_t &timestampMs, imu_data_t &data)
+{
+   if (line[0] == '#')
+   {
+      return false;
+   }
+
+   char *end;
+   timestampMs = (uint32_t)strtoul(line, &end, 10);
+   if (end == line)
+   {
+      return false;
+   }
+
+   float *fields[7] = {
+      &data.accX, &data.accY, &data.accZ,
+      &data.gyroX, &data.gyroY, &data.gyroZ,
+      &data.temperature,
+   };
+   for (int field = 0; field < 7; field++)
+   {
+      if (*end != ',')
+      {
+         return false;
+      }
+      const char *start = end + 1;
+      *fields[field] = strtof(start, &end);
+      if (end == start)
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+int64_t CTraceReplaySource::NowUs()
+{
+#ifdef ARDUINO
+   return esp_timer_get_time();
+#else
+   return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
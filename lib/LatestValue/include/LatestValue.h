@@ -0,0 +1,188 @@
+/**
+ * @file LatestValue.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief A seqlock holding the latest snapshot of trivially copyable state,
+ *        readable from any task on either core without a mutex or queue.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef LATEST_VALUE_H
+#define LATEST_VALUE_H
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <thread>
+#endif
+
+/**
+ * @brief Number of torn reads tolerated before a reader backs off, letting a
+ *        preempted writer on the same core finish its update.
+ */
+#define LATEST_VALUE_SPIN_LIMIT 8
+
+/**
+ * @brief Number of yielding back-offs before a reader sleeps for a tick,
+ *        which is only needed when a lower priority writer was preempted
+ *        on the reader's core.
+ */
+#define LATEST_VALUE_YIELD_LIMIT 4
+
+/**
+ * @brief Latest-value register protected by a sequence lock.
+ *
+ * The writer bumps the sequence to an odd value, copies the new value and
+ * bumps it to the next even value, so Store() never waits. Readers copy the
+ * value and retry when the sequence was odd or changed during the copy, so
+ * Load() always returns a value that was written as a whole.
+ *
+ * The payload is kept as 32-bit atomic words so concurrent copies are well
+ * defined; on ESP32 these compile to plain loads and stores.
+ *
+ * Only one task may call Store() at a time; any number may call Load().
+ * A reader that outranks the writer on the same core can only see the update
+ * finish once it blocks, so such readers pay one tick after
+ * LATEST_VALUE_YIELD_LIMIT yields; keep readers at or below the writer's
+ * priority, or on the other core, to stay on the yield path.
+ *
+ * @tparam T Trivially copyable state type.
+ */
+template <typename T>
+class CLatestValue
+{
+   static_assert(std::is_trivially_copyable<T>::value, "CLatestValue requires a trivially copyable type");
+
+public:
+   /**
+    * @brief Construct a new CLatestValue object holding a zeroed value.
+    */
+   CLatestValue() : m_Sequence(0)
+   {
+      for (size_t i = 0; i < WORD_COUNT; i++)
+      {
+         m_Words[i].store(0, std::memory_order_relaxed);
+      }
+   }
+
+   /**
+    * @brief Publish a new value. Wait-free for a single writer.
+    *
+    * @param value Value to publish.
+    */
+   void Store(const T &value)
+   {
+      uint32_t words[WORD_COUNT] = {};
+      memcpy(words, &value, sizeof(T));
+
+      uint32_t sequence = m_Sequence.load(std::memory_order_relaxed);
+      m_Sequence.store(sequence + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      for (size_t i = 0; i < WORD_COUNT; i++)
+      {
+         m_Words[i].store(words[i], std::memory_order_relaxed);
+      }
+      m_Sequence.store(sequence + 2, std::memory_order_release);
+   }
+
+   /**
+    * @brief Read a consistent copy of the latest value.
+    *
+    * @return T Latest value (zeroed before the first Store()).
+    */
+   T Load() const
+   {
+      uint32_t version;
+      return Load(version);
+   }
+
+   /**
+    * @brief Read a consistent copy of the latest value and its version.
+    *
+    * @param version Receives the number of Store() calls the value reflects.
+    * @return T Latest value.
+    */
+   T Load(uint32_t &version) const
+   {
+      uint32_t words[WORD_COUNT];
+      uint32_t attempts = 0;
+      uint32_t backoffs = 0;
+      for (;;)
+      {
+         uint32_t before = m_Sequence.load(std::memory_order_acquire);
+         if ((before & 1) == 0)
+         {
+            for (size_t i = 0; i < WORD_COUNT; i++)
+            {
+               words[i] = m_Words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_Sequence.load(std::memory_order_relaxed) == before)
+            {
+               version = before / 2;
+               break;
+            }
+         }
+         if (++attempts >= LATEST_VALUE_SPIN_LIMIT)
+         {
+            Backoff(backoffs++);
+            attempts = 0;
+         }
+      }
+
+      T value;
+      memcpy(&value, words, sizeof(T));
+      return value;
+   }
+
+   /**
+    * @brief Number of values stored so far, without reading the value.
+    *
+    * @return uint32_t Version of the latest complete value.
+    */
+   uint32_t Version() const
+   {
+      return m_Sequence.load(std::memory_order_acquire) / 2;
+   }
+
+private:
+   static const size_t WORD_COUNT = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+   /**
+    * @brief Give a preempted writer the chance to complete its update.
+    *
+    * @param backoffs Back-offs already taken by this read.
+    */
+   static void Backoff(uint32_t backoffs)
+   {
+#ifdef ARDUINO
+      // Yielding costs a context switch, not a 1 ms tick, and is enough for
+      // a writer on the other core or at the same priority. Only a lower
+      // priority writer on this core needs the reader to block.
+      if (backoffs < LATEST_VALUE_YIELD_LIMIT)
+      {
+         taskYIELD();
+      }
+      else
+      {
+         vTaskDelay(1);
+      }
+#else
+      (void)backoffs;
+      std::this_thread::yield();
+#endif
+   }
+
+   std::atomic<uint32_t> m_Sequence;
+   std::atomic<uint32_t> m_Words[WORD_COUNT];
+};
+
+#endif // !LATEST_VALUE_H
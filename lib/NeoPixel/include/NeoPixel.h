@@ -16,6 +16,39 @@
 
 #define MAX_PIXEL_COUNT 1
 
+/**
+ * @brief Stack size (bytes) and priority of the status engine task.
+ * 
+ */
+#define PIXEL_ENGINE_STACK_SIZE 2048
+#define PIXEL_ENGINE_PRIORITY (tskIDLE_PRIORITY + 1)
+
+/**
+ * @brief Frame period used while rendering the breathe pattern.
+ * 
+ */
+#define PIXEL_BREATHE_FRAME_MS 20
+
+/**
+ * @brief Patterns rendered by the status engine.
+ * 
+ */
+typedef enum {
+   PIXEL_PATTERN_SOLID,    // Constant color
+   PIXEL_PATTERN_BLINK,    // Color on for half the period, off for the other half
+   PIXEL_PATTERN_BREATHE   // Brightness ramps up and down over the period
+} pixel_pattern_t;
+
+/**
+ * @brief A status request posted to the engine mailbox.
+ * 
+ */
+typedef struct {
+   uint32_t color;
+   pixel_pattern_t pattern;
+   uint16_t period_ms;
+} pixel_status_t;
+
 /**
  * @brief A wrapper around Adafruit NeoPixel to
  * simply NeoPixel use on single pixel block Neo Pixel
@@ -46,8 +79,58 @@ public:
     * @return uint32_t - Updated Pixel color after setting the pixel.
     */
    uint32_t UpdatePixelColor(uint32_t color, bool clearOld=false);
+   /**
+    * @brief Start the low priority task rendering status requests. Once it runs,
+    *        the pixel should only be driven through RequestStatus().
+    * 
+    * @param core - CPU core to pin the engine task to.
+    * @return true if the engine is running.
+    */
+   bool StartStatusEngine(BaseType_t core = 0);
+   /**
+    * @brief Post a status request to the engine without blocking. A newer request
+    *        replaces one that has not been picked up yet.
+    * 
+    * @param color - 32-bit RGB for the color to show.
+    * @param pattern - Pattern to render the color with.
+    * @param periodMs - Pattern period in milliseconds (ignored for solid colors).
+    * @return true if the request was posted.
+    */
+   bool RequestStatus(uint32_t color, pixel_pattern_t pattern = PIXEL_PATTERN_SOLID, uint16_t periodMs = 1000);
 private:
+   /**
+    * @brief Latch a color to the pixel, skipping show() when nothing changed.
+    * 
+    * @param color - 32-bit RGB for the color to show.
+    */
+   void ShowIfChanged(uint32_t color);
+   /**
+    * @brief Compute the color of a pattern at a point in its period.
+    * 
+    * @param status - Status being rendered.
+    * @param elapsedMs - Time since the status was applied.
+    * @param nextFrameMs - Receives the delay until the frame changes.
+    * @return uint32_t Color to show.
+    */
+   static uint32_t RenderFrame(const pixel_status_t &status, uint32_t elapsedMs, TickType_t &nextFrameMs);
+   /**
+    * @brief Status engine task body.
+    * 
+    * @param pvParameters - Pointer to the owning CNeoPixel.
+    */
+   static void StatusEngineTask(void *pvParameters);
+
    uint8_t m_PixelPowerPin;
+   // Color last latched with show(); guards against redundant frames.
+   uint32_t m_ShownColor;
+   bool m_Dirty;
+   // Single-slot mailbox between requesters and the engine task.
+   QueueHandle_t m_Mailbox;
+   StaticQueue_t m_MailboxBuffer;
+   uint8_t m_MailboxStorage[sizeof(pixel_status_t)];
+   TaskHandle_t m_EngineTask;
+   StaticTask_t m_EngineTaskBuffer;
+   StackType_t m_EngineStack[PIXEL_ENGINE_STACK_SIZE];
 };
 
 #endif // !NEO_PIXEL_H
\ No newline at end of file
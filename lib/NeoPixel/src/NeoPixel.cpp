@@ -13,7 +13,8 @@
 #include <Arduino.h>
 
 
-CNeoPixel::CNeoPixel(uint8_t pixel_pin, uint8_t pixel_power_pin) : Adafruit_NeoPixel(MAX_PIXEL_COUNT, pixel_pin, NEO_GRB + NEO_KHZ800), m_PixelPowerPin(pixel_power_pin) {
+CNeoPixel::CNeoPixel(uint8_t pixel_pin, uint8_t pixel_power_pin) : Adafruit_NeoPixel(MAX_PIXEL_COUNT, pixel_pin, NEO_GRB + NEO_KHZ800), m_PixelPowerPin(pixel_power_pin),
+   m_ShownColor(0), m_Dirty(true), m_Mailbox(NULL), m_EngineTask(NULL) {
    pinMode(m_PixelPowerPin, OUTPUT);
    digitalWrite(m_PixelPowerPin, HIGH);
    begin();
@@ -21,8 +22,7 @@ CNeoPixel::CNeoPixel(uint8_t pixel_pin, uint8_t pixel_power_pin) : Adafruit_NeoP
 
 void CNeoPixel::SetPixelColor(uint32_t color) {
    if (canShow() == true) {
-      setPixelColor(MAX_PIXEL_COUNT-1, color);
-      show();
+      ShowIfChanged(color);
    }
 }
 
@@ -43,9 +43,88 @@ uint32_t CNeoPixel::UpdatePixelColor(uint32_t color, bool clearOld) {
 
    uint32_t newColor = Color(newRed, newGreen, newBlue);
    if (canShow() == true) {
-      setPixelColor(MAX_PIXEL_COUNT-1, newColor);
-      show();
+      ShowIfChanged(newColor);
       return newColor;
    }
    return 0;
 }
+
+bool CNeoPixel::StartStatusEngine(BaseType_t core) {
+   if (m_EngineTask != NULL) {
+      return true;
+   }
+   m_Mailbox = xQueueCreateStatic(1, sizeof(pixel_status_t), m_MailboxStorage, &m_MailboxBuffer);
+   if (m_Mailbox == NULL) {
+      log_e("Failed to create NeoPixel mailbox.");
+      return false;
+   }
+   m_EngineTask = xTaskCreateStaticPinnedToCore(StatusEngineTask, "PixelEngine", PIXEL_ENGINE_STACK_SIZE, this,
+                                                PIXEL_ENGINE_PRIORITY, m_EngineStack, &m_EngineTaskBuffer, core);
+   return m_EngineTask != NULL;
+}
+
+bool CNeoPixel::RequestStatus(uint32_t color, pixel_pattern_t pattern, uint16_t periodMs) {
+   if (m_Mailbox == NULL) {
+      return false;
+   }
+   pixel_status_t status = {color, pattern, periodMs};
+   return xQueueOverwrite(m_Mailbox, &status) == pdTRUE;
+}
+
+void CNeoPixel::ShowIfChanged(uint32_t color) {
+   // show() is the expensive part, only latch frames that differ.
+   if (!m_Dirty && (color == m_ShownColor)) {
+      return;
+   }
+   setPixelColor(MAX_PIXEL_COUNT-1, color);
+   show();
+   m_ShownColor = color;
+   m_Dirty = false;
+}
+
+uint32_t CNeoPixel::RenderFrame(const pixel_status_t &status, uint32_t elapsedMs, TickType_t &nextFrameMs) {
+   if ((status.pattern == PIXEL_PATTERN_SOLID) || (status.period_ms < 2)) {
+      nextFrameMs = portMAX_DELAY;
+      return status.color;
+   }
+
+   uint32_t phase = elapsedMs % status.period_ms;
+   if (status.pattern == PIXEL_PATTERN_BLINK) {
+      uint32_t onTime = status.period_ms / 2;
+      bool on = phase < onTime;
+      nextFrameMs = on ? (onTime - phase) : (status.period_ms - phase);
+      return on ? status.color : 0;
+   }
+
+   // Breathe: triangle wave from 0 to full brightness and back over one period.
+   uint32_t level = (phase * 510UL) / status.period_ms;
+   if (level > 255) {
+      level = 510 - level;
+   }
+   nextFrameMs = PIXEL_BREATHE_FRAME_MS;
+   uint8_t red = (((status.color >> 16) & 0xFF) * level) / 255;
+   uint8_t green = (((status.color >> 8) & 0xFF) * level) / 255;
+   uint8_t blue = ((status.color & 0xFF) * level) / 255;
+   return Color(red, green, blue);
+}
+
+void CNeoPixel::StatusEngineTask(void *pvParameters) {
+   CNeoPixel *pixel = static_cast<CNeoPixel *>(pvParameters);
+   pixel_status_t status = {pixel->m_ShownColor, PIXEL_PATTERN_SOLID, 0};
+   uint32_t appliedAtMs = millis();
+   TickType_t nextFrameMs = portMAX_DELAY;
+
+   for (;;) {
+      pixel_status_t request;
+      TickType_t wait = (nextFrameMs == portMAX_DELAY) ? portMAX_DELAY : pdMS_TO_TICKS(nextFrameMs);
+      if (xQueueReceive(pixel->m_Mailbox, &request, wait) == pdTRUE) {
+         // Re-posting the running status keeps its phase.
+         if ((request.color != status.color) || (request.pattern != status.pattern) ||
+             (request.period_ms != status.period_ms)) {
+            status = request;
+            appliedAtMs = millis();
+         }
+      }
+      pixel->ShowIfChanged(RenderFrame(status, millis() - appliedAtMs, nextFrameMs));
+   }
+}
@@ -0,0 +1,193 @@
+/**
+ * @file TimingSimulator.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Deterministic host simulation of the sensor and server task timing.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef TIMING_SIMULATOR_H
+#define TIMING_SIMULATOR_H
+
+#include <stdint.h>
+#include "VirtualClock.h"
+#include "TimerDeadline.h"
+#include "StreamSubscription.h"
+
+/**
+ * @brief Longest sample queue the simulator models.
+ */
+#define TIMING_SIM_MAX_QUEUE 64
+
+/**
+ * @brief Workload and platform timing of one run. Costs are how long a task
+ *        is busy; latencies how late a timer notification is delivered.
+ */
+typedef struct {
+   int64_t duration_us;            // Simulated time to run
+   uint32_t sensor_period_us;      // Sensor tick period (CImuConfig::GetTickPeriodUs())
+   uint32_t sensor_read_us;        // I2C read per tick
+   uint32_t sensor_read_jitter_us; // Extra read time, uniform from 0
+   uint32_t timer_latency_us;      // Deadline to notification, uniform from 0
+   uint8_t queue_length;           // Sample queue between the tasks (IMU_QUEUE_LENGTH)
+   uint32_t sample_cost_us;        // Server time per sample drained
+   uint32_t poll_period_us;        // Socket poll period (SOCKET_POLL_PERIOD_US)
+   uint32_t poll_cost_us;          // Server time per socket poll
+   uint32_t wake_cost_us;          // Task time per wake-up (notification wait and context switch)
+   uint32_t rearm_cost_us;         // Server time to re-arm or stop the stream timer
+   uint32_t stall_us;              // Extra time of a slow request, 0 for none
+   uint32_t stall_every;           // Polls between slow requests
+   uint32_t stream_rate_hz;        // Requested stream rate, 0 for no subscriber
+   bool adaptive;                  // Subscriber accepts backoff
+   uint32_t frame_cost_us;         // Server time per frame written
+   uint32_t frame_bytes;           // Frame size on the socket
+   uint32_t link_bytes_per_s;      // Rate the send buffer drains at
+   uint32_t send_buffer_bytes;     // Socket send buffer (lwIP TCP_SND_BUF)
+   uint32_t low_water_bytes;       // Free space needed to report the socket writable
+   uint32_t seed;                  // Seed of the jitter generator
+} timing_sim_config_t;
+
+/**
+ * @brief Outcome of one run.
+ */
+typedef struct {
+   int64_t simulated_us;           // Simulated time covered
+   uint32_t samples_read;          // Samples the sensor task produced
+   uint32_t samples_dropped;       // Samples lost to a full queue
+   uint32_t ticks_coalesced;       // Sensor ticks merged into one because the task was busy
+   uint8_t max_queue_depth;        // Deepest the queue got
+   uint32_t max_sample_latency_us; // Worst time from read to server processing
+   uint64_t total_sample_latency_us;
+   scheduler_timer_stats_t sensor_timer;   // Sensor tick lateness and jitter
+   uint32_t frames_sent;           // Stream frames written
+   uint32_t frames_skipped;        // Stream frames skipped for a full send buffer
+   float stream_rate_hz;           // Achieved stream rate
+   uint32_t max_frame_jitter_us;   // Worst deviation of a frame interval from the requested period
+   uint64_t total_frame_jitter_us;
+   uint32_t server_wakeups;        // Times the server task ran
+   uint32_t stream_rearms;         // Times the server task re-armed the stream timer
+   float sensor_busy_percent;      // Share of time the sensor task was busy
+   float server_busy_percent;      // Share of time the server task was busy
+} timing_sim_report_t;
+
+/**
+ * @brief Runs the sensor and server task loops as a discrete-event
+ *        simulation on a CVirtualClock. The timers use the scheduler's own
+ *        CTimerDeadline and each stream tick runs the server's
+ *        CStreamSubscription, so the deadlines, frame decisions and backoff
+ *        simulated are the ones that ship; the tasks, the non-blocking queue
+ *        hand-off and the socket send buffer are modeled. Runs are
+ *        deterministic for a given seed.
+ */
+class CTimingSimulator
+{
+public:
+   /**
+    * @brief Construct a simulator.
+    */
+   CTimingSimulator();
+   /**
+    * @brief The firmware defaults: 50Hz sensor ticks, 5ms socket polls, a
+    *        10-sample queue and a 10Hz stream over a 100kB/s link.
+    *
+    * @return timing_sim_config_t Default workload.
+    */
+   static timing_sim_config_t Default();
+   /**
+    * @brief Simulate a workload from time 0.
+    *
+    * @param config Workload to run.
+    * @return timing_sim_report_t Outcome.
+    */
+   timing_sim_report_t Run(const timing_sim_config_t &config);
+
+private:
+   /**
+    * @brief Notification bits of the modeled tasks.
+    */
+   enum {
+      EVENT_SAMPLE = 1 << 0,
+      EVENT_POLL = 1 << 1,
+      EVENT_STREAM = 1 << 2,
+   };
+
+   /**
+    * @brief Uniform jitter from 0 to maxUs (xorshift32).
+    */
+   uint32_t Jitter(uint32_t maxUs);
+   /**
+    * @brief Bytes waiting in the send buffer at a time of the server task.
+    */
+   uint32_t GetBufferedBytes(int64_t nowUs);
+   /**
+    * @brief Set notification bits on the server task.
+    */
+   void NotifyServer(uint32_t events);
+   /**
+    * @brief Run the server task for the pending notifications.
+    */
+   void RunServer();
+   /**
+    * @brief Service the stream subscriber, as HandleStreamTick().
+    *
+    * @param nowUs Time the server task reaches the tick.
+    * @return int64_t Time the tick's work ends.
+    */
+   int64_t StreamTick(int64_t nowUs);
+
+   /**
+    * @brief The subscriber's socket: a send buffer draining at link speed
+    *        that reports writable above its low-water mark.
+    */
+   class CSocketModel : public CStreamSink
+   {
+   public:
+      explicit CSocketModel(CTimingSimulator &simulator);
+      const float *GetValues() override;
+      bool IsWritable() override;
+      void SendFrame() override;
+
+   private:
+      CTimingSimulator &m_Simulator;
+   };
+
+   timing_sim_config_t m_Config;
+   timing_sim_report_t m_Report;
+   CVirtualClock m_Clock;
+   uint32_t m_Random;
+
+   CTimerDeadline m_SensorTimer;
+   CTimerDeadline m_PollTimer;
+   CTimerDeadline m_StreamTimer;
+   int64_t m_SensorNotifyUs;       // Delivery time of the sensor timer's next notification
+   int64_t m_PollNotifyUs;
+   int64_t m_StreamNotifyUs;
+
+   bool m_SensorReading;           // The sensor task is in a read
+   bool m_SensorTickPending;       // A tick arrived during the read
+   int64_t m_SensorDoneUs;         // End of the current read
+
+   int64_t m_Queue[TIMING_SIM_MAX_QUEUE];   // Read time of each queued sample
+   uint8_t m_QueueHead;
+   uint8_t m_QueueCount;
+
+   uint32_t m_ServerEvents;        // Notification bits not yet consumed
+   int64_t m_ServerNotifiedUs;     // Time the first of them was set
+   int64_t m_ServerFreeUs;         // End of the server's current work
+   uint32_t m_Polls;
+
+   CStreamSubscription m_Stream;
+   CSocketModel m_Socket;
+   int64_t m_TickDoneUs;           // End of the current stream tick's work
+   int64_t m_LastFrameUs;
+   uint32_t m_BufferedBytes;       // Send buffer level at m_BufferUpdatedUs
+   int64_t m_BufferUpdatedUs;
+
+   int64_t m_SensorBusyUs;
+   int64_t m_ServerBusyUs;
+};
+
+#endif // !TIMING_SIMULATOR_H
@@ -0,0 +1,59 @@
+/**
+ * @file VirtualClock.h
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief A clock that only moves when the simulation advances it.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#ifndef VIRTUAL_CLOCK_H
+#define VIRTUAL_CLOCK_H
+
+#include <stdint.h>
+
+/**
+ * @brief Stands in for esp_timer_get_time() and millis() in a simulation.
+ *        Waits (delay(), queue and notification timeouts) are modeled by
+ *        advancing the clock to the time they end, so simulated seconds
+ *        cost only the work done in them.
+ */
+class CVirtualClock
+{
+public:
+   /**
+    * @brief Construct a clock at time 0.
+    */
+   CVirtualClock();
+   /**
+    * @brief Current time, as esp_timer_get_time().
+    *
+    * @return int64_t Microseconds since the simulated boot.
+    */
+   int64_t NowUs() const;
+   /**
+    * @brief Current time, as millis().
+    *
+    * @return uint32_t Milliseconds since the simulated boot.
+    */
+   uint32_t NowMs() const;
+   /**
+    * @brief Move to an absolute time; the clock never goes back.
+    *
+    * @param timeUs Target time in microseconds.
+    */
+   void AdvanceTo(int64_t timeUs);
+   /**
+    * @brief Move forward, as delay() or a timeout that expires.
+    *
+    * @param durationUs Duration in microseconds.
+    */
+   void Advance(int64_t durationUs);
+
+private:
+   int64_t m_NowUs;
+};
+
+#endif // !VIRTUAL_CLOCK_H
@@ -0,0 +1,334 @@
+/**
+ * @file TimingSimulator.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the task timing simulator.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "TimingSimulator.h"
+#include <string.h>
+
+CTimingSimulator::CTimingSimulator() : m_Random(1), m_Socket(*this)
+{
+   m_Config = Default();
+   memset(&m_Report, 0, sizeof(timing_sim_report_t));
+}
+
+timing_sim_config_t CTimingSimulator::Default()
+{
+   timing_sim_config_t config;
+   config.duration_us = 60000000;
+   config.sensor_period_us = 20000;
+   config.sensor_read_us = 450;
+   config.sensor_read_jitter_us = 150;
+   config.timer_latency_us = 60;
+   config.queue_length = 10;
+   config.sample_cost_us = 40;
+   config.poll_period_us = 5000;
+   config.poll_cost_us = 60;
+   config.wake_cost_us = 10;
+   config.rearm_cost_us = 15;
+   config.stall_us = 0;
+   config.stall_every = 0;
+   config.stream_rate_hz = 10;
+   config.adaptive = true;
+   config.frame_cost_us = 120;
+   config.frame_bytes = 180;
+   config.link_bytes_per_s = 100000;
+   config.send_buffer_bytes = 5744;
+   config.low_water_bytes = 2873;
+   config.seed = 1;
+   return config;
+}
+
+timing_sim_report_t CTimingSimulator::Run(const timing_sim_config_t &config)
+{
+   m_Config = config;
+   if (m_Config.queue_length == 0 || m_Config.queue_length > TIMING_SIM_MAX_QUEUE)
+   {
+      m_Config.queue_length = TIMING_SIM_MAX_QUEUE;
+   }
+   memset(&m_Report, 0, sizeof(timing_sim_report_t));
+   if (config.sensor_period_us == 0 || config.poll_period_us == 0)
+   {
+      return m_Report;
+   }
+   m_Clock = CVirtualClock();
+   m_Random = config.seed ? config.seed : 1;
+
+   m_SensorTimer = CTimerDeadline();
+   m_PollTimer = CTimerDeadline();
+   m_StreamTimer = CTimerDeadline();
+   m_SensorTimer.StartPeriodic(config.sensor_period_us, 0);
+   m_PollTimer.StartPeriodic(config.poll_period_us, 0);
+   m_SensorNotifyUs = m_SensorTimer.GetDueUs() + Jitter(config.timer_latency_us);
+   m_PollNotifyUs = m_PollTimer.GetDueUs() + Jitter(config.timer_latency_us);
+   m_StreamNotifyUs = 0;
+
+   m_SensorReading = false;
+   m_SensorTickPending = false;
+   m_SensorDoneUs = 0;
+   m_QueueHead = 0;
+   m_QueueCount = 0;
+   m_ServerEvents = 0;
+   m_ServerNotifiedUs = 0;
+   m_ServerFreeUs = 0;
+   m_Polls = 0;
+   m_LastFrameUs = -1;
+   m_BufferedBytes = 0;
+   m_BufferUpdatedUs = 0;
+   m_SensorBusyUs = 0;
+   m_ServerBusyUs = 0;
+
+   m_Stream = CStreamSubscription();
+   m_TickDoneUs = 0;
+   if (config.stream_rate_hz > 0)
+   {
+      // The subscription arrives with the first request; its timer is armed
+      // after that run of the server, as the server task does.
+      m_Stream.Start(1000000UL / config.stream_rate_hz, config.adaptive, 0, 0);
+      m_StreamTimer.ArmAt(m_Stream.GetPacer().GetDueUs());
+      m_StreamNotifyUs = m_StreamTimer.GetDueUs() + Jitter(config.timer_latency_us);
+   }
+
+   while (true)
+   {
+      // Next event: a timer notification, the end of a read, or the server
+      // becoming free with notifications waiting.
+      int64_t nextUs = m_SensorNotifyUs;
+      if (m_PollNotifyUs < nextUs) nextUs = m_PollNotifyUs;
+      if (m_StreamTimer.IsArmed() && m_StreamNotifyUs < nextUs) nextUs = m_StreamNotifyUs;
+      if (m_SensorReading && m_SensorDoneUs < nextUs) nextUs = m_SensorDoneUs;
+      int64_t serverWakeUs = (m_ServerFreeUs > m_ServerNotifiedUs) ? m_ServerFreeUs : m_ServerNotifiedUs;
+      if (m_ServerEvents != 0 && serverWakeUs < nextUs) nextUs = serverWakeUs;
+      if (nextUs > config.duration_us)
+      {
+         break;
+      }
+      m_Clock.AdvanceTo(nextUs);
+      int64_t nowUs = m_Clock.NowUs();
+
+      if (m_SensorReading && m_SensorDoneUs == nowUs)
+      {
+         // xQueueSend(..., 0): a full queue loses the sample rather than
+         // blocking the sensor task.
+         m_SensorReading = false;
+         m_Report.samples_read++;
+         if (m_QueueCount < m_Config.queue_length)
+         {
+            m_Queue[(m_QueueHead + m_QueueCount) % m_Config.queue_length] = nowUs;
+            m_QueueCount++;
+            if (m_QueueCount > m_Report.max_queue_depth)
+            {
+               m_Report.max_queue_depth = m_QueueCount;
+            }
+         }
+         else
+         {
+            m_Report.samples_dropped++;
+         }
+         NotifyServer(EVENT_SAMPLE);
+         if (m_SensorTickPending)
+         {
+            m_SensorTickPending = false;
+            uint32_t readUs = config.sensor_read_us + Jitter(config.sensor_read_jitter_us);
+            m_SensorReading = true;
+            m_SensorDoneUs = nowUs + readUs;
+            m_SensorBusyUs += readUs;
+         }
+      }
+      else if (m_SensorNotifyUs == nowUs)
+      {
+         m_SensorTimer.Fire(nowUs);
+         m_SensorNotifyUs = m_SensorTimer.GetDueUs() + Jitter(config.timer_latency_us);
+         if (m_SensorReading)
+         {
+            // Task notification bits coalesce: ticks during a read become one.
+            if (m_SensorTickPending)
+            {
+               m_Report.ticks_coalesced++;
+            }
+            m_SensorTickPending = true;
+         }
+         else
+         {
+            uint32_t readUs = config.wake_cost_us + config.sensor_read_us + Jitter(config.sensor_read_jitter_us);
+            m_SensorReading = true;
+            m_SensorDoneUs = nowUs + readUs;
+            m_SensorBusyUs += readUs;
+         }
+      }
+      else if (m_PollNotifyUs == nowUs)
+      {
+         m_PollTimer.Fire(nowUs);
+         m_PollNotifyUs = m_PollTimer.GetDueUs() + Jitter(config.timer_latency_us);
+         NotifyServer(EVENT_POLL);
+      }
+      else if (m_StreamTimer.IsArmed() && m_StreamNotifyUs == nowUs)
+      {
+         m_StreamTimer.Fire(nowUs);
+         NotifyServer(EVENT_STREAM);
+      }
+      else
+      {
+         RunServer();
+      }
+   }
+
+   m_Report.simulated_us = config.duration_us;
+   m_SensorTimer.TakeStats(m_Report.sensor_timer);
+   if (config.duration_us > 0)
+   {
+      float seconds = (float)config.duration_us / 1000000.0f;
+      m_Report.stream_rate_hz = (float)m_Report.frames_sent / seconds;
+      m_Report.sensor_busy_percent = 100.0f * (float)m_SensorBusyUs / (float)config.duration_us;
+      m_Report.server_busy_percent = 100.0f * (float)m_ServerBusyUs / (float)config.duration_us;
+   }
+   return m_Report;
+}
+
+uint32_t CTimingSimulator::Jitter(uint32_t maxUs)
+{
+   if (maxUs == 0)
+   {
+      return 0;
+   }
+   m_Random ^= m_Random << 13;
+   m_Random ^= m_Random >> 17;
+   m_Random ^= m_Random << 5;
+   return m_Random % (maxUs + 1);
+}
+
+uint32_t CTimingSimulator::GetBufferedBytes(int64_t nowUs)
+{
+   uint64_t drained = (uint64_t)(nowUs - m_BufferUpdatedUs) * m_Config.link_bytes_per_s / 1000000ULL;
+   if (drained > 0)
+   {
+      m_BufferedBytes = (drained >= m_BufferedBytes) ? 0 : m_BufferedBytes - (uint32_t)drained;
+      m_BufferUpdatedUs = nowUs;
+   }
+   return m_BufferedBytes;
+}
+
+void CTimingSimulator::NotifyServer(uint32_t events)
+{
+   if (m_ServerEvents == 0)
+   {
+      m_ServerNotifiedUs = m_Clock.NowUs();
+   }
+   m_ServerEvents |= events;
+}
+
+void CTimingSimulator::RunServer()
+{
+   uint32_t events = m_ServerEvents;
+   m_ServerEvents = 0;
+   int64_t startUs = m_Clock.NowUs();
+   // The run is costed up front; the sensor task runs alongside it, so its
+   // events inside the run still happen at their own times.
+   int64_t taskUs = startUs + m_Config.wake_cost_us;
+   m_Report.server_wakeups++;
+
+   if (events & EVENT_SAMPLE)
+   {
+      while (m_QueueCount > 0)
+      {
+         uint32_t latencyUs = (uint32_t)(taskUs - m_Queue[m_QueueHead]);
+         m_Report.total_sample_latency_us += latencyUs;
+         if (latencyUs > m_Report.max_sample_latency_us)
+         {
+            m_Report.max_sample_latency_us = latencyUs;
+         }
+         m_QueueHead = (m_QueueHead + 1) % m_Config.queue_length;
+         m_QueueCount--;
+         taskUs += m_Config.sample_cost_us;
+      }
+   }
+   if (events & EVENT_POLL)
+   {
+      taskUs += m_Config.poll_cost_us;
+      m_Polls++;
+      if (m_Config.stall_every != 0 && m_Polls % m_Config.stall_every == 0)
+      {
+         taskUs += m_Config.stall_us;
+      }
+   }
+   if (events & EVENT_STREAM)
+   {
+      taskUs = StreamTick(taskUs);
+   }
+   // Re-armed only when the fired one-shot or a moved deadline needs it, as
+   // the server task does.
+   int64_t dueUs = m_Stream.GetPacer().GetDueUs();
+   if (m_Config.stream_rate_hz > 0 && (!m_StreamTimer.IsArmed() || m_StreamTimer.GetDueUs() != dueUs))
+   {
+      taskUs += m_Config.rearm_cost_us;
+      m_Report.stream_rearms++;
+      m_StreamTimer.ArmAt(dueUs);
+      int64_t notifyUs = m_StreamTimer.GetDueUs() + Jitter(m_Config.timer_latency_us);
+      m_StreamNotifyUs = (notifyUs > startUs) ? notifyUs : startUs;
+   }
+
+   m_ServerFreeUs = taskUs;
+   m_ServerBusyUs += taskUs - startUs;
+}
+
+int64_t CTimingSimulator::StreamTick(int64_t nowUs)
+{
+   m_TickDoneUs = nowUs;
+   uint32_t periodUs = m_Stream.GetPacer().GetEffectivePeriodUs();
+   // The server's own frame decision; the socket model adds the write cost
+   stream_frame_result_t result = m_Stream.Tick(nowUs, (uint32_t)(nowUs / 1000), m_Socket);
+   if (result == STREAM_FRAME_SKIPPED)
+   {
+      m_Report.frames_skipped++;
+      m_LastFrameUs = -1;
+   }
+   else if (result == STREAM_FRAME_SENT)
+   {
+      // Jitter is measured between consecutive frames only; a skip in
+      // between already shows in the achieved rate.
+      if (m_LastFrameUs >= 0)
+      {
+         int64_t deviation = (nowUs - m_LastFrameUs) - (int64_t)periodUs;
+         uint32_t jitterUs = (uint32_t)((deviation < 0) ? -deviation : deviation);
+         m_Report.total_frame_jitter_us += jitterUs;
+         if (jitterUs > m_Report.max_frame_jitter_us)
+         {
+            m_Report.max_frame_jitter_us = jitterUs;
+         }
+      }
+      m_LastFrameUs = nowUs;
+      m_Report.frames_sent++;
+   }
+   return m_TickDoneUs;
+}
+
+CTimingSimulator::CSocketModel::CSocketModel(CTimingSimulator &simulator) : m_Simulator(simulator)
+{
+}
+
+const float *CTimingSimulator::CSocketModel::GetValues()
+{
+   // Simulated subscribers are not change-triggered
+   static const float values[STREAM_SUBSCRIPTION_MAX_FIELDS] = {};
+   return values;
+}
+
+bool CTimingSimulator::CSocketModel::IsWritable()
+{
+   const timing_sim_config_t &config = m_Simulator.m_Config;
+   return config.send_buffer_bytes - m_Simulator.GetBufferedBytes(m_Simulator.m_TickDoneUs) >= config.low_water_bytes;
+}
+
+void CTimingSimulator::CSocketModel::SendFrame()
+{
+   const timing_sim_config_t &config = m_Simulator.m_Config;
+   m_Simulator.m_TickDoneUs += config.frame_cost_us;
+   uint32_t buffered = m_Simulator.GetBufferedBytes(m_Simulator.m_TickDoneUs) + config.frame_bytes;
+   m_Simulator.m_BufferedBytes = (buffered < config.send_buffer_bytes) ? buffered : config.send_buffer_bytes;
+}
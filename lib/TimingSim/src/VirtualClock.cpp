@@ -0,0 +1,39 @@
+/**
+ * @file VirtualClock.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Implementation of the virtual clock.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include "VirtualClock.h"
+
+CVirtualClock::CVirtualClock() : m_NowUs(0)
+{
+}
+
+int64_t CVirtualClock::NowUs() const
+{
+   return m_NowUs;
+}
+
+uint32_t CVirtualClock::NowMs() const
+{
+   return (uint32_t)(m_NowUs / 1000);
+}
+
+void CVirtualClock::AdvanceTo(int64_t timeUs)
+{
+   if (timeUs > m_NowUs)
+   {
+      m_NowUs = timeUs;
+   }
+}
+
+void CVirtualClock::Advance(int64_t durationUs)
+{
+   AdvanceTo(m_NowUs + durationUs);
+}
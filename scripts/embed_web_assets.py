@@ -0,0 +1,122 @@
+"""
+Compress the dashboard in web/ and embed it in the EmbeddedWebServer library.
+
+Each file is gzipped at build time into a const array, so it is served from
+flash as is. The ETag is a hash of the compressed bytes; index.html refers to
+the other assets with ?v=<etag>, so they can be cached for a year and a new
+build is picked up through the revalidated index.
+
+Runs as a PlatformIO pre-build script, or standalone:
+    python3 scripts/embed_web_assets.py
+The output is only rewritten when it changes, so builds stay incremental.
+"""
+
+import gzip
+import hashlib
+import os
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".js": "application/javascript",
+    ".css": "text/css",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+    ".json": "application/json",
+}
+
+# The index is revalidated on every visit; everything it links is fingerprinted.
+INDEX_CACHE_CONTROL = "no-cache"
+ASSET_CACHE_CONTROL = "public, max-age=31536000, immutable"
+
+OUTPUT = os.path.join("lib", "EmbeddedWebServer", "src", "WebAssets.cpp")
+
+
+def compress(data):
+    # A fixed mtime keeps the output, and so the ETag, reproducible.
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def etag_of(compressed):
+    return '"%s"' % hashlib.sha256(compressed).hexdigest()[:16]
+
+
+def load_assets(web_dir):
+    names = sorted(n for n in os.listdir(web_dir)
+                   if os.path.splitext(n)[1] in CONTENT_TYPES)
+    assets = []
+    for name in names:
+        with open(os.path.join(web_dir, name), "rb") as f:
+            assets.append({"name": name, "data": f.read()})
+
+    # Fingerprint the linked assets first, then point the pages at them.
+    pages = [a for a in assets if a["name"].endswith(".html")]
+    linked = [a for a in assets if not a["name"].endswith(".html")]
+    for asset in linked:
+        asset["gzip"] = compress(asset["data"])
+        asset["etag"] = etag_of(asset["gzip"])
+        asset["cache"] = ASSET_CACHE_CONTROL
+    for page in pages:
+        html = page["data"].decode("utf-8")
+        for asset in linked:
+            version = asset["etag"].strip('"')
+            for attribute in ("href", "src"):
+                html = html.replace('%s="%s"' % (attribute, asset["name"]),
+                                    '%s="%s?v=%s"' % (attribute, asset["name"], version))
+        page["data"] = html.encode("utf-8")
+        page["gzip"] = compress(page["data"])
+        page["etag"] = etag_of(page["gzip"])
+        page["cache"] = INDEX_CACHE_CONTROL if page["name"] == "index.html" else ASSET_CACHE_CONTROL
+    return assets
+
+
+def render(assets):
+    lines = [
+        "/**",
+        " * @file WebAssets.cpp",
+        " * @brief Gzipped dashboard assets. Generated from web/ by",
+        " *        scripts/embed_web_assets.py; do not edit.",
+        " */",
+        "",
+        '#include "WebAssets.h"',
+        "",
+    ]
+    for index, asset in enumerate(assets):
+        lines.append("// %s: %d bytes, %d gzipped" % (asset["name"], len(asset["data"]), len(asset["gzip"])))
+        lines.append("static const uint8_t ASSET_%d[] = {" % index)
+        data = asset["gzip"]
+        for offset in range(0, len(data), 16):
+            chunk = ", ".join("0x%02x" % b for b in data[offset:offset + 16])
+            lines.append("   %s," % chunk)
+        lines.append("};")
+        lines.append("")
+    lines.append("const web_asset_t WEB_ASSETS[] = {")
+    for index, asset in enumerate(assets):
+        lines.append('   {"/%s", "%s", "%s", "%s", ASSET_%d, sizeof(ASSET_%d), %d},' % (
+            asset["name"], CONTENT_TYPES[os.path.splitext(asset["name"])[1]], asset["cache"],
+            asset["etag"].replace('"', '\\"'), index, index, len(asset["data"])))
+    lines.append("};")
+    lines.append("")
+    lines.append("const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def generate(project_dir):
+    assets = load_assets(os.path.join(project_dir, "web"))
+    output = os.path.join(project_dir, OUTPUT)
+    source = render(assets)
+    if os.path.exists(output):
+        with open(output, "r") as f:
+            if f.read() == source:
+                return
+    with open(output, "w") as f:
+        f.write(source)
+    for asset in assets:
+        print("Embedded %s: %d -> %d bytes" % (asset["name"], len(asset["data"]), len(asset["gzip"])))
+
+
+try:
+    Import("env")  # noqa: F821 (provided by PlatformIO)
+    generate(env["PROJECT_DIR"])  # noqa: F821
+except NameError:
+    generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -1,11 +1,20 @@
-#include <atomic>
-
 #include "RoverServer.h"
-#include <Adafruit_LSM6DSOX.h>
+#include "Lsm6dsoxSource.h"
+#include "TraceReplaySource.h"
 #include "NeoPixel.h"
 #include "AccessPointHelper.h"
 #include "GrpcServer.h"
+#include "EmbeddedWebServer.h"
 #include "JoystickData.h"
+#include "EventScheduler.h"
+#include "MemoryProfiler.h"
+#include "BootProfiler.h"
+#include "ImuSnapshotCache.h"
+#include "LatestValue.h"
+#include "WireI2cBus.h"
+#include "I2cScheduler.h"
+#include "I2cBusWorker.h"
+#include "AuxSensors.h"
 
 /**
  * @brief  Pins
@@ -13,6 +22,13 @@
 #define LSM6DOX_SDA_PIN 42
 #define LSM6DOX_SCL_PIN 41
 
+#ifdef ROVER_REPLAY_TRACE
+#include <LittleFS.h>
+#ifndef ROVER_REPLAY_SPEED
+#define ROVER_REPLAY_SPEED 1.0f
+#endif
+#endif
+
 /**
  * @brief NeoPixel Pins
  *
@@ -22,10 +38,53 @@
 
 CNeoPixel pixels(NEOPIXEL_DATA_PIN, NEOPIXEL_DATA_PIN);
 
-std::atomic<bool> imu_data_ready_flag;
+CEventScheduler scheduler;
+
+/**
+ * @brief Busy/idle accounting of both tasks, reported with the timer statistics.
+ *
+ */
+scheduler_load_t sensor_task_load;
+scheduler_load_t web_task_load;
+
+CMemoryProfiler memoryProfiler;
+
+CBootProfiler bootProfiler(BOOT_MILESTONES);
+
+/**
+ * @brief Latest magnetometer and power monitor readings, published by the
+ *        sensor task for the server.
+ *
+ */
+CLatestValue<aux_sensor_data_t> auxSensorData;
+
+/**
+ * @brief The servers, reserved at link time in every build. Their per-client
+ *        state is far too large for the server task's stack.
+ *
+ */
+static CGrpcServer grpc_server(GRPC_SERVER_PORT, ROVER_AP_SSID, ROVER_AP_PASS_PHRASE);
+static CEmbeddedWebServer web_server(WEB_SERVER_PORT, ROVER_AP_SSID, ROVER_AP_PASS_PHRASE);
+
+#if ROVER_STATIC_ALLOCATION
+/**
+ * @brief Task stacks, control blocks and queue storage reserved at link
+ *        time so steady-state operation needs no heap.
+ *
+ */
+static StackType_t sensor_task_stack[SENSOR_TASK_STACK_SIZE];
+static StaticTask_t sensor_task_tcb;
+static StackType_t web_task_stack[WEB_TASK_STACK_SIZE];
+static StaticTask_t web_task_tcb;
+static uint8_t imu_queue_storage[IMU_QUEUE_LENGTH * sizeof(imu_sample_t)];
+static StaticQueue_t imu_queue_buffer;
+static uint8_t imu_config_storage[sizeof(imu_config_t)];
+static StaticQueue_t imu_config_buffer;
+#endif
 
 void setup()
 {
+   bootProfiler.Mark("setup");
 
    Serial.begin(115200);
    Serial.setDebugOutput(true);
@@ -34,94 +93,219 @@ void setup()
 
    pixels.setBrightness(64);
 
-   pixels.SetPixelColor(CNeoPixel::Color(255, 0, 0)); // Set pixel to red
-   delay(1000);
-   pixels.UpdatePixelColor(CNeoPixel::Color(128, 0, 128), true); // Set pixel to red
-   imuSensorQueue = xQueueCreate(10, sizeof(imu_data_t));
-   delay(1000);
-   pixels.SetPixelColor(CNeoPixel::Color(0, 0, 0)); // Set pixel to red
-
-   // create a task that executes the SensorDataTask() function, with priority 1 and executed on core 0
-   xTaskCreatePinnedToCore(SensorDataTask, "Task0", 10000, NULL, 1, &sensor_process_task, 0);
-   // create a task that executes the WebServerTask() function, with priority 1 and executed on core 1
-   xTaskCreatePinnedToCore(WebServerTask, "Task1", 10000, NULL, 1, &web_handler_task, 1);
+   // From here on only the status engine drives the pixel; red until sampling starts.
+   pixels.StartStatusEngine(0);
+   pixels.RequestStatus(CNeoPixel::Color(255, 0, 0));
+#if ROVER_STATIC_ALLOCATION
+   imuSensorQueue = xQueueCreateStatic(IMU_QUEUE_LENGTH, sizeof(imu_sample_t), imu_queue_storage, &imu_queue_buffer);
+   imuConfigQueue = xQueueCreateStatic(1, sizeof(imu_config_t), imu_config_storage, &imu_config_buffer);
+#else
+   imuSensorQueue = xQueueCreate(IMU_QUEUE_LENGTH, sizeof(imu_sample_t));
+   imuConfigQueue = xQueueCreate(1, sizeof(imu_config_t));
+#endif
+
+   if (!scheduler.Begin())
+   {
+      log_e("Failed to start event scheduler.");
+   }
+   bootProfiler.Mark("scheduler");
+
+#if ROVER_STATIC_ALLOCATION
+   // create a task that executes the SensorDataTask() function, above the status engine priority and executed on core 0
+   sensor_process_task = xTaskCreateStaticPinnedToCore(SensorDataTask, "Task0", SENSOR_TASK_STACK_SIZE, NULL, SENSOR_TASK_PRIORITY, sensor_task_stack, &sensor_task_tcb, 0);
+   // create a task that executes the WebServerTask() function, above the status engine priority and executed on core 1
+   web_handler_task = xTaskCreateStaticPinnedToCore(WebServerTask, "Task1", WEB_TASK_STACK_SIZE, NULL, WEB_TASK_PRIORITY, web_task_stack, &web_task_tcb, 1);
+#else
+   // create a task that executes the SensorDataTask() function, above the status engine priority and executed on core 0
+   xTaskCreatePinnedToCore(SensorDataTask, "Task0", SENSOR_TASK_STACK_SIZE, NULL, SENSOR_TASK_PRIORITY, &sensor_process_task, 0);
+   // create a task that executes the WebServerTask() function, above the status engine priority and executed on core 1
+   xTaskCreatePinnedToCore(WebServerTask, "Task1", WEB_TASK_STACK_SIZE, NULL, WEB_TASK_PRIORITY, &web_handler_task, 1);
+#endif
+   memoryProfiler.RegisterTask("sensor", sensor_process_task, SENSOR_TASK_STACK_SIZE);
+   memoryProfiler.RegisterTask("server", web_handler_task, WEB_TASK_STACK_SIZE);
+   bootProfiler.Mark("tasks");
 }
 
 void loop()
 {
+   // All work runs in the tasks above; an empty loop() would keep the Arduino
+   // loop task spinning on core 1.
+   vTaskDelete(NULL);
 }
 
 void SensorDataTask(void *pvParameters)
 {
    log_i("Task0 running on core %d\n", xPortGetCoreID());
-   // Setup 6DOF Data
-   delay(2000);
-   imu_data_ready_flag = false;
-
-   Adafruit_LSM6DSOX lsm6dsox;
-   TwoWire i2c_wire(0);
-   
-   // Connect and initialize LSM6DSOx
+
+   // The IMU and the auxiliary sensors share one bus. Its driver serializes
+   // transfers, and the scheduler keeps auxiliary reads out of the IMU slot.
+   static TwoWire i2c_wire(0);
    i2c_wire.setPins(LSM6DOX_SDA_PIN, LSM6DOX_SCL_PIN);
-   while (!lsm6dsox.begin_I2C(LSM6DS_I2CADDR_DEFAULT, &i2c_wire, 0))
+#ifdef ROVER_REPLAY_TRACE
+   // Replay a recorded trace through the whole pipeline instead of the sensor.
+   static CTraceReplaySource imuSource(ROVER_REPLAY_TRACE, ROVER_REPLAY_SPEED, true);
+   if (!LittleFS.begin())
    {
-      log_e("Failed to initialize LSM6DOX.");
-      delay(1000);
+      log_e("Failed to mount LittleFS for trace replay.");
    }
+#else
+   static CLsm6dsoxSource imuSource(i2c_wire);
+#endif
+   bool imuReady = false;
+   int64_t nextInitAttemptUs = 0;
+   imu_config_t imuConfig;
+   bool imuConfigPending = false;
 
-   log_i("LSM6DSOX Found!");
+   imu_sample_t imu_samples[IMU_QUEUE_LENGTH];
+   uint32_t sequence = 0;
 
-   sensors_event_t accel;
-   sensors_event_t gyro;
-   sensors_event_t temp;
+   // Auxiliary reads are queued into the gaps between IMU ticks and run on a
+   // worker task, so this task never waits on the bus for them.
+   static CWireI2cBus auxBus(i2c_wire, LSM6DSOX_I2C_CLOCK_HZ);
+   static CI2cScheduler i2cScheduler(auxBus);
+   static CI2cBusWorker i2cWorker(i2cScheduler);
+   static CAuxSensors auxSensors;
+   TaskHandle_t self = xTaskGetCurrentTaskHandle();
+   auxBus.Begin();
+   auxSensors.Register(i2cScheduler, CEventScheduler::NowUs(), AUX_MAG_PERIOD_US, AUX_POWER_PERIOD_US);
+   if (i2cWorker.Start(self, EVENT_I2C_DONE, 0))
+   {
+      memoryProfiler.RegisterTask("i2c", i2cWorker.GetTask(), I2C_WORKER_STACK_SIZE);
+   }
+   else
+   {
+      log_e("Failed to start I2C worker.");
+   }
+   int64_t nextI2cStatsUs = CEventScheduler::NowUs() + STATS_LOG_PERIOD_US;
 
-   const uint8_t MAX_LED_WAIT = 5;
-   uint8_t led_wait_count = 0;
-   bool led_set = false;
-   imu_data_t imu_data;
+   // Sample on a drift-free period instead of sleeping after each read. The
+   // same tick drives source bring-up, so a missing sensor is retried without
+   // a fixed sleep and the first sample follows initialization by one period.
+   int sampleTimer = scheduler.AddTimer("imu-sample", self, EVENT_SENSOR_TICK);
+   int auxTimer = scheduler.AddTimer("i2c-aux", self, EVENT_I2C_DUE);
+   scheduler.StartPeriodic(sampleTimer, SENSOR_SAMPLE_PERIOD_US);
    for (;;)
    {
-      // Neo Pixel Blink to say that we are sampling data.
-      if ((led_wait_count < 80) && (led_set != true))
+      uint32_t events = CEventScheduler::WaitForEvents(portMAX_DELAY, &sensor_task_load);
+
+      // Configuration changes from the server; applied once the source is up.
+      if ((events & EVENT_IMU_CONFIG) && xQueueReceive(imuConfigQueue, &imuConfig, 0) == pdTRUE)
       {
-         pixels.UpdatePixelColor(CNeoPixel::Color(0, 50, 0)); // Set pixel to red
-         led_set = true;
+         imuConfigPending = true;
       }
-      else if ((led_wait_count >= 5) && (led_set == true))
+      if (imuReady && imuConfigPending)
       {
-         pixels.UpdatePixelColor(CNeoPixel::Color(0, 0, 0)); // Set pixel to red
-         led_set = false;
-         led_wait_count = 0;
+         imuConfigPending = false;
+         if (imuSource.Configure(imuConfig))
+         {
+            // Tick at the rate of the fastest channel; the source reads the
+            // slower channels on a subset of ticks.
+            scheduler.StartPeriodic(sampleTimer, CImuConfig::GetTickPeriodUs(imuConfig));
+            log_i("IMU config applied, tick every %u us", CImuConfig::GetTickPeriodUs(imuConfig));
+         }
+         else
+         {
+            log_e("%s does not support runtime configuration.", imuSource.GetName());
+         }
       }
-      else
+
+      if ((events & EVENT_SENSOR_TICK) && !imuReady)
       {
-         led_wait_count++;
+         int64_t nowUs = CEventScheduler::NowUs();
+         if (nowUs >= nextInitAttemptUs && !imuSource.Begin())
+         {
+            log_e("Failed to initialize %s.", imuSource.GetName());
+            pixels.RequestStatus(CNeoPixel::Color(255, 0, 0), PIXEL_PATTERN_BLINK, SAMPLING_BLINK_PERIOD_MS);
+            nextInitAttemptUs = nowUs + IMU_INIT_RETRY_PERIOD_US;
+         }
+         else if (nowUs >= nextInitAttemptUs)
+         {
+            imuReady = true;
+            log_i("%s Found!", imuSource.GetName());
+            bootProfiler.Mark("imu");
+            // Neo Pixel heartbeat to say that we are sampling data, rendered by the status engine.
+            pixels.RequestStatus(CNeoPixel::Color(0, 50, 0), PIXEL_PATTERN_BLINK, SAMPLING_BLINK_PERIOD_MS);
+         }
       }
-
-      // read data from IMU Sensor
-      lsm6dsox.getEvent(&accel, &gyro, &temp);
+      else if (events & EVENT_SENSOR_TICK)
+      {
+         // Read every sample that became due since the last tick; one for the
+         // sensor, several for a replay running faster than real time.
+         uint8_t count = imuSource.Read(imu_samples, IMU_QUEUE_LENGTH);
+         for (uint8_t i = 0; i < count; i++)
+         {
+            imu_sample_t &imu_sample = imu_samples[i];
+            imu_sample.sequence = ++sequence;
 #ifdef TELEPLOT_ENABLE
-      Serial.printf(">AccX:%0.2f\n", accel.acceleration.x);
-      Serial.printf(">AccY:%0.2f\n", accel.acceleration.y);
-      Serial.printf(">AccZ:%0.2f\n", accel.acceleration.z);
-      Serial.printf(">GyroX:%0.2f\n", gyro.gyro.x);
-      Serial.printf(">GyroY:%0.2f\n", gyro.gyro.y);
-      Serial.printf(">GyroZ:%0.2f\n", gyro.gyro.z);
+            imu_data_t imu_data = ImuRawToData(imu_sample.raw);
+            Serial.printf(">AccX:%0.2f\n", imu_data.accX);
+            Serial.printf(">AccY:%0.2f\n", imu_data.accY);
+            Serial.printf(">AccZ:%0.2f\n", imu_data.accZ);
+            Serial.printf(">GyroX:%0.2f\n", imu_data.gyroX);
+            Serial.printf(">GyroY:%0.2f\n", imu_data.gyroY);
+            Serial.printf(">GyroZ:%0.2f\n", imu_data.gyroZ);
 #endif
-      // Update only if data is not ready / stale.
-      if (imu_data_ready_flag == false) {
-         imu_data.accX = accel.acceleration.x;
-         imu_data.accY = accel.acceleration.y;
-         imu_data.accZ = accel.acceleration.z;
-         imu_data.gyroX = gyro.gyro.x;
-         imu_data.gyroY = gyro.gyro.y;
-         imu_data.gyroZ = gyro.gyro.z;
-         imu_data.temperature = temp.temperature;
-         xQueueSend(imuSensorQueue, &imu_data, pdMS_TO_TICKS(60));
-         imu_data_ready_flag = true;
-      }
-      pixels.UpdatePixelColor(CNeoPixel::Color(0, 0, 0)); // Set pixel to red
-      delay(20);
+            // Hand the sample over without blocking.
+            xQueueSend(imuSensorQueue, &imu_sample, 0);
+         }
+         // Wake the server task once for the whole batch.
+         if (count > 0 && web_handler_task != NULL)
+         {
+            xTaskNotify(web_handler_task, EVENT_IMU_SAMPLE, eSetBits);
+         }
+         if (count > 0 && sequence == count)
+         {
+            bootProfiler.Mark("first-sample", true);
+         }
+      }
+
+      // Collect finished auxiliary reads and publish what changed.
+      i2c_result_t i2cResult;
+      bool auxChanged = false;
+      while (i2cScheduler.TakeResult(i2cResult))
+      {
+         auxChanged |= auxSensors.Apply(i2cResult, millis());
+      }
+      if (auxChanged)
+      {
+         auxSensorData.Store(auxSensors.GetData());
+      }
+
+      // Queue the due auxiliary reads that end before the next IMU tick, and
+      // wake up again when the next one is due.
+      int64_t nowUs = CEventScheduler::NowUs();
+      int64_t windowEndUs;
+      if (!scheduler.GetDueUs(sampleTimer, windowEndUs))
+      {
+         windowEndUs = nowUs + SENSOR_SAMPLE_PERIOD_US;
+      }
+      if (i2cScheduler.Dispatch(nowUs, windowEndUs - I2C_IMU_GUARD_US) > 0)
+      {
+         i2cWorker.Kick();
+      }
+      int64_t auxDueUs;
+      if (i2cScheduler.GetNextDueUs(auxDueUs) && auxDueUs > nowUs)
+      {
+         scheduler.ArmAt(auxTimer, auxDueUs);
+      }
+
+      if (nowUs >= nextI2cStatsUs)
+      {
+         nextI2cStatsUs = nowUs + STATS_LOG_PERIOD_US;
+         i2c_job_stats_t jobStats;
+         scheduler_timer_stats_t jobTiming;
+         for (uint8_t job = 0; job < i2cScheduler.GetJobCount(); job++)
+         {
+            if (i2cScheduler.TakeStats(job, jobStats, jobTiming))
+            {
+               log_i("I2C %s: %u runs, %u errors, %u deferred, max %uus on bus, mean %uus late (max %uus)",
+                     i2cScheduler.GetJobName(job), jobStats.runs, jobStats.errors, jobStats.deferred,
+                     jobStats.max_duration_us,
+                     jobTiming.fires ? (uint32_t)(jobTiming.total_late_us / jobTiming.fires) : 0,
+                     jobTiming.max_late_us);
+            }
+         }
+      }
    }
 }
 
@@ -131,26 +315,105 @@ void WebServerTask(void *pvParameters)
 {
    log_i("Task1 running on core %d", xPortGetCoreID());
    log_i("Setting up gRPC server");
-   CGrpcServer grpcServer(50051, ROVER_AP_SSID, ROVER_AP_PASS_PHRASE);
-   grpcServer.SetupNetwork();
-   grpcServer.StartServer();
-   imu_data_t imu_data;
-   log_i("Starting gRPC Server");
+   CGrpcServer &grpcServer = grpc_server;
+   CEmbeddedWebServer &webServer = web_server;
+   log_i("Server objects: gRPC %u bytes, web %u bytes, task stack %u bytes",
+         sizeof(CGrpcServer), sizeof(CEmbeddedWebServer), WEB_TASK_STACK_SIZE);
+   grpcServer.SetMemoryProfiler(&memoryProfiler);
+   grpcServer.SetBootProfiler(&bootProfiler);
+   grpcServer.SetAuxSensorData(&auxSensorData);
+   grpcServer.SetImuConfigTarget(imuConfigQueue, sensor_process_task, EVENT_IMU_CONFIG);
+   bool serverReady = false;
+   int64_t nextNetworkAttemptUs = 0;
+   imu_sample_t imu_sample;
+   bool streamArmed = false;
+   int64_t streamArmedUs = 0;
+
+   // Sockets are polled, stream frames and statistics run on their own deadlines.
+   TaskHandle_t self = xTaskGetCurrentTaskHandle();
+   int socketTimer = scheduler.AddTimer("socket-poll", self, EVENT_SOCKET_POLL);
+   int streamTimer = scheduler.AddTimer("imu-stream", self, EVENT_STREAM_TICK);
+   int statsTimer = scheduler.AddTimer("stats", self, EVENT_STATS_TICK);
+   scheduler.StartPeriodic(socketTimer, SOCKET_POLL_PERIOD_US);
+   scheduler.StartPeriodic(statsTimer, STATS_LOG_PERIOD_US);
    for (;;)
    {
-      // Read only if data is ready.
-      if (imu_data_ready_flag == true) {
-         if (xQueueReceive(imuSensorQueue, &imu_data, pdMS_TO_TICKS(60)) == pdTRUE) {
-            grpcServer.UpdateImuData(imu_data);
+      uint32_t events = CEventScheduler::WaitForEvents(portMAX_DELAY, &web_task_load);
+
+      // Drain every sample queued since the last wake-up.
+      if (events & EVENT_IMU_SAMPLE)
+      {
+         while (xQueueReceive(imuSensorQueue, &imu_sample, 0) == pdTRUE)
+         {
+            grpcServer.UpdateImuData(imu_sample);
+         }
+         // WebSocket frames follow the samples, not the socket poll
+         if (serverReady)
+         {
+            webServer.pushImuFrames();
          }
-         imu_data_ready_flag = false;
       }
-      
+
+      // Bring the access point and server up from the poll tick, in parallel
+      // with sensor bring-up on the other core; failures retry without sleeping.
+      if (!serverReady && (events & EVENT_SOCKET_POLL) && CEventScheduler::NowUs() >= nextNetworkAttemptUs)
+      {
+         if (grpcServer.SetupNetwork())
+         {
+            bootProfiler.Mark("access-point");
+            log_i("Starting gRPC Server");
+            grpcServer.StartServer();
+            // The dashboard shares the access point brought up above
+            log_i("Starting web server on port %d", WEB_SERVER_PORT);
+            webServer.SetUpWebHandlers();
+            bootProfiler.Mark("server", true);
+            serverReady = true;
+         }
+         else
+         {
+            nextNetworkAttemptUs = CEventScheduler::NowUs() + NETWORK_RETRY_PERIOD_US;
+         }
+      }
+
       // Handle incoming client connections and process joystick data
-      grpcServer.HandleClients();
-      
-      // Get latest joystick data and use it for rover control
+      if (serverReady && (events & EVENT_SOCKET_POLL))
+      {
+         grpcServer.HandleClients();
+         webServer.setSensorPeriodUs(grpcServer.GetImuTickPeriodUs());
+         webServer.handleRequest();
+      }
+
+      if (events & EVENT_STREAM_TICK)
+      {
+         grpcServer.HandleStreamTick();
+         // The one-shot has fired
+         streamArmed = false;
+      }
+
+      // Re-arm the stream deadline only when it moved: after a tick or a
+      // request that changed a subscription. Arming takes the scheduler lock
+      // and restarts esp_timer, which most wake-ups do not need.
+      int64_t streamDueUs;
+      bool streaming = grpcServer.GetNextStreamDue(streamDueUs);
+      if (streaming && (!streamArmed || streamDueUs != streamArmedUs))
+      {
+         scheduler.ArmAt(streamTimer, streamDueUs);
+         streamArmed = true;
+         streamArmedUs = streamDueUs;
+      }
+      else if (!streaming && streamArmed)
+      {
+         scheduler.Stop(streamTimer);
+         streamArmed = false;
+      }
+
+      // Get latest joystick data from either server and use it for rover control
       joystick_data_t joystickData = grpcServer.GetJoystickData();
+      joystick_data_t webJoystickData = webServer.getJoystickData();
+      if (webJoystickData.timestamp > joystickData.timestamp)
+      {
+         joystickData = webJoystickData;
+      }
       
       // Example: Use joystick data to control something (e.g., print values)
       static unsigned long lastJoystickPrint = 0;
@@ -161,7 +424,31 @@ void WebServerTask(void *pvParameters)
                joystickData.left_button, joystickData.right_button);
          lastJoystickPrint = millis();
       }
-      
-      delay(5);
+
+      if (events & EVENT_STATS_TICK)
+      {
+         memoryProfiler.Sample();
+         memoryProfiler.Log();
+         scheduler.LogStats();
+         imu_snapshot_stats_t snapshotStats = CImuSnapshotCache::Instance()->TakeStats();
+         log_i("IMU snapshots: %u encodes, %u cache hits", snapshotStats.rebuilds, snapshotStats.hits);
+         grpc_stream_stats_t streamStats = grpcServer.TakeStreamStats();
+         log_i("IMU stream: %u subscribers (%u backed off), %u frames sent, %u skipped, %u unchanged",
+               streamStats.subscribers, streamStats.backed_off, streamStats.frames_sent,
+               streamStats.frames_skipped, streamStats.frames_suppressed);
+         ws_stats_t webSocketStats = webServer.takeWebSocketStats();
+         log_i("WebSocket: %u sessions, %u frames sent, %u skipped",
+               webSocketStats.sessions, webSocketStats.frames_sent, webSocketStats.frames_skipped);
+         grpc_admission_stats_t admissionStats = grpcServer.TakeAdmissionStats();
+         log_i("Requests: control %u (max wait %uus), query %u/%u limited (max wait %uus), diagnostic %u/%u limited (max wait %uus)",
+               admissionStats.handled[GRPC_CLASS_CONTROL], admissionStats.max_wait_us[GRPC_CLASS_CONTROL],
+               admissionStats.handled[GRPC_CLASS_QUERY], admissionStats.rejected[GRPC_CLASS_QUERY],
+               admissionStats.max_wait_us[GRPC_CLASS_QUERY],
+               admissionStats.handled[GRPC_CLASS_DIAGNOSTIC], admissionStats.rejected[GRPC_CLASS_DIAGNOSTIC],
+               admissionStats.max_wait_us[GRPC_CLASS_DIAGNOSTIC]);
+         log_i("CPU busy: sensor task %.1f%%, server task %.1f%%",
+               CEventScheduler::TakeBusyPercent(sensor_task_load),
+               CEventScheduler::TakeBusyPercent(web_task_load));
+      }
    }
 }
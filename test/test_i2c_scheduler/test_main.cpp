@@ -0,0 +1,259 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host run of the auxiliary I2C reads on a mock bus shared with the
+ *        IMU, on a virtual clock.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <AuxSensors.h>
+#include <I2cScheduler.h>
+#include <MockI2cBus.h>
+#include <stdio.h>
+
+/**
+ * @brief Bus timing of the firmware: LSM6DSOX clock, guard before each IMU
+ *        tick and the auxiliary read periods (RoverServer.h).
+ */
+#define BUS_CLOCK_HZ 400000
+#define IMU_GUARD_US 200
+#define MAG_PERIOD_US 12500
+#define POWER_PERIOD_US 100000
+
+/**
+ * @brief What a run of the sensor task loop saw.
+ */
+typedef struct {
+   uint32_t imu_ticks;
+   uint32_t aux_transfers;
+   uint32_t overruns;        // Auxiliary transactions still on the bus at an IMU tick
+   int64_t min_margin_us;    // Least time between the end of one and the next tick
+   uint32_t runs[I2C_SCHEDULER_MAX_JOBS];
+   uint32_t errors[I2C_SCHEDULER_MAX_JOBS];
+   uint32_t deferred[I2C_SCHEDULER_MAX_JOBS];
+} bus_run_t;
+
+/**
+ * @brief The IMU read at each tick: temperature, gyro and accel in one burst.
+ */
+static uint32_t ImuReadUs()
+{
+   i2c_transaction_t read = {0x6A, {0x20}, 1, 14};
+   return CI2cBus::EstimateUs(read, BUS_CLOCK_HZ);
+}
+
+/**
+ * @brief Run the sensor task's bus handling as main.cpp does: read the IMU
+ *        on each tick, collect results, queue the due jobs that end
+ *        IMU_GUARD_US before the next tick, and wake for the next job. The
+ *        worker runs queued transactions back to back as soon as they are
+ *        queued.
+ */
+static bus_run_t Run(CI2cScheduler &scheduler, CAuxSensors &sensors, uint32_t tickUs, int64_t startUs, int64_t durationUs)
+{
+   bus_run_t run = {};
+   run.min_margin_us = tickUs;
+   uint32_t imuUs = ImuReadUs();
+   int64_t nextTickUs = (startUs / tickUs + 1) * tickUs;
+   int64_t nowUs = startUs;
+   int64_t workerDoneUs = -1;
+
+   while (nowUs < startUs + durationUs)
+   {
+      if (nowUs == nextTickUs)
+      {
+         // The IMU read is synchronous and holds the bus first
+         run.imu_ticks++;
+         nextTickUs += tickUs;
+         nowUs += imuUs;
+      }
+
+      i2c_result_t result;
+      while (scheduler.TakeResult(result))
+      {
+         sensors.Apply(result, (uint32_t)(nowUs / 1000));
+      }
+
+      if (scheduler.Dispatch(nowUs, nextTickUs - IMU_GUARD_US) > 0)
+      {
+         int64_t busUs = nowUs;
+         int64_t endUs;
+         while (scheduler.ProcessOne(busUs, endUs))
+         {
+            run.aux_transfers++;
+            int64_t tickAfterStartUs = (busUs / tickUs + 1) * tickUs;
+            if (endUs > tickAfterStartUs)
+            {
+               run.overruns++;
+            }
+            else if (tickAfterStartUs - endUs < run.min_margin_us)
+            {
+               run.min_margin_us = tickAfterStartUs - endUs;
+            }
+            busUs = endUs;
+         }
+         workerDoneUs = busUs;
+      }
+
+      // Wake for the next tick, the next due job or the worker's results
+      int64_t wakeUs = nextTickUs;
+      int64_t dueUs;
+      if (scheduler.GetNextDueUs(dueUs) && dueUs > nowUs && dueUs < wakeUs) wakeUs = dueUs;
+      if (workerDoneUs > nowUs && workerDoneUs < wakeUs) wakeUs = workerDoneUs;
+      nowUs = (wakeUs > nowUs) ? wakeUs : nowUs + 1;
+   }
+
+   for (uint8_t job = 0; job < scheduler.GetJobCount(); job++)
+   {
+      i2c_job_stats_t stats;
+      scheduler_timer_stats_t timing;
+      scheduler.TakeStats(job, stats, timing);
+      run.runs[job] = stats.runs;
+      run.errors[job] = stats.errors;
+      run.deferred[job] = stats.deferred;
+   }
+   return run;
+}
+
+static void Report(const char *name, const CI2cScheduler &scheduler, const bus_run_t &run)
+{
+   char message[200];
+   int used = snprintf(message, sizeof(message), "%s: %u ticks, %u aux transfers, %u overruns, margin %lld us;",
+                       name, run.imu_ticks, run.aux_transfers, run.overruns, (long long)run.min_margin_us);
+   for (uint8_t job = 0; job < scheduler.GetJobCount() && used < (int)sizeof(message); job++)
+   {
+      used += snprintf(message + used, sizeof(message) - used, " %s %u/%u", scheduler.GetJobName(job), run.runs[job],
+                       run.deferred[job]);
+   }
+   TEST_MESSAGE(message);
+}
+
+static CMockI2cBus *s_Bus;
+static CI2cScheduler *s_Scheduler;
+static CAuxSensors *s_Sensors;
+
+void setUp(void)
+{
+   s_Bus = new CMockI2cBus(BUS_CLOCK_HZ);
+   s_Bus->AddDevice(LIS3MDL_ADDRESS, 1, 0x7F);
+   s_Bus->AddDevice(INA219_ADDRESS, 2);
+   // 100, -50 and 10 microtesla at 6842 counts per gauss
+   const uint8_t field[6] = {0xBA, 0x1A, 0xA3, 0xF2, 0xAC, 0x02};
+   s_Bus->SetRegisters(LIS3MDL_ADDRESS, 0x28, field, sizeof(field));
+   // 4000 shunt counts (40 mV, 0.4 A on 0.1 ohm) and 12.0 V
+   const uint8_t shunt[2] = {0x0F, 0xA0};
+   const uint8_t bus[2] = {0x5D, 0xC0};
+   s_Bus->SetRegisters(INA219_ADDRESS, 0x01, shunt, sizeof(shunt));
+   s_Bus->SetRegisters(INA219_ADDRESS, 0x02, bus, sizeof(bus));
+
+   s_Scheduler = new CI2cScheduler(*s_Bus);
+   s_Sensors = new CAuxSensors();
+   TEST_ASSERT_TRUE(s_Sensors->Register(*s_Scheduler, 0, MAG_PERIOD_US, POWER_PERIOD_US));
+}
+
+void tearDown(void)
+{
+   delete s_Sensors;
+   delete s_Scheduler;
+   delete s_Bus;
+}
+
+static void CheckRates(const bus_run_t &run, int64_t durationUs)
+{
+   // Job 0 is the one-shot configuration write, then mag, shunt and bus
+   TEST_ASSERT_EQUAL_UINT32(1, run.runs[0]);
+   TEST_ASSERT_UINT32_WITHIN(durationUs / MAG_PERIOD_US / 100 + 1, durationUs / MAG_PERIOD_US, run.runs[1]);
+   TEST_ASSERT_UINT32_WITHIN(1, durationUs / POWER_PERIOD_US, run.runs[2]);
+   TEST_ASSERT_UINT32_WITHIN(1, durationUs / POWER_PERIOD_US, run.runs[3]);
+   for (int job = 0; job < 4; job++)
+   {
+      TEST_ASSERT_EQUAL_UINT32(0, run.errors[job]);
+   }
+}
+
+void test_fast_imu_ticks_never_overrun(void)
+{
+   const int64_t durationUs = 10000000;
+   bus_run_t run = Run(*s_Scheduler, *s_Sensors, 1000000 / 416, 0, durationUs);
+   Report("416 Hz IMU", *s_Scheduler, run);
+
+   TEST_ASSERT_EQUAL_UINT32(0, run.overruns);
+   TEST_ASSERT_GREATER_OR_EQUAL_INT64(IMU_GUARD_US, run.min_margin_us);
+   CheckRates(run, durationUs);
+}
+
+void test_default_imu_ticks_never_overrun(void)
+{
+   const int64_t durationUs = 10000000;
+   bus_run_t run = Run(*s_Scheduler, *s_Sensors, 20000, 0, durationUs);
+   Report("50 Hz IMU", *s_Scheduler, run);
+
+   TEST_ASSERT_EQUAL_UINT32(0, run.overruns);
+   TEST_ASSERT_GREATER_OR_EQUAL_INT64(IMU_GUARD_US, run.min_margin_us);
+   CheckRates(run, durationUs);
+}
+
+void test_decodes_readings(void)
+{
+   Run(*s_Scheduler, *s_Sensors, 20000, 0, 1000000);
+
+   // The configuration write reached the device
+   uint8_t ctrl1 = 0;
+   TEST_ASSERT_TRUE(s_Bus->GetRegister(LIS3MDL_ADDRESS, 0x20, 0, ctrl1));
+   TEST_ASSERT_EQUAL_UINT8(0x7C, ctrl1);
+
+   const aux_sensor_data_t &data = s_Sensors->GetData();
+   TEST_ASSERT_TRUE(data.mag_valid);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, data.mag[0]);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, -50.0f, data.mag[1]);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 10.0f, data.mag[2]);
+   TEST_ASSERT_TRUE(data.power_valid);
+   TEST_ASSERT_FLOAT_WITHIN(0.001f, 12.0f, data.bus_voltage);
+   TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.4f, data.current);
+}
+
+void test_stretching_device_is_learned(void)
+{
+   // Clock stretching the estimate does not know about can overrun on each
+   // stretched job's first run only; later runs are dispatched from the
+   // measured time
+   s_Bus->SetStretch(INA219_ADDRESS, 600);
+   const int64_t durationUs = 10000000;
+   bus_run_t run = Run(*s_Scheduler, *s_Sensors, 1000000 / 416, 0, durationUs);
+   Report("416 Hz IMU, stretching INA219", *s_Scheduler, run);
+
+   TEST_ASSERT_LESS_OR_EQUAL_UINT32(2, run.overruns);
+   CheckRates(run, durationUs);
+}
+
+void test_missing_magnetometer_recovers(void)
+{
+   s_Bus->SetPresent(LIS3MDL_ADDRESS, false);
+   bus_run_t run = Run(*s_Scheduler, *s_Sensors, 20000, 0, 500000);
+   TEST_ASSERT_FALSE(s_Sensors->GetData().mag_valid);
+   TEST_ASSERT_TRUE(s_Sensors->GetData().power_valid);
+   TEST_ASSERT_GREATER_THAN_UINT32(0, run.errors[0]);
+   TEST_ASSERT_EQUAL_UINT32(0, run.overruns);
+
+   // Reconfigured within AUX_CONFIG_RETRY_US of coming back
+   s_Bus->SetPresent(LIS3MDL_ADDRESS, true);
+   Run(*s_Scheduler, *s_Sensors, 20000, 500000, AUX_CONFIG_RETRY_US + 2 * MAG_PERIOD_US);
+   TEST_ASSERT_TRUE(s_Sensors->GetData().mag_valid);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, s_Sensors->GetData().mag[0]);
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_fast_imu_ticks_never_overrun);
+   RUN_TEST(test_default_imu_ticks_never_overrun);
+   RUN_TEST(test_decodes_readings);
+   RUN_TEST(test_stretching_device_is_learned);
+   RUN_TEST(test_missing_magnetometer_recovers);
+   return UNITY_END();
+}
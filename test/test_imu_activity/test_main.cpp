@@ -0,0 +1,183 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host tests of the activity detector: onset levels, the rest
+ *        hysteresis, the starting state and the latency of an idle to fast
+ *        rate switch on the sensor tick.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <ImuActivity.h>
+#include <TimerDeadline.h>
+
+#define GRAVITY 9.80665f
+
+/**
+ * @brief Sensor tick periods of the idle 10 Hz and the fast 416 Hz profile.
+ */
+#define IDLE_PERIOD_US 100000
+#define FAST_PERIOD_US 2400
+
+static CImuActivityDetector s_Detector;
+
+static imu_sample_t Sample(uint32_t timestamp, float accDeviation, float gyro = 0.0f)
+{
+   imu_data_t data = {};
+   data.accZ = GRAVITY + accDeviation;
+   data.gyroZ = gyro;
+   data.temperature = 25.0f;
+   imu_sample_t sample;
+   sample.sequence = timestamp;
+   sample.timestamp = timestamp;
+   sample.raw = ImuDataToRaw(data, ImuAccelFsCode(4), ImuGyroFsCode(500));
+   return sample;
+}
+
+/**
+ * @brief Feed quiet samples every 10 ms until the detector goes idle.
+ *
+ * @return uint32_t Timestamp of the sample that made it idle.
+ */
+static uint32_t SettleIdle(uint32_t startMs)
+{
+   for (uint32_t t = startMs; t < startMs + 10000; t += 10)
+   {
+      if (s_Detector.Update(Sample(t, 0.0f)))
+      {
+         return t;
+      }
+   }
+   TEST_FAIL_MESSAGE("detector never went idle");
+   return 0;
+}
+
+void setUp(void)
+{
+   s_Detector = CImuActivityDetector();
+}
+
+void tearDown(void)
+{
+}
+
+void test_starts_active(void)
+{
+   TEST_ASSERT_TRUE(s_Detector.IsActive());
+   // Quiet samples alone do not report a change until the rest time passes
+   TEST_ASSERT_FALSE(s_Detector.Update(Sample(0, 0.0f)));
+   TEST_ASSERT_TRUE(s_Detector.IsActive());
+}
+
+void test_rest_takes_three_seconds(void)
+{
+   for (uint32_t t = 0; t < 3000; t += 10)
+   {
+      TEST_ASSERT_FALSE(s_Detector.Update(Sample(t, 0.1f, 0.05f)));
+   }
+   TEST_ASSERT_TRUE(s_Detector.Update(Sample(3000, 0.1f, 0.05f)));
+   TEST_ASSERT_FALSE(s_Detector.IsActive());
+}
+
+void test_rest_hysteresis_restarts_quiet_run(void)
+{
+   for (uint32_t t = 0; t <= 2000; t += 10)
+   {
+      s_Detector.Update(Sample(t, 0.0f));
+   }
+   // Between the rest and onset levels: still active, and the quiet run
+   // starts over
+   TEST_ASSERT_FALSE(s_Detector.Update(Sample(2010, 0.6f)));
+   TEST_ASSERT_FALSE(s_Detector.Update(Sample(2020, 0.0f, 0.2f)));
+   TEST_ASSERT_TRUE(s_Detector.IsActive());
+   TEST_ASSERT_EQUAL_UINT32(2030 + 3000, SettleIdle(2030));
+
+   // Idle, the same in-between levels do not wake it
+   TEST_ASSERT_FALSE(s_Detector.Update(Sample(6000, 0.9f)));
+   TEST_ASSERT_FALSE(s_Detector.Update(Sample(6010, 0.0f, 0.3f)));
+   TEST_ASSERT_FALSE(s_Detector.IsActive());
+}
+
+void test_single_sample_past_onset(void)
+{
+   SettleIdle(0);
+   TEST_ASSERT_TRUE(s_Detector.Update(Sample(5000, 1.2f)));
+   TEST_ASSERT_TRUE(s_Detector.IsActive());
+   // Staying in motion reports no further change
+   TEST_ASSERT_FALSE(s_Detector.Update(Sample(5010, -1.5f)));
+
+   SettleIdle(5020);
+   TEST_ASSERT_TRUE(s_Detector.Update(Sample(10000, 0.0f, 0.4f)));
+   TEST_ASSERT_TRUE(s_Detector.IsActive());
+}
+
+void test_configure_validates_and_restarts(void)
+{
+   const char *error = "";
+   imu_activity_config_t config = CImuActivityDetector::Default();
+   config.rest_accel = 0.0f;
+   TEST_ASSERT_FALSE(s_Detector.Configure(config, error));
+   config = CImuActivityDetector::Default();
+   config.onset_gyro = 0.05f;
+   TEST_ASSERT_FALSE(s_Detector.Configure(config, error));
+
+   SettleIdle(0);
+   config = CImuActivityDetector::Default();
+   config.rest_ms = 500;
+   TEST_ASSERT_TRUE_MESSAGE(s_Detector.Configure(config, error), error);
+   TEST_ASSERT_TRUE(s_Detector.IsActive());
+   TEST_ASSERT_EQUAL_UINT32(10000 + 500, SettleIdle(10000));
+}
+
+void test_idle_to_fast_switch(void)
+{
+   // The sensor tick runs at the idle period and each tick feeds the
+   // detector; onset restarts the tick at the fast period, as the server's
+   // ApplyImuConfig and the sensor task's StartPeriodic do.
+   SettleIdle(0);
+   CTimerDeadline tick;
+   int64_t nowUs = 10000000;
+   tick.StartPeriodic(IDLE_PERIOD_US, nowUs);
+
+   // Motion starts just after a tick, the worst case for detection
+   int64_t onsetUs = nowUs + IDLE_PERIOD_US + 1;
+   int64_t detectedUs = -1;
+   int64_t firstFastUs = -1;
+   for (int i = 0; i < 10 && firstFastUs < 0; i++)
+   {
+      nowUs = tick.GetDueUs();
+      tick.Fire(nowUs);
+      float deviation = (nowUs >= onsetUs) ? 2.0f : 0.0f;
+      if (detectedUs >= 0)
+      {
+         firstFastUs = nowUs;
+      }
+      else if (s_Detector.Update(Sample((uint32_t)(nowUs / 1000), deviation)) && s_Detector.IsActive())
+      {
+         detectedUs = nowUs;
+         tick.StartPeriodic(FAST_PERIOD_US, nowUs);
+      }
+   }
+
+   TEST_ASSERT_TRUE(detectedUs >= 0 && firstFastUs >= 0);
+   // Seen on the next idle tick, then one fast period to the first fast read
+   TEST_ASSERT_LESS_OR_EQUAL_INT64(IDLE_PERIOD_US, detectedUs - onsetUs);
+   TEST_ASSERT_EQUAL_INT64(FAST_PERIOD_US, firstFastUs - detectedUs);
+   TEST_ASSERT_LESS_OR_EQUAL_INT64(IDLE_PERIOD_US + FAST_PERIOD_US, firstFastUs - onsetUs);
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_starts_active);
+   RUN_TEST(test_rest_takes_three_seconds);
+   RUN_TEST(test_rest_hysteresis_restarts_quiet_run);
+   RUN_TEST(test_single_sample_past_onset);
+   RUN_TEST(test_configure_validates_and_restarts);
+   RUN_TEST(test_idle_to_fast_switch);
+   return UNITY_END();
+}
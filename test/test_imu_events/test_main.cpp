@@ -0,0 +1,232 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host tests of the motion event rules: hold and clear times,
+ *        re-trigger suppression and the threshold of each rule on each axis.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <ImuEvents.h>
+#include <math.h>
+
+#define GRAVITY 9.80665f
+
+static CImuEventEngine s_Engine;
+static imu_event_t s_Events[IMU_EVENTS_MAX_RULES];
+static uint32_t s_Sequence;
+
+/**
+ * @brief Sample at 16 g and 2000 dps full scale, so impacts do not saturate.
+ */
+static imu_sample_t Sample(uint32_t timestamp, float accX, float accY, float accZ,
+                           float gyroX = 0.0f, float gyroY = 0.0f, float gyroZ = 0.0f)
+{
+   imu_data_t data = {};
+   data.accX = accX;
+   data.accY = accY;
+   data.accZ = accZ;
+   data.gyroX = gyroX;
+   data.gyroY = gyroY;
+   data.gyroZ = gyroZ;
+   data.temperature = 25.0f;
+   imu_sample_t sample;
+   sample.sequence = ++s_Sequence;
+   sample.timestamp = timestamp;
+   sample.raw = ImuDataToRaw(data, ImuAccelFsCode(16), ImuGyroFsCode(2000));
+   return sample;
+}
+
+static uint8_t Evaluate(const imu_sample_t &sample)
+{
+   return s_Engine.Evaluate(sample, s_Events, IMU_EVENTS_MAX_RULES);
+}
+
+static uint8_t Resting(uint32_t timestamp)
+{
+   return Evaluate(Sample(timestamp, 0.0f, 0.0f, GRAVITY));
+}
+
+/**
+ * @brief Replace the rules with a single one.
+ */
+static void UseRule(imu_rule_type_t type, float threshold, float clear, uint32_t holdMs)
+{
+   imu_event_rule_t rule = {type, threshold, clear, holdMs};
+   const char *error = "";
+   TEST_ASSERT_TRUE_MESSAGE(s_Engine.SetRules(&rule, 1, error), error);
+}
+
+void setUp(void)
+{
+   s_Engine = CImuEventEngine();
+   s_Sequence = 0;
+}
+
+void tearDown(void)
+{
+}
+
+void test_default_rules_quiet_at_rest(void)
+{
+   TEST_ASSERT_EQUAL_UINT8(IMU_RULE_COUNT, s_Engine.GetRuleCount());
+   for (uint32_t t = 0; t < 1000; t += 10)
+   {
+      TEST_ASSERT_EQUAL_UINT8(0, Resting(t));
+   }
+}
+
+void test_impact_hysteresis_and_peak(void)
+{
+   // Default impact: above 3 g, ends below 2 g, no hold
+   TEST_ASSERT_EQUAL_UINT8(1, Evaluate(Sample(100, 0.0f, 0.0f, 3.5f * GRAVITY)));
+   TEST_ASSERT_EQUAL(IMU_RULE_IMPACT, s_Events[0].type);
+   TEST_ASSERT_TRUE(s_Events[0].active);
+   TEST_ASSERT_EQUAL_UINT32(0, s_Events[0].duration_ms);
+   TEST_ASSERT_EQUAL_UINT32(1, s_Events[0].sequence);
+
+   // Between the clear level and the threshold the event holds
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(110, 0.0f, 0.0f, 2.5f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(120, 0.0f, 0.0f, 4.0f * GRAVITY)));
+   TEST_ASSERT_TRUE(s_Engine.IsActive(0));
+
+   TEST_ASSERT_EQUAL_UINT8(1, Evaluate(Sample(140, 0.0f, 0.0f, GRAVITY)));
+   TEST_ASSERT_FALSE(s_Events[0].active);
+   TEST_ASSERT_FLOAT_WITHIN(0.05f, 4.0f * GRAVITY, s_Events[0].peak);
+   TEST_ASSERT_EQUAL_UINT32(40, s_Events[0].duration_ms);
+}
+
+void test_hold_time_before_start(void)
+{
+   // Default free fall: below 0.3 g for 30 ms, ends above 0.6 g
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(0, 0.0f, 0.0f, 0.1f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(10, 0.0f, 0.0f, 0.1f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(29, 0.0f, 0.0f, 0.1f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(1, Evaluate(Sample(30, 0.0f, 0.0f, 0.1f * GRAVITY)));
+   TEST_ASSERT_EQUAL(IMU_RULE_FREE_FALL, s_Events[0].type);
+   TEST_ASSERT_TRUE(s_Events[0].active);
+
+   // 0.5 g is between the levels, so the fall continues; 1 g ends it
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(40, 0.0f, 0.0f, 0.5f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(1, Resting(60));
+   TEST_ASSERT_FALSE(s_Events[0].active);
+   TEST_ASSERT_EQUAL_UINT32(30, s_Events[0].duration_ms);
+}
+
+void test_interrupted_hold_starts_over(void)
+{
+   UseRule(IMU_RULE_FREE_FALL, 0.3f * GRAVITY, 0.6f * GRAVITY, 30);
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(0, 0.0f, 0.0f, 0.1f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(20, 0.0f, 0.0f, 0.1f * GRAVITY)));
+   // One sample back above the threshold resets the hold
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(25, 0.0f, 0.0f, 0.4f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(30, 0.0f, 0.0f, 0.1f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(59, 0.0f, 0.0f, 0.1f * GRAVITY)));
+   TEST_ASSERT_EQUAL_UINT8(1, Evaluate(Sample(60, 0.0f, 0.0f, 0.1f * GRAVITY)));
+}
+
+void test_active_event_does_not_retrigger(void)
+{
+   UseRule(IMU_RULE_IMPACT, 3.0f * GRAVITY, 2.0f * GRAVITY, 0);
+   uint8_t starts = 0;
+   for (uint32_t t = 0; t < 100; t += 5)
+   {
+      // Oscillating around the threshold, never down to the clear level
+      float level = (t % 10 == 0) ? 3.5f : 2.6f;
+      starts += Evaluate(Sample(t, level * GRAVITY, 0.0f, 0.0f));
+   }
+   TEST_ASSERT_EQUAL_UINT8(1, starts);
+
+   // Cleared, it may start again
+   TEST_ASSERT_EQUAL_UINT8(1, Resting(100));
+   TEST_ASSERT_EQUAL_UINT8(1, Evaluate(Sample(110, 3.5f * GRAVITY, 0.0f, 0.0f)));
+   TEST_ASSERT_TRUE(s_Events[0].active);
+}
+
+void test_thresholds_on_every_axis(void)
+{
+   // Impact and rotation use magnitudes, so each axis reaches the same
+   // threshold; just below it nothing starts
+   for (int axis = 0; axis < 3; axis++)
+   {
+      float acc[3] = {0.0f, 0.0f, 0.0f};
+      float gyro[3] = {0.0f, 0.0f, 0.0f};
+
+      UseRule(IMU_RULE_IMPACT, 3.0f * GRAVITY, 2.0f * GRAVITY, 0);
+      acc[axis] = 2.9f * GRAVITY;
+      TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(0, acc[0], acc[1], acc[2])));
+      acc[axis] = -3.1f * GRAVITY;
+      TEST_ASSERT_EQUAL_UINT8(1, Evaluate(Sample(10, acc[0], acc[1], acc[2])));
+
+      UseRule(IMU_RULE_ROTATION, 3.0f, 2.0f, 500);
+      gyro[axis] = 2.9f;
+      TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(0, 0.0f, 0.0f, GRAVITY, gyro[0], gyro[1], gyro[2])));
+      TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(600, 0.0f, 0.0f, GRAVITY, gyro[0], gyro[1], gyro[2])));
+      gyro[axis] = 3.1f;
+      TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(1000, 0.0f, 0.0f, GRAVITY, gyro[0], gyro[1], gyro[2])));
+      TEST_ASSERT_EQUAL_UINT8(1, Evaluate(Sample(1500, 0.0f, 0.0f, GRAVITY, gyro[0], gyro[1], gyro[2])));
+      TEST_ASSERT_FLOAT_WITHIN(0.01f, 3.1f, s_Events[0].value);
+   }
+}
+
+void test_tilt_toward_each_side(void)
+{
+   // Tilt is the angle from +Z, the same whichever way the rover leans
+   const float sides[4][2] = {{1.0f, 0.0f}, {-1.0f, 0.0f}, {0.0f, 1.0f}, {0.0f, -1.0f}};
+   for (int side = 0; side < 4; side++)
+   {
+      UseRule(IMU_RULE_TILT, 45.0f, 35.0f, 250);
+      float lean = 60.0f * (float)M_PI / 180.0f;
+      float across = GRAVITY * sinf(lean);
+      float up = GRAVITY * cosf(lean);
+      TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(0, sides[side][0] * across, sides[side][1] * across, up)));
+      TEST_ASSERT_EQUAL_UINT8(1, Evaluate(Sample(250, sides[side][0] * across, sides[side][1] * across, up)));
+      TEST_ASSERT_FLOAT_WITHIN(0.2f, 60.0f, s_Events[0].value);
+
+      // 40 degrees is inside the hysteresis band; upright ends the event
+      lean = 40.0f * (float)M_PI / 180.0f;
+      TEST_ASSERT_EQUAL_UINT8(0, Evaluate(Sample(300, sides[side][0] * GRAVITY * sinf(lean),
+                                                 sides[side][1] * GRAVITY * sinf(lean), GRAVITY * cosf(lean))));
+      TEST_ASSERT_EQUAL_UINT8(1, Resting(400));
+      TEST_ASSERT_EQUAL_UINT32(150, s_Events[0].duration_ms);
+   }
+}
+
+void test_rules_validated(void)
+{
+   const char *error = "";
+   imu_event_rule_t rule = {IMU_RULE_IMPACT, 20.0f, 25.0f, 0};
+   TEST_ASSERT_FALSE(s_Engine.SetRules(&rule, 1, error));
+   rule = {IMU_RULE_FREE_FALL, 5.0f, 3.0f, 0};
+   TEST_ASSERT_FALSE(s_Engine.SetRules(&rule, 1, error));
+   rule = {IMU_RULE_ROTATION, -1.0f, -2.0f, 0};
+   TEST_ASSERT_FALSE(s_Engine.SetRules(&rule, 1, error));
+
+   imu_event_rule_t rules[IMU_EVENTS_MAX_RULES + 1];
+   for (int i = 0; i <= IMU_EVENTS_MAX_RULES; i++)
+   {
+      rules[i] = {IMU_RULE_IMPACT, 30.0f, 20.0f, 0};
+   }
+   TEST_ASSERT_FALSE(s_Engine.SetRules(rules, IMU_EVENTS_MAX_RULES + 1, error));
+   TEST_ASSERT_EQUAL_STRING("at most 8 rules", error);
+   // A refused set leaves the previous rules in place
+   TEST_ASSERT_EQUAL_UINT8(IMU_RULE_COUNT, s_Engine.GetRuleCount());
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_default_rules_quiet_at_rest);
+   RUN_TEST(test_impact_hysteresis_and_peak);
+   RUN_TEST(test_hold_time_before_start);
+   RUN_TEST(test_interrupted_hold_starts_over);
+   RUN_TEST(test_active_event_does_not_retrigger);
+   RUN_TEST(test_thresholds_on_every_axis);
+   RUN_TEST(test_tilt_toward_each_side);
+   RUN_TEST(test_rules_validated);
+   return UNITY_END();
+}
@@ -0,0 +1,165 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host tests of the history pyramid: min/max/mean aggregation, the
+ *        roll-up into coarser buckets, ring wraparound and level selection.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <ImuHistory.h>
+
+/**
+ * @brief Tolerance of a value after quantization to 16 g counts.
+ */
+#define VALUE_TOLERANCE 0.01f
+
+static CImuHistory s_History;
+static imu_history_bucket_t s_Buckets[IMU_HISTORY_BUCKETS + IMU_HISTORY_LEVELS];
+
+static imu_sample_t Sample(uint32_t timestamp, float accX)
+{
+   imu_data_t data = {};
+   data.accX = accX;
+   data.accZ = 9.81f;
+   data.temperature = 25.0f;
+   imu_sample_t sample;
+   sample.sequence = timestamp;
+   sample.timestamp = timestamp;
+   sample.raw = ImuDataToRaw(data, ImuAccelFsCode(16), ImuGyroFsCode(500));
+   return sample;
+}
+
+/**
+ * @brief Add samples every periodMs from 0 to before untilMs, with acc_x
+ *        equal to half the whole second the sample falls in.
+ */
+static void Feed(uint32_t untilMs, uint32_t periodMs)
+{
+   for (uint32_t t = 0; t < untilMs; t += periodMs)
+   {
+      s_History.Add(Sample(t, (t / 1000) * 0.5f));
+   }
+}
+
+void setUp(void)
+{
+   s_History.Reset();
+}
+
+void tearDown(void)
+{
+}
+
+void test_bucket_min_max_mean(void)
+{
+   s_History.Add(Sample(1000, 1.0f));
+   s_History.Add(Sample(1300, 3.0f));
+   s_History.Add(Sample(1999, 2.0f));
+   s_History.Add(Sample(2000, 7.0f));
+
+   TEST_ASSERT_EQUAL_UINT16(2, s_History.Query(0, 0, 5000, 0, s_Buckets, IMU_HISTORY_BUCKETS));
+   const imu_history_bucket_t &bucket = s_Buckets[0];
+   TEST_ASSERT_EQUAL_UINT32(1000, bucket.start_ms);
+   TEST_ASSERT_EQUAL_UINT32(3, bucket.count);
+   TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, 1.0f, bucket.min[IMU_CHANNEL_ACC_X]);
+   TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, 3.0f, bucket.max[IMU_CHANNEL_ACC_X]);
+   TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, 2.0f, bucket.sum[IMU_CHANNEL_ACC_X] / bucket.count);
+   TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, 9.81f, bucket.max[IMU_CHANNEL_ACC_Z]);
+   // The open bucket is included in queries
+   TEST_ASSERT_EQUAL_UINT32(2000, s_Buckets[1].start_ms);
+   TEST_ASSERT_EQUAL_UINT32(1, s_Buckets[1].count);
+}
+
+void test_rollup_into_coarser_levels(void)
+{
+   // 25 s at 10 Hz: 24 closed 1 s buckets, two closed 10 s buckets, and the
+   // rest still open at every level
+   Feed(25000, 100);
+   TEST_ASSERT_EQUAL_UINT16(25, s_History.Count(0, 0, 25000));
+
+   TEST_ASSERT_EQUAL_UINT16(3, s_History.Query(1, 0, 25000, 0, s_Buckets, IMU_HISTORY_BUCKETS));
+   const uint32_t counts[3] = {100, 100, 50};
+   for (int i = 0; i < 3; i++)
+   {
+      TEST_ASSERT_EQUAL_UINT32(i * 10000, s_Buckets[i].start_ms);
+      TEST_ASSERT_EQUAL_UINT32(counts[i], s_Buckets[i].count);
+      TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, i * 5.0f, s_Buckets[i].min[IMU_CHANNEL_ACC_X]);
+   }
+   TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, 4.5f, s_Buckets[0].max[IMU_CHANNEL_ACC_X]);
+   TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, 9.5f, s_Buckets[1].max[IMU_CHANNEL_ACC_X]);
+   TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, 12.0f, s_Buckets[2].max[IMU_CHANNEL_ACC_X]);
+   // Mean of seconds 10 to 19 at half a unit each
+   TEST_ASSERT_FLOAT_WITHIN(VALUE_TOLERANCE, 7.25f, s_Buckets[1].sum[IMU_CHANNEL_ACC_X] / s_Buckets[1].count);
+
+   // The minute bucket holds every sample, and its sum matches the seconds
+   TEST_ASSERT_EQUAL_UINT16(1, s_History.Query(2, 0, 25000, 0, s_Buckets, IMU_HISTORY_BUCKETS));
+   TEST_ASSERT_EQUAL_UINT32(250, s_Buckets[0].count);
+   float minuteSum = s_Buckets[0].sum[IMU_CHANNEL_ACC_X];
+   uint16_t seconds = s_History.Query(0, 0, 25000, 0, s_Buckets, IMU_HISTORY_BUCKETS);
+   float secondSum = 0.0f;
+   for (uint16_t i = 0; i < seconds; i++)
+   {
+      secondSum += s_Buckets[i].sum[IMU_CHANNEL_ACC_X];
+   }
+   TEST_ASSERT_FLOAT_WITHIN(0.5f, secondSum, minuteSum);
+}
+
+void test_ring_wraps_to_newest(void)
+{
+   // 90 s at 1 Hz overflows the 60 closed 1 s buckets
+   Feed(90000, 1000);
+   TEST_ASSERT_EQUAL_UINT16(IMU_HISTORY_BUCKETS + 1, s_History.Count(0, 0, 90000));
+   TEST_ASSERT_EQUAL_UINT16(IMU_HISTORY_BUCKETS + 1,
+                            s_History.Query(0, 0, 90000, 0, s_Buckets, IMU_HISTORY_BUCKETS + IMU_HISTORY_LEVELS));
+   TEST_ASSERT_EQUAL_UINT32(29000, s_Buckets[0].start_ms);
+   TEST_ASSERT_EQUAL_UINT32(89000, s_Buckets[IMU_HISTORY_BUCKETS].start_ms);
+   for (int i = 1; i <= IMU_HISTORY_BUCKETS; i++)
+   {
+      TEST_ASSERT_EQUAL_UINT32(s_Buckets[i - 1].start_ms + 1000, s_Buckets[i].start_ms);
+   }
+   // The dropped seconds are still in the coarser levels
+   TEST_ASSERT_EQUAL_UINT16(9, s_History.Query(1, 0, 90000, 0, s_Buckets, IMU_HISTORY_BUCKETS));
+   TEST_ASSERT_EQUAL_UINT32(0, s_Buckets[0].start_ms);
+   TEST_ASSERT_EQUAL_UINT32(10, s_Buckets[0].count);
+}
+
+void test_query_pages_through_range(void)
+{
+   Feed(30000, 500);
+   // Seconds 5 to 14 overlap the range
+   TEST_ASSERT_EQUAL_UINT16(10, s_History.Count(0, 5000, 14999));
+   TEST_ASSERT_EQUAL_UINT16(4, s_History.Query(0, 5000, 14999, 0, s_Buckets, 4));
+   TEST_ASSERT_EQUAL_UINT32(5000, s_Buckets[0].start_ms);
+   TEST_ASSERT_EQUAL_UINT16(4, s_History.Query(0, 5000, 14999, 4, s_Buckets, 4));
+   TEST_ASSERT_EQUAL_UINT32(9000, s_Buckets[0].start_ms);
+   TEST_ASSERT_EQUAL_UINT16(2, s_History.Query(0, 5000, 14999, 8, s_Buckets, 4));
+   TEST_ASSERT_EQUAL_UINT32(14000, s_Buckets[1].start_ms);
+}
+
+void test_select_level(void)
+{
+   Feed(90000, 1000);
+   // The last 10 s are held at 1 s, and 10 points need that resolution
+   TEST_ASSERT_EQUAL_UINT8(0, s_History.SelectLevel(80000, 89999, 10));
+   // Only a few points: the coarsest level giving them
+   TEST_ASSERT_EQUAL_UINT8(1, s_History.SelectLevel(60000, 89999, 3));
+   // The start has left the 1 s ring, so at best 10 s buckets
+   TEST_ASSERT_EQUAL_UINT8(1, s_History.SelectLevel(0, 89999, 60));
+   TEST_ASSERT_EQUAL_UINT8(2, s_History.SelectLevel(0, 89999, 2));
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_bucket_min_max_mean);
+   RUN_TEST(test_rollup_into_coarser_levels);
+   RUN_TEST(test_ring_wraps_to_newest);
+   RUN_TEST(test_query_pages_through_range);
+   RUN_TEST(test_select_level);
+   return UNITY_END();
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host tests of the spectrum analyzer: peak frequencies, the sample
+ *        rate taken from timestamps, and the compute cost of one window.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <ImuSpectrum.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+/**
+ * @brief Windows timed per size.
+ */
+#define BENCH_WINDOWS 400
+
+static CImuSpectrum s_Spectrum;
+
+/**
+ * @brief Sample with a sine of the given frequency and amplitude on acc_x
+ *        and gravity on acc_z.
+ */
+static imu_sample_t SineSample(uint32_t index, float rateHz, float frequencyHz, float amplitude, uint32_t timestamp)
+{
+   imu_data_t data = {};
+   data.accX = amplitude * sinf(2.0f * (float)M_PI * frequencyHz * index / rateHz);
+   data.accZ = 9.81f;
+   imu_sample_t sample;
+   sample.sequence = index;
+   sample.timestamp = timestamp;
+   sample.raw = ImuDataToRaw(data, ImuAccelFsCode(4), ImuGyroFsCode(500));
+   return sample;
+}
+
+static void Configure(uint16_t size, float overlap, float rateHz)
+{
+   imu_spectrum_config_t config;
+   config.size = size;
+   config.overlap = overlap;
+   config.window = IMU_WINDOW_HANN;
+   config.channels = (1 << IMU_CHANNEL_ACC_X) | (1 << IMU_CHANNEL_ACC_Y) | (1 << IMU_CHANNEL_ACC_Z);
+   config.sample_rate_hz = rateHz;
+   const char *error = "";
+   TEST_ASSERT_TRUE_MESSAGE(s_Spectrum.Configure(config, error), error);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_peak_at_sine_frequency(void)
+{
+   Configure(256, 0.5f, 200.0f);
+   bool ready = false;
+   for (uint32_t i = 0; i < 256; i++)
+   {
+      ready = s_Spectrum.Push(SineSample(i, 200.0f, 20.0f, 1.0f, 1000 + i * 5));
+   }
+   TEST_ASSERT_TRUE(ready);
+
+   imu_spectrum_peak_t peak;
+   TEST_ASSERT_EQUAL_UINT8(1, s_Spectrum.GetPeaks(0, &peak, 1));
+   TEST_ASSERT_FLOAT_WITHIN(0.2f, 20.0f, peak.frequency_hz);
+   TEST_ASSERT_FLOAT_WITHIN(0.1f, 1.0f, peak.magnitude);
+   // Gravity is removed with the mean
+   float bands[4];
+   s_Spectrum.GetBands(2, bands, 4);
+   TEST_ASSERT_LESS_THAN_FLOAT(0.01f, bands[0]);
+}
+
+void test_rate_follows_timestamps(void)
+{
+   // Configured for 50 Hz but fed at 200 Hz, as a replayed trace recorded
+   // at another rate would be
+   Configure(128, 0.5f, 50.0f);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.0f / 128, s_Spectrum.GetBinHz());
+   for (uint32_t i = 0; i < 128; i++)
+   {
+      s_Spectrum.Push(SineSample(i, 200.0f, 30.0f, 0.5f, i * 5));
+   }
+   TEST_ASSERT_EQUAL_UINT32(1, s_Spectrum.GetWindowCount());
+   TEST_ASSERT_FLOAT_WITHIN(0.5f, 200.0f, s_Spectrum.GetSampleRateHz());
+
+   imu_spectrum_peak_t peak;
+   TEST_ASSERT_EQUAL_UINT8(1, s_Spectrum.GetPeaks(0, &peak, 1));
+   TEST_ASSERT_FLOAT_WITHIN(0.5f, 30.0f, peak.frequency_hz);
+}
+
+void test_window_without_time_keeps_rate(void)
+{
+   Configure(64, 0.0f, 100.0f);
+   for (uint32_t i = 0; i < 64; i++)
+   {
+      s_Spectrum.Push(SineSample(i, 100.0f, 10.0f, 1.0f, 500));
+   }
+   TEST_ASSERT_EQUAL_UINT32(1, s_Spectrum.GetWindowCount());
+   TEST_ASSERT_EQUAL_FLOAT(100.0f, s_Spectrum.GetSampleRateHz());
+}
+
+void test_bench_window_cost(void)
+{
+   static const uint16_t SIZES[] = {64, 128, 256, 512};
+   for (uint16_t size : SIZES)
+   {
+      // Maximum overlap, so most pushes end a window
+      Configure(size, IMU_SPECTRUM_MAX_OVERLAP, 1000.0f);
+      uint32_t windows = 0;
+      double totalUs = 0.0;
+      double bestUs = 1e9;
+      for (uint32_t i = 0; windows < BENCH_WINDOWS; i++)
+      {
+         imu_sample_t sample = SineSample(i, 1000.0f, 80.0f, 1.0f, i);
+         auto start = std::chrono::steady_clock::now();
+         bool ready = s_Spectrum.Push(sample);
+         double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+         if (!ready) continue;
+         windows++;
+         totalUs += us;
+         if (us < bestUs) bestUs = us;
+      }
+
+      char message[120];
+      snprintf(message, sizeof(message), "%u points, 3 channels: %.1f us per window (best %.1f us)",
+               size, totalUs / windows, bestUs);
+      TEST_MESSAGE(message);
+      // Only a sanity bound; the time depends on the host
+      TEST_ASSERT_LESS_THAN_DOUBLE(5000.0, bestUs);
+   }
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_peak_at_sine_frequency);
+   RUN_TEST(test_rate_follows_timestamps);
+   RUN_TEST(test_window_without_time_keeps_rate);
+   RUN_TEST(test_bench_window_cost);
+   return UNITY_END();
+}
@@ -0,0 +1,198 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host torture test and read-latency benchmark for CLatestValue.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <LatestValue.h>
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#define TORTURE_READERS 3
+#define TORTURE_STORES 2000000UL
+#define LATENCY_LOADS 1000000UL
+
+/**
+ * @brief Payload whose words are all derived from the sequence, so a read
+ *        mixing two stores is detected.
+ */
+typedef struct
+{
+   uint32_t sequence;
+   uint32_t words[7];
+} torture_value_t;
+
+static uint32_t WordFor(uint32_t sequence, uint32_t index)
+{
+   return sequence * 2654435761U + index;
+}
+
+static torture_value_t MakeValue(uint32_t sequence)
+{
+   torture_value_t value;
+   value.sequence = sequence;
+   for (uint32_t i = 0; i < 7; i++)
+   {
+      value.words[i] = WordFor(sequence, i);
+   }
+   return value;
+}
+
+static bool IsWhole(const torture_value_t &value)
+{
+   for (uint32_t i = 0; i < 7; i++)
+   {
+      if (value.words[i] != WordFor(value.sequence, i))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+static double NowNs()
+{
+   return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_starts_zeroed(void)
+{
+   CLatestValue<torture_value_t> latest;
+   uint32_t version = 1;
+   torture_value_t value = latest.Load(version);
+   TEST_ASSERT_EQUAL_UINT32(0, version);
+   TEST_ASSERT_EQUAL_UINT32(0, value.sequence);
+   TEST_ASSERT_EQUAL_UINT32(0, latest.Version());
+}
+
+void test_store_then_load(void)
+{
+   CLatestValue<torture_value_t> latest;
+   latest.Store(MakeValue(41));
+   latest.Store(MakeValue(42));
+   uint32_t version = 0;
+   torture_value_t value = latest.Load(version);
+   TEST_ASSERT_EQUAL_UINT32(2, version);
+   TEST_ASSERT_EQUAL_UINT32(42, value.sequence);
+   TEST_ASSERT_TRUE(IsWhole(value));
+}
+
+void test_concurrent_readers_never_tear(void)
+{
+   CLatestValue<torture_value_t> latest;
+   std::atomic<bool> done(false);
+   std::atomic<uint32_t> torn(0);
+   std::atomic<uint32_t> backwards(0);
+   std::atomic<uint64_t> reads(0);
+
+   std::vector<std::thread> readers;
+   for (int r = 0; r < TORTURE_READERS; r++)
+   {
+      readers.emplace_back([&]() {
+         uint32_t lastVersion = 0;
+         uint64_t count = 0;
+         while (!done.load(std::memory_order_relaxed))
+         {
+            uint32_t version;
+            torture_value_t value = latest.Load(version);
+            // The writer stores sequence n as its n-th value; version 0 is
+            // the zeroed value from before the first store
+            if (version != 0 && (!IsWhole(value) || value.sequence != version))
+            {
+               torn++;
+            }
+            if (version < lastVersion)
+            {
+               backwards++;
+            }
+            lastVersion = version;
+            count++;
+         }
+         reads += count;
+      });
+   }
+
+   for (uint32_t sequence = 1; sequence <= TORTURE_STORES; sequence++)
+   {
+      latest.Store(MakeValue(sequence));
+   }
+   done = true;
+   for (std::thread &reader : readers)
+   {
+      reader.join();
+   }
+
+   char message[96];
+   snprintf(message, sizeof(message), "%d readers, %lu stores, %llu reads", TORTURE_READERS, TORTURE_STORES,
+            (unsigned long long)reads.load());
+   TEST_MESSAGE(message);
+   TEST_ASSERT_EQUAL_UINT32(0, torn.load());
+   TEST_ASSERT_EQUAL_UINT32(0, backwards.load());
+   TEST_ASSERT_EQUAL_UINT32(TORTURE_STORES, latest.Version());
+}
+
+void test_read_latency(void)
+{
+   CLatestValue<torture_value_t> latest;
+   latest.Store(MakeValue(1));
+   volatile uint32_t sink = 0;
+
+   double startNs = NowNs();
+   for (uint32_t i = 0; i < LATENCY_LOADS; i++)
+   {
+      sink = sink + latest.Load().sequence;
+   }
+   double idleNs = (NowNs() - startNs) / LATENCY_LOADS;
+
+   // Same loop while a writer keeps the sequence moving
+   std::atomic<bool> done(false);
+   std::thread writer([&]() {
+      uint32_t sequence = 2;
+      while (!done.load(std::memory_order_relaxed))
+      {
+         latest.Store(MakeValue(sequence++));
+      }
+   });
+   startNs = NowNs();
+   for (uint32_t i = 0; i < LATENCY_LOADS; i++)
+   {
+      sink = sink + latest.Load().sequence;
+   }
+   double busyNs = (NowNs() - startNs) / LATENCY_LOADS;
+   done = true;
+   writer.join();
+
+   char message[96];
+   snprintf(message, sizeof(message), "Load() %.1f ns idle, %.1f ns under a busy writer", idleNs, busyNs);
+   TEST_MESSAGE(message);
+   // Loose bounds: catch a reader that sleeps, not a slow host
+   TEST_ASSERT_LESS_THAN_DOUBLE(1000.0, idleNs);
+   TEST_ASSERT_LESS_THAN_DOUBLE(20000.0, busyNs);
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_starts_zeroed);
+   RUN_TEST(test_store_then_load);
+   RUN_TEST(test_concurrent_readers_never_tear);
+   RUN_TEST(test_read_latency);
+   return UNITY_END();
+}
@@ -0,0 +1,299 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host load test of request dispatch: clients flooding queries must
+ *        not hold up control requests, and the token buckets must hold.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <RequestQueue.h>
+#include <stdio.h>
+
+/**
+ * @brief Server limits, as in GrpcServer.h, which is not built on the host.
+ */
+#define MAX_CLIENTS           4
+#define MAX_PENDING_REQUESTS  4
+#define MAX_REQUESTS_PER_POLL 16
+#define QUERY_RATE_HZ         50
+#define QUERY_BURST           10
+#define DIAGNOSTIC_RATE_HZ    1
+#define DIAGNOSTIC_BURST      3
+
+#define CLASS_CONTROL    0
+#define CLASS_QUERY      1
+#define CLASS_DIAGNOSTIC 2
+#define CLASS_COUNT      3
+
+static const request_class_limit_t CLASS_LIMITS[CLASS_COUNT] = {
+   {0, 0},
+   {QUERY_RATE_HZ, QUERY_BURST},
+   {DIAGNOSTIC_RATE_HZ, DIAGNOSTIC_BURST},
+};
+
+/**
+ * @brief Server time per request: a served query encodes and sends a JSON
+ *        response, a refused one only a short error.
+ */
+#define CONTROL_COST_US  300
+#define QUERY_COST_US    1200
+#define REFUSED_COST_US  250
+
+/**
+ * @brief Control client sending joystick frames at 50 Hz.
+ */
+#define CONTROL_PERIOD_US 20000
+#define RUN_US            10000000LL
+
+typedef struct {
+   bool prioritized;       // Control requests keep their class; else queued as queries
+   uint8_t flooders;       // Clients keeping their queue full of floodClass
+   uint8_t floodClass;
+} load_config_t;
+
+typedef struct {
+   uint32_t controlHandled;
+   uint32_t controlRefused;
+   uint32_t controlMaxQueueUs;   // Longest time from queueing to dispatch
+   uint32_t controlMaxLatencyUs; // Longest time from arrival on the socket to dispatch
+   uint32_t floodHandled[MAX_CLIENTS];
+   uint32_t floodRefused[MAX_CLIENTS];
+} load_report_t;
+
+/**
+ * @brief Run the server loop of CGrpcServer::HandleClients() on a virtual
+ *        clock: read every client until its queue is full, then dispatch up
+ *        to MAX_REQUESTS_PER_POLL requests by class. Flooding clients always
+ *        have another request waiting; the last client sends control
+ *        requests on a fixed period.
+ */
+static load_report_t RunLoad(const load_config_t &config)
+{
+   load_report_t report = {};
+   CRequestQueue queues[MAX_CLIENTS];
+   CRequestDispatcher dispatcher;
+   uint8_t requestClass[MAX_CLIENTS][MAX_PENDING_REQUESTS];  // Class each request is admitted as
+   int64_t arrivedUs[MAX_CLIENTS][MAX_PENDING_REQUESTS];     // Time each request reached the socket
+   const uint8_t controlClient = config.flooders;
+
+   for (uint8_t i = 0; i <= controlClient; i++)
+   {
+      queues[i].Reset(MAX_PENDING_REQUESTS, CLASS_LIMITS, CLASS_COUNT, 0);
+   }
+
+   int64_t nowUs = 0;
+   int64_t nextControlUs = 0;
+   while (nowUs < RUN_US)
+   {
+      for (uint8_t i = 0; i < config.flooders; i++)
+      {
+         while (!queues[i].IsFull())
+         {
+            uint8_t slot = queues[i].Push(config.floodClass, nowUs);
+            requestClass[i][slot] = config.floodClass;
+            arrivedUs[i][slot] = nowUs;
+         }
+      }
+      while (nextControlUs <= nowUs && !queues[controlClient].IsFull())
+      {
+         uint8_t queuedClass = config.prioritized ? CLASS_CONTROL : CLASS_QUERY;
+         uint8_t slot = queues[controlClient].Push(queuedClass, nowUs);
+         requestClass[controlClient][slot] = CLASS_CONTROL;
+         arrivedUs[controlClient][slot] = nextControlUs;
+         nextControlUs += CONTROL_PERIOD_US;
+      }
+
+      CRequestQueue *active[MAX_CLIENTS] = {};
+      for (uint8_t i = 0; i <= controlClient; i++)
+      {
+         active[i] = &queues[i];
+      }
+      int dispatched = 0;
+      for (; dispatched < MAX_REQUESTS_PER_POLL; dispatched++)
+      {
+         int best = dispatcher.Select(active, controlClient + 1);
+         if (best < 0) break;
+         CRequestQueue &queue = queues[best];
+         uint8_t slot = queue.GetHeadSlot();
+         uint32_t queuedUs = (uint32_t)(nowUs - queue.GetHeadSinceUs());
+         uint32_t latencyUs = (uint32_t)(nowUs - arrivedUs[best][slot]);
+         uint8_t admitClass = requestClass[best][slot];
+         queue.Pop();
+
+         bool admitted = queue.Admit(admitClass, nowUs);
+         if (best == controlClient)
+         {
+            if (admitted) report.controlHandled++;
+            else report.controlRefused++;
+            if (queuedUs > report.controlMaxQueueUs) report.controlMaxQueueUs = queuedUs;
+            if (latencyUs > report.controlMaxLatencyUs) report.controlMaxLatencyUs = latencyUs;
+            nowUs += CONTROL_COST_US;
+         }
+         else if (admitted)
+         {
+            report.floodHandled[best]++;
+            nowUs += QUERY_COST_US;
+         }
+         else
+         {
+            report.floodRefused[best]++;
+            nowUs += REFUSED_COST_US;
+         }
+      }
+      if (dispatched == 0)
+      {
+         nowUs = nextControlUs;
+      }
+   }
+   return report;
+}
+
+static void Report(const char *name, const load_report_t &report)
+{
+   char message[160];
+   snprintf(message, sizeof(message), "%s: control %u handled, max queued %u us, max latency %u us; client 0 %u served %u refused",
+            name, (unsigned)report.controlHandled, (unsigned)report.controlMaxQueueUs, (unsigned)report.controlMaxLatencyUs,
+            (unsigned)report.floodHandled[0], (unsigned)report.floodRefused[0]);
+   TEST_MESSAGE(message);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_queue_keeps_arrival_order(void)
+{
+   CRequestQueue queue;
+   queue.Reset(3, CLASS_LIMITS, CLASS_COUNT, 0);
+   TEST_ASSERT_TRUE(queue.IsEmpty());
+   uint8_t first = queue.Push(CLASS_QUERY, 10);
+   uint8_t second = queue.Push(CLASS_CONTROL, 20);
+   queue.Push(CLASS_DIAGNOSTIC, 30);
+   TEST_ASSERT_TRUE(queue.IsFull());
+   TEST_ASSERT_EQUAL_UINT8(3, queue.Push(CLASS_QUERY, 40));
+
+   // The head stays the oldest request even when a later one ranks higher
+   TEST_ASSERT_EQUAL_UINT8(first, queue.GetHeadSlot());
+   TEST_ASSERT_EQUAL_UINT8(CLASS_QUERY, queue.GetHeadClass());
+   queue.Pop();
+   TEST_ASSERT_EQUAL_UINT8(second, queue.GetHeadSlot());
+   TEST_ASSERT_EQUAL_INT64(20, queue.GetHeadSinceUs());
+   TEST_ASSERT_EQUAL_UINT8(2, queue.GetCount());
+}
+
+void test_token_bucket_burst_and_refill(void)
+{
+   CRequestQueue queue;
+   queue.Reset(MAX_PENDING_REQUESTS, CLASS_LIMITS, CLASS_COUNT, 0);
+   for (int i = 0; i < QUERY_BURST; i++)
+   {
+      TEST_ASSERT_TRUE(queue.Admit(CLASS_QUERY, 0));
+   }
+   TEST_ASSERT_FALSE(queue.Admit(CLASS_QUERY, 0));
+   TEST_ASSERT_EQUAL_UINT32(1000 / QUERY_RATE_HZ + 1, queue.GetRetryAfterMs(CLASS_QUERY));
+   // One period later exactly one more token is there
+   TEST_ASSERT_TRUE(queue.Admit(CLASS_QUERY, 1000000 / QUERY_RATE_HZ));
+   TEST_ASSERT_FALSE(queue.Admit(CLASS_QUERY, 1000000 / QUERY_RATE_HZ));
+   // Control is never limited and does not share the query bucket
+   for (int i = 0; i < 1000; i++)
+   {
+      TEST_ASSERT_TRUE(queue.Admit(CLASS_CONTROL, 1000000 / QUERY_RATE_HZ));
+   }
+}
+
+void test_dispatcher_prefers_class_then_rotates(void)
+{
+   CRequestQueue queues[3];
+   CRequestDispatcher dispatcher;
+   CRequestQueue *active[3] = {&queues[0], &queues[1], &queues[2]};
+   for (int i = 0; i < 3; i++)
+   {
+      queues[i].Reset(MAX_PENDING_REQUESTS, CLASS_LIMITS, CLASS_COUNT, 0);
+      queues[i].Push(CLASS_QUERY, 0);
+      queues[i].Push(CLASS_QUERY, 0);
+   }
+   queues[2].Push(CLASS_CONTROL, 0);
+
+   // Equal heads take turns
+   TEST_ASSERT_EQUAL_INT(0, dispatcher.Select(active, 3));
+   queues[0].Pop();
+   TEST_ASSERT_EQUAL_INT(1, dispatcher.Select(active, 3));
+   queues[1].Pop();
+   // A control request jumps the other clients but not its own queue
+   queues[0].Clear();
+   queues[0].Push(CLASS_CONTROL, 0);
+   TEST_ASSERT_EQUAL_INT(0, dispatcher.Select(active, 3));
+   queues[0].Pop();
+   // Skipped clients are not served
+   active[2] = NULL;
+   TEST_ASSERT_EQUAL_INT(1, dispatcher.Select(active, 3));
+   queues[1].Pop();
+   TEST_ASSERT_EQUAL_INT(-1, dispatcher.Select(active, 3));
+}
+
+void test_query_flood_does_not_delay_control(void)
+{
+   load_config_t config = {true, MAX_CLIENTS - 1, CLASS_QUERY};
+   load_report_t report = RunLoad(config);
+   Report("query flood", report);
+
+   TEST_ASSERT_EQUAL_UINT32(RUN_US / CONTROL_PERIOD_US, report.controlHandled);
+   TEST_ASSERT_EQUAL_UINT32(0, report.controlRefused);
+   // Once read, a control request is the next one dispatched
+   TEST_ASSERT_EQUAL_UINT32(0, report.controlMaxQueueUs);
+   // From the socket it waits at most for the rest of one dispatch round
+   TEST_ASSERT_LESS_OR_EQUAL_UINT32(MAX_REQUESTS_PER_POLL * QUERY_COST_US, report.controlMaxLatencyUs);
+
+   // Each flooder gets its burst plus the sustained rate and no more
+   for (uint8_t i = 0; i < config.flooders; i++)
+   {
+      uint32_t allowed = (uint32_t)(QUERY_RATE_HZ * RUN_US / 1000000) + QUERY_BURST;
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32(allowed, report.floodHandled[i]);
+      TEST_ASSERT_GREATER_OR_EQUAL_UINT32(allowed * 9 / 10, report.floodHandled[i]);
+      TEST_ASSERT_GREATER_THAN_UINT32(report.floodHandled[i], report.floodRefused[i]);
+   }
+}
+
+void test_diagnostic_flood_is_held_to_its_bucket(void)
+{
+   load_config_t config = {true, 1, CLASS_DIAGNOSTIC};
+   load_report_t report = RunLoad(config);
+   Report("diagnostic flood", report);
+
+   TEST_ASSERT_EQUAL_UINT32(0, report.controlMaxQueueUs);
+   TEST_ASSERT_LESS_OR_EQUAL_UINT32(DIAGNOSTIC_RATE_HZ * RUN_US / 1000000 + DIAGNOSTIC_BURST, report.floodHandled[0]);
+}
+
+void test_without_priority_control_queues_behind_flood(void)
+{
+   // The same load with control requests queued as queries: the bound
+   // above holds only because of the class order
+   load_config_t config = {false, MAX_CLIENTS - 1, CLASS_QUERY};
+   load_report_t report = RunLoad(config);
+   Report("no priority", report);
+
+   load_config_t prioritized = {true, MAX_CLIENTS - 1, CLASS_QUERY};
+   load_report_t reference = RunLoad(prioritized);
+   TEST_ASSERT_GREATER_THAN_UINT32(reference.controlMaxQueueUs + REFUSED_COST_US, report.controlMaxQueueUs);
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_queue_keeps_arrival_order);
+   RUN_TEST(test_token_bucket_burst_and_refill);
+   RUN_TEST(test_dispatcher_prefers_class_then_rotates);
+   RUN_TEST(test_query_flood_does_not_delay_control);
+   RUN_TEST(test_diagnostic_flood_is_held_to_its_bucket);
+   RUN_TEST(test_without_priority_control_queues_behind_flood);
+   return UNITY_END();
+}
@@ -0,0 +1,146 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host tests of the per-tick stream frame decision.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <StreamSubscription.h>
+
+/**
+ * @brief Sink with a settable sample and socket state.
+ */
+class CTestSink : public CStreamSink
+{
+public:
+   CTestSink() : writable(true), frames(0), valueReads(0)
+   {
+      values[0] = 0.0f;
+      values[1] = 0.0f;
+   }
+   const float *GetValues() override
+   {
+      valueReads++;
+      return values;
+   }
+   bool IsWritable() override
+   {
+      return writable;
+   }
+   void SendFrame() override
+   {
+      frames++;
+   }
+
+   float values[2];
+   bool writable;
+   uint32_t frames;
+   uint32_t valueReads;
+};
+
+static CStreamSubscription s_Stream;
+static CTestSink s_Sink;
+
+void setUp(void)
+{
+   s_Stream = CStreamSubscription();
+   s_Sink = CTestSink();
+}
+
+void tearDown(void)
+{
+}
+
+void test_sends_on_deadlines(void)
+{
+   s_Stream.Start(10000, false, 0, 0);
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(0, 0, s_Sink));
+   TEST_ASSERT_EQUAL(STREAM_FRAME_NOT_DUE, s_Stream.Tick(5000, 5, s_Sink));
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(10000, 10, s_Sink));
+   TEST_ASSERT_EQUAL_UINT32(2, s_Sink.frames);
+   TEST_ASSERT_EQUAL_UINT32(0, s_Sink.valueReads);
+   TEST_ASSERT_EQUAL_INT64(20000, s_Stream.GetPacer().GetDueUs());
+}
+
+void test_skips_when_not_writable(void)
+{
+   s_Stream.Start(10000, true, 0, 0);
+   s_Sink.writable = false;
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SKIPPED, s_Stream.Tick(0, 0, s_Sink));
+   TEST_ASSERT_EQUAL_UINT32(0, s_Sink.frames);
+   TEST_ASSERT_TRUE(s_Stream.GetPacer().IsBackedOff());
+
+   stream_frame_counts_t counts = s_Stream.TakeCounts();
+   TEST_ASSERT_EQUAL_UINT32(1, counts.frames_skipped);
+   counts = s_Stream.TakeCounts();
+   TEST_ASSERT_EQUAL_UINT32(0, counts.frames_skipped);
+}
+
+void test_deadband_suppresses_small_changes(void)
+{
+   const float thresholds[2] = {0.5f, -1.0f};
+   s_Stream.Start(10000, false, 0, 0);
+   s_Stream.SetDeadband(thresholds, 2, 0);
+   TEST_ASSERT_TRUE(s_Stream.IsDeadband());
+
+   // The first frame always goes out; the ignored field never triggers one
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(0, 0, s_Sink));
+   s_Sink.values[0] = 0.3f;
+   s_Sink.values[1] = 100.0f;
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SUPPRESSED, s_Stream.Tick(10000, 10, s_Sink));
+   // Drift is measured from the last frame sent, so it adds up
+   s_Sink.values[0] = 0.6f;
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(20000, 20, s_Sink));
+
+   stream_frame_counts_t counts = s_Stream.TakeCounts();
+   TEST_ASSERT_EQUAL_UINT32(2, counts.frames_sent);
+   TEST_ASSERT_EQUAL_UINT32(1, counts.frames_suppressed);
+}
+
+void test_heartbeat_breaks_silence(void)
+{
+   const float thresholds[2] = {1.0f, 1.0f};
+   s_Stream.Start(10000, false, 0, 0);
+   s_Stream.SetDeadband(thresholds, 2, 25);
+
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(0, 0, s_Sink));
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SUPPRESSED, s_Stream.Tick(10000, 10, s_Sink));
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SUPPRESSED, s_Stream.Tick(20000, 20, s_Sink));
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(30000, 30, s_Sink));
+}
+
+void test_early_tick_within_slack_sends(void)
+{
+   s_Stream.Start(10000, false, 0, 0);
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(0, 0, s_Sink));
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(10000 - STREAM_PACER_EARLY_US, 9, s_Sink));
+   // The next deadline keeps its phase
+   TEST_ASSERT_EQUAL_INT64(20000, s_Stream.GetPacer().GetDueUs());
+   TEST_ASSERT_EQUAL(STREAM_FRAME_NOT_DUE, s_Stream.Tick(20000 - STREAM_PACER_EARLY_US - 1, 19, s_Sink));
+}
+
+void test_late_tick_drops_missed_frames(void)
+{
+   s_Stream.Start(10000, false, 0, 0);
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(0, 0, s_Sink));
+   // Three periods late: one frame, then back on the original phase
+   TEST_ASSERT_EQUAL(STREAM_FRAME_SENT, s_Stream.Tick(35000, 35, s_Sink));
+   TEST_ASSERT_EQUAL_INT64(40000, s_Stream.GetPacer().GetDueUs());
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_sends_on_deadlines);
+   RUN_TEST(test_skips_when_not_writable);
+   RUN_TEST(test_deadband_suppresses_small_changes);
+   RUN_TEST(test_heartbeat_breaks_silence);
+   RUN_TEST(test_early_tick_within_slack_sends);
+   RUN_TEST(test_late_tick_drops_missed_frames);
+   return UNITY_END();
+}
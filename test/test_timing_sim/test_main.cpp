@@ -0,0 +1,314 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host benchmark of the stream and sensor timing, run through
+ *        CTimingSimulator with the shipped pacing and frame decisions.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <TimingSimulator.h>
+#include <stdio.h>
+
+/**
+ * @brief Worst frame interval deviation accepted on an uncongested link:
+ *        two timer latencies plus the work of one server run.
+ */
+#define FRAME_JITTER_BOUND_US 500
+
+/**
+ * @brief Outcome of the delay()-paced loops the scheduler replaced.
+ */
+typedef struct {
+   float sensor_rate_hz;
+   uint32_t max_sensor_jitter_us;   // Worst deviation of a read-to-read interval from the period
+   float stream_rate_hz;
+   uint32_t max_frame_jitter_us;    // Worst deviation of a frame interval from the stream period
+   uint32_t server_wakeups;
+   float server_busy_percent;
+} delay_paced_report_t;
+
+static uint32_t s_Random = 1;
+
+static uint32_t Jitter(uint32_t maxUs)
+{
+   s_Random ^= s_Random << 13;
+   s_Random ^= s_Random >> 17;
+   s_Random ^= s_Random << 5;
+   return maxUs ? s_Random % (maxUs + 1) : 0;
+}
+
+static uint32_t Deviation(int64_t intervalUs, int64_t periodUs)
+{
+   int64_t deviation = intervalUs - periodUs;
+   return (uint32_t)((deviation < 0) ? -deviation : deviation);
+}
+
+/**
+ * @brief The loops before the scheduler, on a 1 ms FreeRTOS tick with the
+ *        same costs: the sensor task reads and then calls delay(20), and
+ *        the server task serves its streaming client in a loop paced by
+ *        delay(1), sending a frame once millis() has moved 1000 / rate on.
+ */
+static delay_paced_report_t RunDelayPaced(const timing_sim_config_t &config)
+{
+   delay_paced_report_t report = {};
+   s_Random = config.seed;
+
+   uint32_t reads = 0;
+   int64_t lastReadUs = -1;
+   for (int64_t nowUs = 0; nowUs < config.duration_us;)
+   {
+      if (lastReadUs >= 0)
+      {
+         uint32_t jitterUs = Deviation(nowUs - lastReadUs, config.sensor_period_us);
+         if (jitterUs > report.max_sensor_jitter_us) report.max_sensor_jitter_us = jitterUs;
+      }
+      lastReadUs = nowUs;
+      reads++;
+      int64_t readDoneUs = nowUs + config.wake_cost_us + config.sensor_read_us + Jitter(config.sensor_read_jitter_us);
+      // vTaskDelay() counts whole ticks from the tick the call is made in
+      nowUs = (readDoneUs / 1000 + config.sensor_period_us / 1000) * 1000 + Jitter(config.timer_latency_us);
+   }
+
+   uint32_t frames = 0;
+   int64_t busyUs = 0;
+   int64_t lastFrameUs = -1;
+   uint32_t lastFrameMs = 0;
+   uint32_t streamPeriodMs = 1000 / config.stream_rate_hz;
+   for (int64_t tickUs = 0; tickUs < config.duration_us; tickUs += 1000)
+   {
+      int64_t nowUs = tickUs + Jitter(config.timer_latency_us);
+      uint32_t nowMs = (uint32_t)(nowUs / 1000);
+      report.server_wakeups++;
+      busyUs += config.wake_cost_us + config.poll_cost_us;
+      if (lastFrameUs < 0 || nowMs - lastFrameMs >= streamPeriodMs)
+      {
+         if (lastFrameUs >= 0)
+         {
+            uint32_t jitterUs = Deviation(nowUs - lastFrameUs, 1000000 / config.stream_rate_hz);
+            if (jitterUs > report.max_frame_jitter_us) report.max_frame_jitter_us = jitterUs;
+         }
+         lastFrameUs = nowUs;
+         lastFrameMs = nowMs;
+         frames++;
+         busyUs += config.frame_cost_us;
+      }
+   }
+
+   float seconds = (float)config.duration_us / 1000000.0f;
+   report.sensor_rate_hz = (float)reads / seconds;
+   report.stream_rate_hz = (float)frames / seconds;
+   report.server_busy_percent = 100.0f * (float)busyUs / (float)config.duration_us;
+   return report;
+}
+
+static void Report(const char *name, const timing_sim_report_t &report)
+{
+   char message[200];
+   snprintf(message, sizeof(message),
+            "%s: %.2f Hz, %u sent, %u skipped, %u samples dropped, frame jitter max %u us mean %.1f us, "
+            "server busy %.2f%%",
+            name, report.stream_rate_hz, report.frames_sent, report.frames_skipped, report.samples_dropped,
+            report.max_frame_jitter_us,
+            report.frames_sent ? (double)report.total_frame_jitter_us / report.frames_sent : 0.0,
+            report.server_busy_percent);
+   TEST_MESSAGE(message);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_default_stream_holds_rate(void)
+{
+   timing_sim_config_t config = CTimingSimulator::Default();
+   timing_sim_report_t report = CTimingSimulator().Run(config);
+   Report("10 Hz", report);
+
+   TEST_ASSERT_FLOAT_WITHIN(0.05f, 10.0f, report.stream_rate_hz);
+   TEST_ASSERT_EQUAL_UINT32(0, report.frames_skipped);
+   TEST_ASSERT_EQUAL_UINT32(0, report.samples_dropped);
+   TEST_ASSERT_LESS_OR_EQUAL_UINT32(FRAME_JITTER_BOUND_US, report.max_frame_jitter_us);
+   TEST_ASSERT_LESS_OR_EQUAL_UINT32(config.timer_latency_us, report.sensor_timer.max_jitter_us);
+}
+
+void test_fast_sensor_and_stream(void)
+{
+   timing_sim_config_t config = CTimingSimulator::Default();
+   config.sensor_period_us = 1000000 / 416;
+   config.stream_rate_hz = 100;
+   timing_sim_report_t report = CTimingSimulator().Run(config);
+   Report("416 Hz sensor, 100 Hz stream", report);
+
+   TEST_ASSERT_FLOAT_WITHIN(0.5f, 100.0f, report.stream_rate_hz);
+   TEST_ASSERT_EQUAL_UINT32(0, report.frames_skipped);
+   TEST_ASSERT_EQUAL_UINT32(0, report.samples_dropped);
+   TEST_ASSERT_EQUAL_UINT32(0, report.ticks_coalesced);
+   TEST_ASSERT_LESS_OR_EQUAL_UINT32(FRAME_JITTER_BOUND_US, report.max_frame_jitter_us);
+}
+
+void test_congested_link_backs_off(void)
+{
+   // 100 Hz of 180 byte frames over a link that carries 50 of them a second
+   timing_sim_config_t config = CTimingSimulator::Default();
+   config.stream_rate_hz = 100;
+   config.link_bytes_per_s = 9000;
+   float linkRateHz = (float)config.link_bytes_per_s / config.frame_bytes;
+
+   timing_sim_report_t adaptive = CTimingSimulator().Run(config);
+   Report("congested, adaptive", adaptive);
+   config.adaptive = false;
+   timing_sim_report_t fixed = CTimingSimulator().Run(config);
+   Report("congested, fixed", fixed);
+
+   // Either way the link rate is the ceiling and the sensor never waits
+   TEST_ASSERT_LESS_OR_EQUAL(linkRateHz * 1.02f, adaptive.stream_rate_hz);
+   TEST_ASSERT_GREATER_OR_EQUAL(linkRateHz * 0.9f, adaptive.stream_rate_hz);
+   TEST_ASSERT_EQUAL_UINT32(0, adaptive.samples_dropped);
+   TEST_ASSERT_EQUAL_UINT32(0, fixed.samples_dropped);
+   // Backoff settles near the link rate instead of skipping every other frame
+   TEST_ASSERT_LESS_THAN_UINT32(adaptive.frames_sent / 20, adaptive.frames_skipped);
+   TEST_ASSERT_GREATER_THAN_UINT32(fixed.frames_sent / 2, fixed.frames_skipped);
+}
+
+void test_queue_absorbs_short_stalls(void)
+{
+   // A 50 ms request every 100 polls fits in the 10 sample queue at 50 Hz;
+   // 250 ms does not
+   timing_sim_config_t config = CTimingSimulator::Default();
+   config.stall_us = 50000;
+   config.stall_every = 100;
+   timing_sim_report_t shortStall = CTimingSimulator().Run(config);
+   Report("50 ms stalls", shortStall);
+   config.stall_us = 250000;
+   timing_sim_report_t longStall = CTimingSimulator().Run(config);
+   Report("250 ms stalls", longStall);
+
+   TEST_ASSERT_EQUAL_UINT32(0, shortStall.samples_dropped);
+   TEST_ASSERT_FLOAT_WITHIN(0.05f, 10.0f, shortStall.stream_rate_hz);
+   TEST_ASSERT_GREATER_THAN_UINT32(0, longStall.samples_dropped);
+   TEST_ASSERT_EQUAL_UINT8(config.queue_length, longStall.max_queue_depth);
+}
+
+void test_event_driven_against_delay_paced(void)
+{
+   // Periods that are not whole milliseconds, as a 416 Hz ODR and a 30 Hz stream
+   timing_sim_config_t config = CTimingSimulator::Default();
+   config.sensor_period_us = 1000000 / 416;
+   config.stream_rate_hz = 30;
+   timing_sim_report_t events = CTimingSimulator().Run(config);
+   delay_paced_report_t delays = RunDelayPaced(config);
+   float seconds = (float)config.duration_us / 1000000.0f;
+   float sensorRateHz = (float)events.samples_read / seconds;
+
+   char message[200];
+   snprintf(message, sizeof(message),
+            "delay-paced: sensor %.2f Hz (jitter max %u us), stream %.2f Hz (jitter max %u us), "
+            "server %.0f wake-ups/s, %.2f%% busy",
+            delays.sensor_rate_hz, delays.max_sensor_jitter_us, delays.stream_rate_hz, delays.max_frame_jitter_us,
+            delays.server_wakeups / seconds, delays.server_busy_percent);
+   TEST_MESSAGE(message);
+   snprintf(message, sizeof(message),
+            "event-driven: sensor %.2f Hz (jitter max %u us), stream %.2f Hz (jitter max %u us), "
+            "server %.0f wake-ups/s, %.2f%% busy, %.1f stream re-arms/s",
+            sensorRateHz, events.sensor_timer.max_jitter_us, events.stream_rate_hz, events.max_frame_jitter_us,
+            events.server_wakeups / seconds, events.server_busy_percent, events.stream_rearms / seconds);
+   TEST_MESSAGE(message);
+
+   // Microsecond periods hold the requested rates; whole-millisecond delays
+   // cannot express them
+   TEST_ASSERT_FLOAT_WITHIN(416.0f * 0.002f, 416.0f, sensorRateHz);
+   TEST_ASSERT_FLOAT_WITHIN(30.0f * 0.002f, 30.0f, events.stream_rate_hz);
+   TEST_ASSERT_GREATER_THAN_FLOAT(416.0f * 1.1f, delays.sensor_rate_hz);
+   TEST_ASSERT_GREATER_THAN_FLOAT(30.0f * 1.005f, delays.stream_rate_hz);
+   TEST_ASSERT_LESS_THAN_UINT32(delays.max_sensor_jitter_us, events.sensor_timer.max_jitter_us);
+   TEST_ASSERT_LESS_THAN_UINT32(delays.max_frame_jitter_us, events.max_frame_jitter_us);
+   // Fewer wake-ups leave more of the core idle
+   TEST_ASSERT_LESS_THAN_UINT32(delays.server_wakeups, events.server_wakeups);
+   TEST_ASSERT_LESS_THAN_FLOAT(delays.server_busy_percent / 1.5f, events.server_busy_percent);
+   // The stream timer is re-armed once per frame, not on every wake-up
+   TEST_ASSERT_LESS_OR_EQUAL_UINT32(events.frames_sent + events.frames_skipped + 1, events.stream_rearms);
+}
+
+void test_runs_are_deterministic(void)
+{
+   timing_sim_config_t config = CTimingSimulator::Default();
+   config.duration_us = 5000000;
+   timing_sim_report_t first = CTimingSimulator().Run(config);
+   timing_sim_report_t second = CTimingSimulator().Run(config);
+   TEST_ASSERT_EQUAL_UINT32(first.samples_read, second.samples_read);
+   TEST_ASSERT_EQUAL_UINT32(first.frames_sent, second.frames_sent);
+   TEST_ASSERT_EQUAL_UINT32(first.max_frame_jitter_us, second.max_frame_jitter_us);
+   TEST_ASSERT_EQUAL_UINT64(first.total_frame_jitter_us, second.total_frame_jitter_us);
+   TEST_ASSERT_EQUAL_UINT64(first.sensor_timer.total_jitter_us, second.sensor_timer.total_jitter_us);
+}
+
+void test_faster_period_moves_deadline(void)
+{
+   // Motion onset: the idle 10 Hz tick switches to 416 Hz 30 ms after a fire
+   CTimerDeadline timer;
+   timer.StartPeriodic(100000, 0);
+   timer.Fire(100000);
+   TEST_ASSERT_EQUAL_INT64(200000, timer.GetDueUs());
+   timer.StartPeriodic(2400, 130000);
+   TEST_ASSERT_EQUAL_INT64(132400, timer.GetDueUs());
+   timer.Fire(132400);
+   TEST_ASSERT_EQUAL_INT64(134800, timer.GetDueUs());
+
+   // Neither the change nor the jump counts as an overrun or as jitter
+   scheduler_timer_stats_t stats;
+   timer.Fire(134800);
+   timer.TakeStats(stats);
+   TEST_ASSERT_EQUAL_UINT32(0, stats.overruns);
+   TEST_ASSERT_EQUAL_UINT32(0, stats.max_jitter_us);
+}
+
+void test_raised_rate_takes_effect_at_once(void)
+{
+   // SetImuConfig raising 104 Hz to 416 Hz just after a tick: the next
+   // read is one new period away, not at the old deadline
+   CTimerDeadline timer;
+   timer.StartPeriodic(1000000 / 104, 0);
+   timer.Fire(1000000 / 104);
+   int64_t changeUs = 1000000 / 104 + 100;
+   timer.StartPeriodic(1000000 / 416, changeUs);
+   TEST_ASSERT_EQUAL_INT64(changeUs + 1000000 / 416, timer.GetDueUs());
+   TEST_ASSERT_FALSE(timer.IsDue(changeUs + 1000000 / 416 - 1, 0));
+   TEST_ASSERT_TRUE(timer.IsDue(changeUs + 1000000 / 416, 0));
+}
+
+void test_slower_period_keeps_phase(void)
+{
+   // Going idle keeps the pending deadline, which is already sooner
+   CTimerDeadline timer;
+   timer.StartPeriodic(2400, 0);
+   timer.Fire(2400);
+   timer.StartPeriodic(100000, 3000);
+   TEST_ASSERT_EQUAL_INT64(4800, timer.GetDueUs());
+   timer.Fire(4800);
+   TEST_ASSERT_EQUAL_INT64(104800, timer.GetDueUs());
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_default_stream_holds_rate);
+   RUN_TEST(test_fast_sensor_and_stream);
+   RUN_TEST(test_congested_link_backs_off);
+   RUN_TEST(test_queue_absorbs_short_stalls);
+   RUN_TEST(test_event_driven_against_delay_paced);
+   RUN_TEST(test_runs_are_deterministic);
+   RUN_TEST(test_faster_period_moves_deadline);
+   RUN_TEST(test_raised_rate_takes_effect_at_once);
+   RUN_TEST(test_slower_period_keeps_phase);
+   return UNITY_END();
+}
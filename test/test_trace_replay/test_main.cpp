@@ -0,0 +1,183 @@
+/**
+ * @file test_main.cpp
+ * @author Arunkumar Mourougappane (amouroug@buffalo.edu)
+ * @brief Host replay of a committed IMU trace: pacing, looping and
+ *        malformed lines.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) Arunkumar Mourougappane
+ *
+ */
+
+#include <unity.h>
+#include <TraceReplaySource.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+/**
+ * @brief Trace next to this file: 10 samples 10ms apart from 1000ms, a
+ *        comment, a blank line and two malformed lines.
+ */
+#define TRACE_NAME "trace.csv"
+#define TRACE_SAMPLES 10
+#define TRACE_INTERVAL_MS 10
+#define TRACE_BAD_LINES 2
+
+/**
+ * @brief Latest release accepted after a sample's due time; the host
+ *        scheduler, not the replay, sets this bound.
+ */
+#define PACING_TOLERANCE_US 15000
+
+static char s_TracePath[256];
+
+static int64_t NowUs()
+{
+   return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Find the trace from the project directory, where the test runner
+ *        starts, or else next to this source file.
+ */
+static const char *TracePath()
+{
+   snprintf(s_TracePath, sizeof(s_TracePath), "test/test_trace_replay/" TRACE_NAME);
+   FILE *file = fopen(s_TracePath, "r");
+   if (file == NULL)
+   {
+      const char *slash = strrchr(__FILE__, '/');
+      int directory = slash ? (int)(slash - __FILE__ + 1) : 0;
+      snprintf(s_TracePath, sizeof(s_TracePath), "%.*s" TRACE_NAME, directory, __FILE__);
+      file = fopen(s_TracePath, "r");
+   }
+   if (file != NULL)
+   {
+      fclose(file);
+   }
+   return s_TracePath;
+}
+
+/**
+ * @brief Poll a real-time replay and check each sample is released no
+ *        earlier than its recorded offset scaled by speed, and not much later.
+ */
+static void CheckPacing(float speed)
+{
+   CTraceReplaySource source(TracePath(), speed);
+   TEST_ASSERT_TRUE(source.Begin());
+   int64_t startUs = NowUs();
+
+   imu_sample_t samples[4];
+   uint32_t released = 0;
+   int64_t worstLateUs = 0;
+   while (released < TRACE_SAMPLES && NowUs() - startUs < 2000000)
+   {
+      uint8_t count = source.Read(samples, 4);
+      int64_t elapsedUs = NowUs() - startUs;
+      for (uint8_t i = 0; i < count; i++, released++)
+      {
+         int64_t dueUs = (int64_t)(released * TRACE_INTERVAL_MS * 1000 / speed);
+         TEST_ASSERT_GREATER_OR_EQUAL_INT64(dueUs, elapsedUs);
+         if (elapsedUs - dueUs > worstLateUs) worstLateUs = elapsedUs - dueUs;
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(500));
+   }
+
+   char message[80];
+   snprintf(message, sizeof(message), "speed %.1f: worst release %lld us after due", speed, (long long)worstLateUs);
+   TEST_MESSAGE(message);
+   TEST_ASSERT_EQUAL_UINT32(TRACE_SAMPLES, released);
+   TEST_ASSERT_LESS_OR_EQUAL_INT64(PACING_TOLERANCE_US, worstLateUs);
+   TEST_ASSERT_TRUE(source.IsFinished());
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_missing_file_is_not_ready(void)
+{
+   CTraceReplaySource source("test/does_not_exist.csv");
+   TEST_ASSERT_FALSE(source.Begin());
+}
+
+void test_as_fast_as_possible_releases_everything(void)
+{
+   CTraceReplaySource source(TracePath(), TRACE_REPLAY_AS_FAST_AS_POSSIBLE);
+   TEST_ASSERT_TRUE(source.Begin());
+
+   imu_sample_t samples[TRACE_SAMPLES + 4];
+   uint8_t count = source.Read(samples, TRACE_SAMPLES + 4);
+   TEST_ASSERT_EQUAL_UINT8(TRACE_SAMPLES, count);
+   TEST_ASSERT_TRUE(source.IsFinished());
+   TEST_ASSERT_EQUAL_UINT32(TRACE_BAD_LINES, source.GetSkippedLines());
+
+   // Recorded spacing is kept in the output timestamps
+   for (uint8_t i = 1; i < count; i++)
+   {
+      TEST_ASSERT_EQUAL_UINT32(TRACE_INTERVAL_MS, samples[i].timestamp - samples[i - 1].timestamp);
+   }
+   imu_data_t first = ImuRawToData(samples[0].raw);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.10f, first.accX);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, -0.20f, first.accY);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 9.81f, first.accZ);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.03f, first.gyroZ);
+   imu_data_t last = ImuRawToData(samples[count - 1].raw);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 1.00f, last.accX);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.12f, last.gyroZ);
+
+   TEST_ASSERT_EQUAL_UINT8(0, source.Read(samples, TRACE_SAMPLES));
+}
+
+void test_real_time_pacing(void)
+{
+   CheckPacing(1.0f);
+}
+
+void test_scaled_pacing(void)
+{
+   CheckPacing(4.0f);
+}
+
+void test_loop_continues_timeline(void)
+{
+   CTraceReplaySource source(TracePath(), TRACE_REPLAY_AS_FAST_AS_POSSIBLE, true);
+   TEST_ASSERT_TRUE(source.Begin());
+
+   imu_sample_t samples[2 * TRACE_SAMPLES + 7];
+   uint8_t count = source.Read(samples, 2 * TRACE_SAMPLES + 7);
+   TEST_ASSERT_EQUAL_UINT8(2 * TRACE_SAMPLES + 7, count);
+   TEST_ASSERT_FALSE(source.IsFinished());
+
+   // The next pass starts one interval after the last sample, so the
+   // timeline never repeats or jumps
+   for (uint8_t i = 1; i < count; i++)
+   {
+      TEST_ASSERT_EQUAL_UINT32(TRACE_INTERVAL_MS, samples[i].timestamp - samples[i - 1].timestamp);
+   }
+   imu_data_t wrapped = ImuRawToData(samples[TRACE_SAMPLES].raw);
+   TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.10f, wrapped.accX);
+   // Bad lines are counted again on every pass; the third pass has read
+   // past both of them by its seventh sample
+   TEST_ASSERT_EQUAL_UINT32(3 * TRACE_BAD_LINES, source.GetSkippedLines());
+}
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(test_missing_file_is_not_ready);
+   RUN_TEST(test_as_fast_as_possible_releases_everything);
+   RUN_TEST(test_real_time_pacing);
+   RUN_TEST(test_scaled_pacing);
+   RUN_TEST(test_loop_continues_timeline);
+   return UNITY_END();
+}
@@ -0,0 +1,111 @@
+(function () {
+  'use strict';
+
+  var FIELDS = ['acc_x', 'acc_y', 'acc_z', 'gyro_x', 'gyro_y', 'gyro_z', 'temperature'];
+  var COLORS = ['#e5534b', '#57ab5a', '#539bf5'];
+  var HISTORY = 240;
+
+  var status = document.getElementById('status');
+  var rate = document.getElementById('rate');
+  var fps = document.getElementById('fps');
+  var cells = {};
+  FIELDS.forEach(function (name) { cells[name] = document.getElementById(name); });
+
+  function Plot(id, keys, range) {
+    this.canvas = document.getElementById(id);
+    this.context = this.canvas.getContext('2d');
+    this.keys = keys;
+    this.range = range;
+    this.series = keys.map(function () { return []; });
+  }
+
+  Plot.prototype.push = function (sample) {
+    for (var i = 0; i < this.keys.length; i++) {
+      var series = this.series[i];
+      series.push(sample[this.keys[i]]);
+      if (series.length > HISTORY) series.shift();
+    }
+  };
+
+  Plot.prototype.draw = function () {
+    var ctx = this.context, w = this.canvas.width, h = this.canvas.height;
+    ctx.clearRect(0, 0, w, h);
+    ctx.strokeStyle = '#2a323b';
+    ctx.beginPath();
+    ctx.moveTo(0, h / 2);
+    ctx.lineTo(w, h / 2);
+    ctx.stroke();
+    for (var i = 0; i < this.series.length; i++) {
+      var series = this.series[i];
+      ctx.strokeStyle = COLORS[i];
+      ctx.beginPath();
+      for (var x = 0; x < series.length; x++) {
+        var y = h / 2 - (series[x] / this.range) * (h / 2);
+        if (x === 0) ctx.moveTo(x * w / HISTORY, y); else ctx.lineTo(x * w / HISTORY, y);
+      }
+      ctx.stroke();
+    }
+  };
+
+  var plots = [
+    new Plot('acc_plot', ['acc_x', 'acc_y', 'acc_z'], 20),
+    new Plot('gyro_plot', ['gyro_x', 'gyro_y', 'gyro_z'], 5)
+  ];
+
+  var socket = null;
+  var frames = 0;
+  var dirty = false;
+
+  function subscribe() {
+    if (socket && socket.readyState === WebSocket.OPEN) {
+      socket.send(JSON.stringify({ type: 'subscribe', rate: Number(rate.value), format: 'json' }));
+    }
+  }
+
+  function connect() {
+    socket = new WebSocket('ws://' + location.host + '/ws');
+    socket.onopen = function () {
+      status.textContent = 'live';
+      status.className = 'status live';
+      subscribe();
+    };
+    socket.onmessage = function (message) {
+      var sample;
+      try { sample = JSON.parse(message.data); } catch (e) { return; }
+      for (var i = 0; i < FIELDS.length; i++) {
+        var value = sample[FIELDS[i]];
+        if (typeof value === 'number') cells[FIELDS[i]].textContent = value.toFixed(3);
+      }
+      plots.forEach(function (plot) { plot.push(sample); });
+      frames++;
+      dirty = true;
+    };
+    socket.onclose = function () {
+      status.textContent = 'reconnecting';
+      status.className = 'status';
+      setTimeout(connect, 2000);
+    };
+  }
+
+  // Draw at most once per display frame, however fast samples arrive.
+  function render() {
+    if (dirty) {
+      plots.forEach(function (plot) { plot.draw(); });
+      dirty = false;
+    }
+    requestAnimationFrame(render);
+  }
+
+  setInterval(function () {
+    fps.textContent = frames;
+    frames = 0;
+  }, 1000);
+
+  rate.addEventListener('change', subscribe);
+  Array.prototype.forEach.call(document.querySelectorAll('[data-led]'), function (button) {
+    button.addEventListener('click', function () { fetch(button.getAttribute('data-led')); });
+  });
+
+  connect();
+  requestAnimationFrame(render);
+})();